@@ -0,0 +1,201 @@
+#define COSYNC_LOG_CHANNEL Spawn
+
+#include "CoSyncActorPool.h"
+
+#include "ConsoleLogger.h"
+#include "IniReader.h"
+
+// -----------------------------------------------------------------------------
+// Globals
+// -----------------------------------------------------------------------------
+CoSyncActorPool g_CoSyncActorPool;
+
+// -----------------------------------------------------------------------------
+// Setup
+// -----------------------------------------------------------------------------
+void CoSyncActorPool::SetLimits(size_t maxPerBase, size_t maxTotal)
+{
+    m_maxPerBase = maxPerBase;
+    m_maxTotal = maxTotal;
+
+    LOG_INFO("[ActorPool] Limits perBase=%zu total=%zu", m_maxPerBase, m_maxTotal);
+}
+
+bool CoSyncActorPool::LoadConfig(const char* iniPath)
+{
+    IniReader ini;
+    if (!iniPath || !ini.Load(iniPath))
+        return false;
+
+    const int perBase = ini.GetInt("ActorPoolMaxPerBase", static_cast<int>(m_maxPerBase));
+    const int total = ini.GetInt("ActorPoolMaxTotal", static_cast<int>(m_maxTotal));
+
+    SetLimits(perBase > 0 ? static_cast<size_t>(perBase) : 0,
+              total > 0 ? static_cast<size_t>(total) : 0);
+    return true;
+}
+
+size_t CoSyncActorPool::PooledCount(uint32_t baseFormID) const
+{
+    auto it = m_free.find(baseFormID);
+    return (it != m_free.end()) ? it->second.size() : 0;
+}
+
+bool CoSyncActorPool::HasRoomFor(uint32_t baseFormID) const
+{
+    return m_totalPooled < m_maxTotal &&
+        PooledCount(baseFormID) < m_maxPerBase;
+}
+
+// -----------------------------------------------------------------------------
+// Acquire
+// -----------------------------------------------------------------------------
+Actor* CoSyncActorPool::Acquire(uint32_t baseFormID, bool startHidden, bool* outReused)
+{
+    if (outReused) *outReused = false;
+
+    if (!m_engine || baseFormID == 0)
+        return nullptr;
+
+    ++m_stats.acquires;
+
+    auto it = m_free.find(baseFormID);
+    if (it != m_free.end() && !it->second.empty())
+    {
+        Actor* actor = it->second.back();
+        it->second.pop_back();
+        --m_totalPooled;
+
+        m_engine->MoveActorToPlayer(actor);
+        if (!startHidden)
+            m_engine->EnableActor(actor);
+
+        ++m_stats.reuses;
+        if (outReused) *outReused = true;
+
+        LOG_DEBUG("[ActorPool] Reuse base=0x%08X actor=%p (pooled=%zu)",
+            baseFormID, actor, m_totalPooled);
+        return actor;
+    }
+
+    Actor* actor = m_engine->CreateActor(baseFormID, startHidden);
+    if (!actor)
+    {
+        ++m_stats.createFailures;
+        return nullptr;
+    }
+
+    ++m_stats.creates;
+    return actor;
+}
+
+// -----------------------------------------------------------------------------
+// Release
+// -----------------------------------------------------------------------------
+void CoSyncActorPool::Release(uint32_t baseFormID, Actor* actor)
+{
+    if (!m_engine || !actor)
+        return;
+
+    ++m_stats.releases;
+
+    m_engine->DisableActor(actor);
+
+    if (baseFormID == 0 || !HasRoomFor(baseFormID))
+    {
+        m_engine->DeleteActor(actor);
+        ++m_stats.deletes;
+
+        LOG_DEBUG("[ActorPool] Pool full; deleted base=0x%08X actor=%p", baseFormID, actor);
+        return;
+    }
+
+    m_free[baseFormID].push_back(actor);
+    ++m_totalPooled;
+
+    LOG_DEBUG("[ActorPool] Recycled base=0x%08X actor=%p (pooled=%zu reuse=%.0f%%)",
+        baseFormID, actor, m_totalPooled, m_stats.ReuseRate() * 100.0);
+}
+
+// -----------------------------------------------------------------------------
+// Pre-warming
+// -----------------------------------------------------------------------------
+void CoSyncActorPool::SetPrewarmTarget(uint32_t baseFormID, size_t count)
+{
+    if (baseFormID == 0)
+        return;
+
+    if (count > m_maxPerBase)
+        count = m_maxPerBase;
+
+    if (count == 0)
+        m_prewarmTargets.erase(baseFormID);
+    else
+        m_prewarmTargets[baseFormID] = count;
+}
+
+void CoSyncActorPool::PumpPrewarm()
+{
+    if (!m_engine || m_prewarmTargets.empty())
+        return;
+
+    // One PlaceAtMe per call at most; pre-warming must never cause a hitch
+    for (auto& kv : m_prewarmTargets)
+    {
+        const uint32_t baseFormID = kv.first;
+
+        if (PooledCount(baseFormID) >= kv.second || !HasRoomFor(baseFormID))
+            continue;
+
+        Actor* actor = m_engine->CreateActor(baseFormID, true);
+        if (!actor)
+        {
+            ++m_stats.createFailures;
+            LOG_WARN("[ActorPool] Prewarm failed base=0x%08X; dropping target", baseFormID);
+            m_prewarmTargets.erase(baseFormID);
+            return;
+        }
+
+        m_free[baseFormID].push_back(actor);
+        ++m_totalPooled;
+        ++m_stats.prewarmed;
+
+        LOG_DEBUG("[ActorPool] Prewarmed base=0x%08X actor=%p (%zu/%zu)",
+            baseFormID, actor, PooledCount(baseFormID), kv.second);
+        return;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Teardown
+// -----------------------------------------------------------------------------
+void CoSyncActorPool::DeleteAll()
+{
+    if (m_totalPooled)
+        LOG_INFO("[ActorPool] Deleting %zu pooled actors", m_totalPooled);
+
+    if (m_engine)
+    {
+        for (auto& kv : m_free)
+        {
+            for (Actor* actor : kv.second)
+            {
+                m_engine->DeleteActor(actor);
+                ++m_stats.deletes;
+            }
+        }
+    }
+
+    m_free.clear();
+    m_totalPooled = 0;
+}
+
+void CoSyncActorPool::Reset()
+{
+    if (m_totalPooled)
+        LOG_INFO("[ActorPool] Reset (dropping %zu pooled references)", m_totalPooled);
+
+    // Prewarm targets are config, not references; they refill after load
+    m_free.clear();
+    m_totalPooled = 0;
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "CoSyncFlatMap.h"
+
+class Actor;
+
+// -----------------------------------------------------------------------------
+// ICoSyncActorEngine
+//
+// Engine operations the actor pool needs. The game implementation lives in
+// CoSyncGameAPI (GetActorEngine); anything else (headless tools, tests) can
+// provide its own and treat Actor* as an opaque handle.
+// -----------------------------------------------------------------------------
+class ICoSyncActorEngine
+{
+public:
+    virtual ~ICoSyncActorEngine() = default;
+
+    // Create a fresh persistent actor near the local player
+    virtual Actor* CreateActor(uint32_t baseFormID, bool initiallyDisabled) = 0;
+
+    virtual void EnableActor(Actor* actor) = 0;
+    virtual void DisableActor(Actor* actor) = 0;
+    virtual void DeleteActor(Actor* actor) = 0;
+
+    // Bring a recycled actor back next to the local player (current cell)
+    virtual void MoveActorToPlayer(Actor* actor) = 0;
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncActorPool
+//
+// Recycles remote proxy actors per base form (GAME THREAD ONLY).
+//
+//   Acquire : reuse a disabled pooled actor, else create one
+//   Release : disable + keep for reuse, or delete when over the caps
+//   Prewarm : create disabled actors ahead of time (≤ 1 per Pump call)
+//
+// IMPORTANT:
+//   - Pooled actors are DISABLED, never visible
+//   - Pooled actors are persistent references: DeleteAll() before a save
+//     and when the session ends, or they are written into the save
+//   - Reset() drops all references WITHOUT touching the engine
+//     (call before a save is loaded; old references are gone)
+// -----------------------------------------------------------------------------
+class CoSyncActorPool
+{
+public:
+    static constexpr size_t kDefaultMaxPerBase = 8;
+    static constexpr size_t kDefaultMaxTotal = 32;
+
+    struct Stats
+    {
+        uint64_t acquires = 0;
+        uint64_t reuses = 0;
+        uint64_t creates = 0;
+        uint64_t createFailures = 0;
+        uint64_t releases = 0;
+        uint64_t deletes = 0;
+        uint64_t prewarmed = 0;
+
+        double ReuseRate() const
+        {
+            return acquires ? double(reuses) / double(acquires) : 0.0;
+        }
+    };
+
+    // ---------------------------------------------------------------------
+    // Setup
+    // ---------------------------------------------------------------------
+    void SetEngine(ICoSyncActorEngine* engine) { m_engine = engine; }
+    void SetLimits(size_t maxPerBase, size_t maxTotal);
+
+    // Reads ActorPoolMaxPerBase and ActorPoolMaxTotal. Missing file = no
+    // change.
+    bool LoadConfig(const char* iniPath);
+
+    // ---------------------------------------------------------------------
+    // Lifetime
+    // ---------------------------------------------------------------------
+    // startHidden: actor stays disabled (caller enables on first UPDATE)
+    Actor* Acquire(uint32_t baseFormID, bool startHidden, bool* outReused = nullptr);
+    void   Release(uint32_t baseFormID, Actor* actor);
+
+    // ---------------------------------------------------------------------
+    // Pre-warming
+    // ---------------------------------------------------------------------
+    void SetPrewarmTarget(uint32_t baseFormID, size_t count);
+    void PumpPrewarm();
+
+    // ---------------------------------------------------------------------
+    // Teardown
+    // ---------------------------------------------------------------------
+    void DeleteAll();  // delete pooled actors through the engine
+    void Reset();      // forget everything (references already invalid)
+
+    // ---------------------------------------------------------------------
+    // Metrics
+    // ---------------------------------------------------------------------
+    const Stats& GetStats() const { return m_stats; }
+    size_t PooledCount() const { return m_totalPooled; }
+    size_t PooledCount(uint32_t baseFormID) const;
+
+private:
+    bool HasRoomFor(uint32_t baseFormID) const;
+
+private:
+    ICoSyncActorEngine* m_engine = nullptr;
+
+    size_t m_maxPerBase = kDefaultMaxPerBase;
+    size_t m_maxTotal = kDefaultMaxTotal;
+
+    // baseFormID -> disabled actors ready for reuse
+    CoSyncFlatMap<uint32_t, std::vector<Actor*>> m_free;
+    size_t m_totalPooled = 0;
+
+    // baseFormID -> desired number of warm actors
+    CoSyncFlatMap<uint32_t, size_t> m_prewarmTargets;
+
+    Stats m_stats;
+};
+
+extern CoSyncActorPool g_CoSyncActorPool;
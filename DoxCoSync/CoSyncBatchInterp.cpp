@@ -0,0 +1,171 @@
+#include "CoSyncBatchInterp.h"
+#include "CoSyncInterpolation.h"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define COSYNC_BATCHINTERP_SSE2 1
+#include <emmintrin.h>
+#else
+#define COSYNC_BATCHINTERP_SSE2 0
+#endif
+
+static constexpr float kTwoPi = 6.28318530718f;
+static constexpr float kInvTwoPi = 0.159154943092f;
+static constexpr float kMinSpan = 0.000001f;
+
+static float MaskBits(bool set)
+{
+    const uint32_t bits = set ? 0xFFFFFFFFu : 0u;
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// -----------------------------------------------------------------------------
+// Input
+// -----------------------------------------------------------------------------
+size_t CoSyncBatchInterp::Add(const CoSyncInterpJob& job)
+{
+    const size_t i = m_count++;
+
+    if (m_in[0].size() < m_count)
+    {
+        // Grow in SIMD-width steps; padding rows are harmless zeros
+        const size_t cap = (m_count + 3) & ~size_t(3);
+        for (auto& col : m_in)  col.resize(cap, 0.0f);
+        for (auto& col : m_out) col.resize(cap, 0.0f);
+    }
+
+    m_in[kP0X][i] = job.p0.x; m_in[kP0Y][i] = job.p0.y; m_in[kP0Z][i] = job.p0.z;
+    m_in[kV0X][i] = job.v0.x; m_in[kV0Y][i] = job.v0.y; m_in[kV0Z][i] = job.v0.z;
+    m_in[kP1X][i] = job.p1.x; m_in[kP1Y][i] = job.p1.y; m_in[kP1Z][i] = job.p1.z;
+    m_in[kV1X][i] = job.v1.x; m_in[kV1Y][i] = job.v1.y; m_in[kV1Z][i] = job.v1.z;
+    m_in[kR0X][i] = job.r0.x; m_in[kR0Y][i] = job.r0.y; m_in[kR0Z][i] = job.r0.z;
+    m_in[kR1X][i] = job.r1.x; m_in[kR1Y][i] = job.r1.y; m_in[kR1Z][i] = job.r1.z;
+
+    m_in[kElapsed][i] = job.elapsed;
+    m_in[kSpan][i] = job.span;
+    m_in[kHermiteMask][i] = MaskBits(job.hermite);
+    m_in[kArcMask][i] = MaskBits(job.shortestArc);
+
+    return i;
+}
+
+// -----------------------------------------------------------------------------
+// Dispatch
+// -----------------------------------------------------------------------------
+void CoSyncBatchInterp::Run()
+{
+    size_t simdEnd = 0;
+
+#if COSYNC_BATCHINTERP_SSE2
+    if (!m_forceScalar)
+    {
+        simdEnd = m_count & ~size_t(3);
+        RunSSE2(0, simdEnd);
+    }
+#endif
+
+    RunScalar(simdEnd, m_count);
+}
+
+// -----------------------------------------------------------------------------
+// Scalar fallback: the CoSyncInterpolation kernels, row by row
+// -----------------------------------------------------------------------------
+void CoSyncBatchInterp::RunScalar(size_t begin, size_t end)
+{
+    using namespace CoSyncInterpolation;
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        const float span = m_in[kSpan][i];
+
+        float t = (span > kMinSpan) ? m_in[kElapsed][i] / span : 0.0f;
+        t = (t < 0.0f) ? 0.0f : ((t > 1.0f) ? 1.0f : t);
+
+        uint32_t hermite, arc;
+        std::memcpy(&hermite, &m_in[kHermiteMask][i], sizeof(hermite));
+        std::memcpy(&arc, &m_in[kArcMask][i], sizeof(arc));
+
+        const NiPoint3 pos = InterpolatePosition(
+            NiPoint3(m_in[kP0X][i], m_in[kP0Y][i], m_in[kP0Z][i]),
+            NiPoint3(m_in[kV0X][i], m_in[kV0Y][i], m_in[kV0Z][i]),
+            NiPoint3(m_in[kP1X][i], m_in[kP1Y][i], m_in[kP1Z][i]),
+            NiPoint3(m_in[kV1X][i], m_in[kV1Y][i], m_in[kV1Z][i]),
+            t, span, hermite ? PositionMode::Hermite : PositionMode::Linear);
+
+        const NiPoint3 rot = LerpRotation(
+            NiPoint3(m_in[kR0X][i], m_in[kR0Y][i], m_in[kR0Z][i]),
+            NiPoint3(m_in[kR1X][i], m_in[kR1Y][i], m_in[kR1Z][i]),
+            t, arc ? RotationMode::ShortestArc : RotationMode::Euler);
+
+        m_out[kOutPX][i] = pos.x; m_out[kOutPY][i] = pos.y; m_out[kOutPZ][i] = pos.z;
+        m_out[kOutRX][i] = rot.x; m_out[kOutRY][i] = rot.y; m_out[kOutRZ][i] = rot.z;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// SSE2 kernel (4 rows per iteration)
+// -----------------------------------------------------------------------------
+#if COSYNC_BATCHINTERP_SSE2
+void CoSyncBatchInterp::RunSSE2(size_t begin, size_t end)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 three = _mm_set1_ps(3.0f);
+    const __m128 minSpan = _mm_set1_ps(kMinSpan);
+    const __m128 twoPi = _mm_set1_ps(kTwoPi);
+    const __m128 invTwoPi = _mm_set1_ps(kInvTwoPi);
+
+    for (size_t i = begin; i < end; i += 4)
+    {
+        const __m128 span = _mm_loadu_ps(&m_in[kSpan][i]);
+        const __m128 elapsed = _mm_loadu_ps(&m_in[kElapsed][i]);
+
+        // t = clamp(elapsed / span, 0, 1); 0 where span is degenerate
+        const __m128 spanOk = _mm_cmpgt_ps(span, minSpan);
+        __m128 t = _mm_div_ps(elapsed, _mm_or_ps(_mm_and_ps(spanOk, span), _mm_andnot_ps(spanOk, one)));
+        t = _mm_and_ps(spanOk, _mm_min_ps(one, _mm_max_ps(zero, t)));
+
+        const __m128 t2 = _mm_mul_ps(t, t);
+        const __m128 t3 = _mm_mul_ps(t2, t);
+
+        // Hermite basis
+        const __m128 hh01 = _mm_sub_ps(_mm_mul_ps(three, t2), _mm_mul_ps(two, t3));
+        const __m128 hh00 = _mm_sub_ps(one, hh01);
+        const __m128 hh10 = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(t3, _mm_mul_ps(two, t2)), t), span);
+        const __m128 hh11 = _mm_mul_ps(_mm_sub_ps(t3, t2), span);
+
+        // Select Hermite vs linear per row
+        const __m128 hm = _mm_loadu_ps(&m_in[kHermiteMask][i]);
+        const __m128 h00 = _mm_or_ps(_mm_and_ps(hm, hh00), _mm_andnot_ps(hm, _mm_sub_ps(one, t)));
+        const __m128 h01 = _mm_or_ps(_mm_and_ps(hm, hh01), _mm_andnot_ps(hm, t));
+        const __m128 h10 = _mm_and_ps(hm, hh10);
+        const __m128 h11 = _mm_and_ps(hm, hh11);
+
+        const __m128 am = _mm_loadu_ps(&m_in[kArcMask][i]);
+
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            __m128 p = _mm_mul_ps(h00, _mm_loadu_ps(&m_in[kP0X + axis][i]));
+            p = _mm_add_ps(p, _mm_mul_ps(h10, _mm_loadu_ps(&m_in[kV0X + axis][i])));
+            p = _mm_add_ps(p, _mm_mul_ps(h01, _mm_loadu_ps(&m_in[kP1X + axis][i])));
+            p = _mm_add_ps(p, _mm_mul_ps(h11, _mm_loadu_ps(&m_in[kV1X + axis][i])));
+            _mm_storeu_ps(&m_out[kOutPX + axis][i], p);
+
+            // Shortest arc: d -= 2PI * round(d / 2PI) (round-to-nearest MXCSR)
+            const __m128 r0 = _mm_loadu_ps(&m_in[kR0X + axis][i]);
+            __m128 d = _mm_sub_ps(_mm_loadu_ps(&m_in[kR1X + axis][i]), r0);
+
+            const __m128 turns = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(d, invTwoPi)));
+            d = _mm_sub_ps(d, _mm_and_ps(am, _mm_mul_ps(twoPi, turns)));
+
+            _mm_storeu_ps(&m_out[kOutRX + axis][i], _mm_add_ps(r0, _mm_mul_ps(d, t)));
+        }
+    }
+}
+#else
+void CoSyncBatchInterp::RunSSE2(size_t, size_t) {}
+#endif
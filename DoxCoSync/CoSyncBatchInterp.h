@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "NiTypes.h"   // NiPoint3
+
+// -----------------------------------------------------------------------------
+// CoSyncInterpJob
+//
+// One entity's interpolation input for this frame, prepared per entity
+// (clock + bracket search) by CoSyncPlayer::PrepareSmoothing().
+//
+// Times are RELATIVE floats (host timestamps are too large for float):
+//   elapsed = renderTime - sampleA.hostTime
+//   span    = sampleB.hostTime - sampleA.hostTime
+// Extrapolation is expressed as a linear job toward a predicted sample.
+// -----------------------------------------------------------------------------
+struct CoSyncInterpJob
+{
+    NiPoint3 p0{ 0.f, 0.f, 0.f };
+    NiPoint3 v0{ 0.f, 0.f, 0.f };
+    NiPoint3 p1{ 0.f, 0.f, 0.f };
+    NiPoint3 v1{ 0.f, 0.f, 0.f };
+    NiPoint3 r0{ 0.f, 0.f, 0.f };
+    NiPoint3 r1{ 0.f, 0.f, 0.f };
+
+    float elapsed = 0.0f;
+    float span = 0.0f;
+
+    bool hermite = false;       // else linear position
+    bool shortestArc = false;   // else component-wise Euler
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncBatchInterp
+//
+// Struct-of-arrays interpolation over every smoothed proxy in one pass:
+// blend factors, Hermite/linear position and shortest-arc/Euler rotation.
+//
+//   - SSE2 kernel, 4 entities per iteration (x64 baseline; no dispatch)
+//   - Scalar fallback through the CoSyncInterpolation kernels (non-SSE2
+//     builds, tail rows, ForceScalar for A/B)
+//
+// Columns are reused frame to frame (no steady-state allocation).
+// GAME THREAD ONLY.
+// -----------------------------------------------------------------------------
+class CoSyncBatchInterp
+{
+public:
+    void   Clear() { m_count = 0; }
+    size_t Add(const CoSyncInterpJob& job);
+    size_t Size() const { return m_count; }
+
+    void Run();
+
+    NiPoint3 Position(size_t i) const { return NiPoint3(m_out[kOutPX][i], m_out[kOutPY][i], m_out[kOutPZ][i]); }
+    NiPoint3 Rotation(size_t i) const { return NiPoint3(m_out[kOutRX][i], m_out[kOutRY][i], m_out[kOutRZ][i]); }
+
+    // Benchmark / validation: bypass the SIMD kernel
+    void SetForceScalar(bool force) { m_forceScalar = force; }
+
+private:
+    enum InCol : size_t
+    {
+        kP0X, kP0Y, kP0Z,
+        kV0X, kV0Y, kV0Z,
+        kP1X, kP1Y, kP1Z,
+        kV1X, kV1Y, kV1Z,
+        kR0X, kR0Y, kR0Z,
+        kR1X, kR1Y, kR1Z,
+        kElapsed, kSpan,
+        kHermiteMask,   // all-ones float bit pattern when set
+        kArcMask,
+        kInColCount
+    };
+
+    enum OutCol : size_t
+    {
+        kOutPX, kOutPY, kOutPZ,
+        kOutRX, kOutRY, kOutRZ,
+        kOutColCount
+    };
+
+    void RunScalar(size_t begin, size_t end);
+    void RunSSE2(size_t begin, size_t end);   // end - begin multiple of 4
+
+private:
+    std::vector<float> m_in[kInColCount];
+    std::vector<float> m_out[kOutColCount];
+
+    size_t m_count = 0;
+    bool   m_forceScalar = false;
+};
@@ -0,0 +1,133 @@
+#include "CoSyncClock.h"
+
+#include <atomic>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace
+{
+    // -------------------------------------------------------------------------
+    // Hardware backend
+    // -------------------------------------------------------------------------
+#if defined(_WIN32)
+    int64_t ReadFrequency()
+    {
+        LARGE_INTEGER f{};
+        QueryPerformanceFrequency(&f);
+        return static_cast<int64_t>(f.QuadPart);
+    }
+
+    int64_t ReadCounter()
+    {
+        LARGE_INTEGER c{};
+        QueryPerformanceCounter(&c);
+        return static_cast<int64_t>(c.QuadPart);
+    }
+#else
+    int64_t ReadFrequency()
+    {
+        return 1000000000;
+    }
+
+    int64_t ReadCounter()
+    {
+        timespec ts{};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+    }
+#endif
+
+    // Function-local so callers in other static initializers see it set
+    double SecondsPerTick()
+    {
+        static const double s_secondsPerTick = 1.0 / static_cast<double>(ReadFrequency());
+        return s_secondsPerTick;
+    }
+
+    // -------------------------------------------------------------------------
+    // State
+    // -------------------------------------------------------------------------
+    std::atomic<bool>   s_virtual{ false };
+    std::atomic<double> s_virtualTime{ 0.0 };
+
+    std::atomic<double> s_frameTime{ 0.0 };
+    std::atomic<bool>   s_hasFrame{ false };
+}
+
+// -----------------------------------------------------------------------------
+// Simulation time
+// -----------------------------------------------------------------------------
+double CoSyncClock::Now()
+{
+    if (s_virtual.load(std::memory_order_relaxed))
+        return s_virtualTime.load(std::memory_order_relaxed);
+
+    return static_cast<double>(ReadCounter()) * SecondsPerTick();
+}
+
+double CoSyncClock::BeginFrame()
+{
+    const double now = Now();
+
+    s_frameTime.store(now, std::memory_order_relaxed);
+    s_hasFrame.store(true, std::memory_order_release);
+    return now;
+}
+
+double CoSyncClock::FrameTime()
+{
+    if (!s_hasFrame.load(std::memory_order_acquire))
+        return Now();
+
+    return s_frameTime.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+// Instrumentation
+// -----------------------------------------------------------------------------
+int64_t CoSyncClock::Ticks()
+{
+    return ReadCounter();
+}
+
+double CoSyncClock::TicksToMicros(int64_t ticks)
+{
+    return static_cast<double>(ticks) * SecondsPerTick() * 1e6;
+}
+
+// -----------------------------------------------------------------------------
+// Virtual clock
+// -----------------------------------------------------------------------------
+void CoSyncClock::UseVirtualClock(double startSec)
+{
+    s_virtualTime.store(startSec, std::memory_order_relaxed);
+    s_virtual.store(true, std::memory_order_relaxed);
+    s_hasFrame.store(false, std::memory_order_release);
+}
+
+void CoSyncClock::UseRealClock()
+{
+    s_virtual.store(false, std::memory_order_relaxed);
+    s_hasFrame.store(false, std::memory_order_release);
+}
+
+bool CoSyncClock::IsVirtual()
+{
+    return s_virtual.load(std::memory_order_relaxed);
+}
+
+void CoSyncClock::SetVirtualTime(double sec)
+{
+    s_virtualTime.store(sec, std::memory_order_relaxed);
+}
+
+void CoSyncClock::AdvanceVirtual(double deltaSec)
+{
+    if (deltaSec > 0.0)
+        s_virtualTime.store(s_virtualTime.load(std::memory_order_relaxed) + deltaSec, std::memory_order_relaxed);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+// -----------------------------------------------------------------------------
+// CoSyncClock
+//
+// The one monotonic clock for CoSync (seconds, arbitrary epoch).
+// Backend: QueryPerformanceCounter on Windows, clock_gettime(CLOCK_MONOTONIC)
+// elsewhere. Frequency is read once.
+//
+//   Now()        - simulation time, read fresh (any thread)
+//   FrameTime()  - Now() sampled once at the start of the current frame;
+//                  use for bulk per-packet / per-entity work
+//   Ticks()      - raw hardware counter for instrumentation (latency,
+//                  budgets); always real, never virtual
+//
+// A virtual clock can be injected for deterministic tests and replay:
+// Now() and FrameTime() then return the virtual time, which only moves
+// through SetVirtualTime / AdvanceVirtual.
+// -----------------------------------------------------------------------------
+namespace CoSyncClock
+{
+    // ---------------------------------------------------------------------
+    // Simulation time
+    // ---------------------------------------------------------------------
+    double Now();
+
+    // GAME THREAD: sample Now() as this frame's time (scheduler driver)
+    double BeginFrame();
+
+    // Cached frame time (Now() until the first BeginFrame)
+    double FrameTime();
+
+    // ---------------------------------------------------------------------
+    // Instrumentation (real hardware clock)
+    // ---------------------------------------------------------------------
+    int64_t Ticks();
+    double  TicksToMicros(int64_t ticks);
+
+    inline double MicrosSince(int64_t startTicks) { return TicksToMicros(Ticks() - startTicks); }
+
+    // ---------------------------------------------------------------------
+    // Virtual clock (tests / replay)
+    // ---------------------------------------------------------------------
+    void UseVirtualClock(double startSec);
+    void UseRealClock();
+    bool IsVirtual();
+
+    void SetVirtualTime(double sec);
+    void AdvanceVirtual(double deltaSec);
+}
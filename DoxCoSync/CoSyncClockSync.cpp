@@ -0,0 +1,226 @@
+#define COSYNC_LOG_CHANNEL Net
+
+#include "CoSyncClockSync.h"
+
+#include "ConsoleLogger.h"
+#include "CoSyncTransport.h"
+#include "CoSyncTimerWheel.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+    constexpr size_t kWindow = 16;
+
+    constexpr double kPingFastSec = 0.25;     // until kFastSamples collected
+    constexpr double kPingSlowSec = 2.0;
+    constexpr uint32_t kFastSamples = 8;
+
+    constexpr double kDriftMinSpanSec = 20.0; // baseline for a drift estimate
+    constexpr double kDriftAlpha = 0.2;
+    constexpr double kMaxDrift = 500e-6;      // QPC clocks are far better
+
+    struct Sample
+    {
+        double rtt = 0.0;
+        double offset = 0.0;
+        double localTime = 0.0;
+    };
+
+    Sample   s_samples[kWindow];
+    size_t   s_head = 0;
+    size_t   s_count = 0;
+
+    // Current mapping: host = local + offset + drift * (local - anchorLocal)
+    double s_offset = 0.0;
+    double s_anchorLocal = 0.0;
+    double s_drift = 0.0;
+
+    // Drift baseline (an earlier estimate)
+    double s_baseOffset = 0.0;
+    double s_baseLocal = 0.0;
+    bool   s_hasBase = false;
+
+    double s_lastPingSent = 0.0;
+    CoSyncTimerHandle s_pingTimer{};
+
+    CoSyncClockSync::Stats s_stats;
+
+    void SendPing(double now)
+    {
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), "TS|%.6f", now);
+        CoSyncTransport::Send(buf);
+        s_lastPingSent = now;
+    }
+
+    void OnPingTimer(void*, uint64_t, double now)
+    {
+        const double interval =
+            (s_stats.samples < kFastSamples) ? kPingFastSec : kPingSlowSec;
+
+        if (now - s_lastPingSent >= interval - 0.001)
+            SendPing(now);
+    }
+
+    void UpdateEstimate(double now)
+    {
+        // Min-RTT filter: the least-queued exchange has the tightest offset
+        const Sample* best = &s_samples[0];
+        for (size_t i = 1; i < s_count; ++i)
+        {
+            if (s_samples[i].rtt < best->rtt)
+                best = &s_samples[i];
+        }
+
+        // Drift from the offset trend between well-separated estimates
+        if (!s_hasBase)
+        {
+            s_baseOffset = best->offset;
+            s_baseLocal = best->localTime;
+            s_hasBase = true;
+        }
+        else if (best->localTime - s_baseLocal >= kDriftMinSpanSec)
+        {
+            double slope = (best->offset - s_baseOffset) / (best->localTime - s_baseLocal);
+            if (slope > kMaxDrift) slope = kMaxDrift;
+            if (slope < -kMaxDrift) slope = -kMaxDrift;
+
+            s_drift += (slope - s_drift) * kDriftAlpha;
+
+            s_baseOffset = best->offset;
+            s_baseLocal = best->localTime;
+        }
+
+        // Project the chosen sample forward to now
+        s_offset = best->offset + s_drift * (now - best->localTime);
+        s_anchorLocal = now;
+
+        s_stats.offsetSec = s_offset;
+        s_stats.driftPpm = s_drift * 1e6;
+        s_stats.bestRttSec = best->rtt;
+    }
+
+    void HandlePong(const char* payload, double now)
+    {
+        double clientSend = 0.0;
+        double hostTime = 0.0;
+
+        if (std::sscanf(payload, "%lf|%lf", &clientSend, &hostTime) != 2)
+            return;
+
+        const double rtt = now - clientSend;
+        if (!(rtt >= 0.0) || rtt > 5.0)
+            return;
+
+        Sample& s = s_samples[s_head];
+        s.rtt = rtt;
+        s.offset = hostTime - (clientSend + rtt * 0.5);
+        s.localTime = now;
+
+        s_head = (s_head + 1) % kWindow;
+        if (s_count < kWindow)
+            ++s_count;
+
+        ++s_stats.samples;
+        s_stats.lastRttSec = rtt;
+
+        UpdateEstimate(now);
+
+        if (!s_stats.synced)
+        {
+            s_stats.synced = true;
+            LOG_INFO("[ClockSync] Synced offset=%.4fs rtt=%.1fms",
+                s_offset, rtt * 1000.0);
+        }
+        else if (s_stats.samples % 30 == 0)
+        {
+            LOG_DEBUG("[ClockSync] offset=%.4fs bestRtt=%.1fms drift=%.1fppm",
+                s_offset, s_stats.bestRttSec * 1000.0, s_stats.driftPpm);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tick (client pings on the shared timer wheel)
+// -----------------------------------------------------------------------------
+void CoSyncClockSync::Tick(double now, bool isHost, bool connected)
+{
+    (void)now;
+
+    if (isHost || !connected)
+    {
+        g_CoSyncTimers.Cancel(s_pingTimer);
+        return;
+    }
+
+    if (!g_CoSyncTimers.IsPending(s_pingTimer))
+    {
+        s_pingTimer = g_CoSyncTimers.ScheduleIn(
+            0.0, &OnPingTimer, nullptr, 0, kPingFastSec);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Messages
+// -----------------------------------------------------------------------------
+bool CoSyncClockSync::HandleMessage(const std::string& msg, double now, HSteamNetConnection conn, bool isHost)
+{
+    if (msg.rfind("TS|", 0) == 0)
+    {
+        // Host answers only the asking client
+        if (isHost)
+        {
+            char buf[96];
+            std::snprintf(buf, sizeof(buf), "TP|%s|%.6f", msg.c_str() + 3, now);
+            CoSyncTransport::SendTo(conn, buf);
+        }
+        return true;
+    }
+
+    if (msg.rfind("TP|", 0) == 0)
+    {
+        if (!isHost)
+            HandlePong(msg.c_str() + 3, now);
+        return true;
+    }
+
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+// Mapping
+// -----------------------------------------------------------------------------
+double CoSyncClockSync::HostNow(double localNow)
+{
+    if (!s_stats.synced)
+        return localNow;
+
+    return localNow + s_offset + s_drift * (localNow - s_anchorLocal);
+}
+
+bool CoSyncClockSync::IsSynced()
+{
+    return s_stats.synced;
+}
+
+CoSyncClockSync::Stats CoSyncClockSync::GetStats()
+{
+    return s_stats;
+}
+
+void CoSyncClockSync::Reset()
+{
+    g_CoSyncTimers.Cancel(s_pingTimer);
+
+    s_head = 0;
+    s_count = 0;
+    s_offset = 0.0;
+    s_anchorLocal = 0.0;
+    s_drift = 0.0;
+    s_hasBase = false;
+    s_lastPingSent = 0.0;
+    s_stats = Stats{};
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "steam/steamnetworkingsockets.h"
+
+// -----------------------------------------------------------------------------
+// CoSyncClockSync
+//
+// NTP-style host clock estimate. Every peer maps its local QPC clock onto
+// the HOST timeline, so all UPDATE timestamps share one session timeline.
+//
+// Protocol (text, like the rest of CoSync):
+//   client -> host : TS|<clientSendTime>
+//   host -> client : TP|<clientSendTime>|<hostTime>
+//
+// Client estimate:
+//   rtt    = recvTime - clientSendTime
+//   offset = hostTime - (clientSendTime + rtt / 2)
+//   - the lowest-RTT sample in the last kWindow wins (least queueing)
+//   - drift (clock rate difference) is tracked between estimates so the
+//     mapping holds between pings
+//
+// Host: HostNow(now) == now. GAME THREAD ONLY.
+// -----------------------------------------------------------------------------
+namespace CoSyncClockSync
+{
+    struct Stats
+    {
+        double   offsetSec = 0.0;   // host - local
+        double   driftPpm = 0.0;
+        double   bestRttSec = 0.0;  // RTT of the sample behind the estimate
+        double   lastRttSec = 0.0;
+        uint32_t samples = 0;
+        bool     synced = false;
+    };
+
+    // Start/stop pinging (client); called from CoSyncNet::Tick
+    void Tick(double now, bool isHost, bool connected);
+
+    // Consumes TS| / TP| messages; returns false for anything else
+    bool HandleMessage(const std::string& msg, double now, HSteamNetConnection conn, bool isHost);
+
+    // Local clock -> host timeline (identity on host / before first sample)
+    double HostNow(double localNow);
+
+    bool  IsSynced();
+    Stats GetStats();
+
+    // Session teardown / role change
+    void Reset();
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "NiTypes.h"   // NiPoint3
+
+// -----------------------------------------------------------------------------
+// CoSyncDeadReckoning
+//
+// Shared first-order motion model: pos + vel * dt.
+//
+// The SENDER runs it to predict what receivers currently display and only
+// sends once the real position drifts past a tolerance. The RECEIVER runs
+// the same model to extrapolate through gaps. Both sides MUST use the same
+// clamp (kMaxExtrapolationSec) or their predictions disagree.
+// -----------------------------------------------------------------------------
+namespace CoSyncDeadReckoning
+{
+    // Receivers never extrapolate further than this past the newest sample
+    static constexpr double kMaxExtrapolationSec = 0.25;
+
+    inline NiPoint3 Extrapolate(const NiPoint3& pos, const NiPoint3& vel, double dt)
+    {
+        if (dt < 0.0)
+            dt = 0.0;
+        if (dt > kMaxExtrapolationSec)
+            dt = kMaxExtrapolationSec;
+
+        const float t = static_cast<float>(dt);
+        return NiPoint3(
+            pos.x + vel.x * t,
+            pos.y + vel.y * t,
+            pos.z + vel.z * t);
+    }
+
+    inline float DistanceSq(const NiPoint3& a, const NiPoint3& b)
+    {
+        const float dx = a.x - b.x;
+        const float dy = a.y - b.y;
+        const float dz = a.z - b.z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    // Error between where receivers think we are and where we actually are
+    inline float PredictionErrorSq(
+        const NiPoint3& sentPos,
+        const NiPoint3& sentVel,
+        double sinceSent,
+        const NiPoint3& actualPos)
+    {
+        return DistanceSq(Extrapolate(sentPos, sentVel, sinceSent), actualPos);
+    }
+}
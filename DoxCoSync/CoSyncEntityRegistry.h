@@ -1,8 +1,9 @@
 #pragma once
 
-#include <unordered_map>
 #include <cstdint>
 
+#include "CoSyncFlatMap.h"
+
 class Actor;
 
 // -----------------------------------------------------------------------------
@@ -34,7 +35,7 @@ public:
     void Clear();
 
 private:
-    std::unordered_map<uint32_t, Entry> entities;
+    CoSyncFlatMap<uint32_t, Entry> entities;
 };
 
 extern CoSyncEntityRegistry g_CoSyncEntities;
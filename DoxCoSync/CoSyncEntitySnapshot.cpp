@@ -0,0 +1,58 @@
+#include "CoSyncEntitySnapshot.h"
+
+#include "CoSyncEntityTable.h"
+#include "CoSyncEntityState.h"
+
+#include <algorithm>
+
+CoSyncEntitySnapshotPublisher g_CoSyncEntitySnapshots;
+
+const CoSyncEntityView* CoSyncEntitySnapshot::Find(uint32_t entityID) const
+{
+    auto it = std::lower_bound(
+        entities.begin(), entities.end(), entityID,
+        [](const CoSyncEntityView& v, uint32_t id) { return v.entityID < id; });
+
+    return (it != entities.end() && it->entityID == entityID) ? &*it : nullptr;
+}
+
+void CoSyncEntitySnapshot::Build(const CoSyncEntityTable& table, uint64_t frameNumber, double now)
+{
+    frame = frameNumber;
+    time = now;
+
+    entities.resize(table.Size());
+
+    for (size_t row = 0; row < table.Size(); ++row)
+    {
+        const CoSyncEntityState& st = table.StateAt(row);
+        const uint8_t flags = table.FlagsAt(row);
+
+        CoSyncEntityView& v = entities[row];
+        v.entityID = table.EntityIDAt(row);
+        v.ownerEntityID = st.lastCreate.ownerEntityID;
+        v.type = st.lastCreate.type;
+        v.flags = flags;
+        v.lastUpdateLocalTime = st.lastUpdateLocalTime;
+        v.hasCreate = st.hasCreate;
+        v.spawned = (flags & CoSyncEntityTable::kHot_Spawned) != 0;
+
+        // UPDATE wins once one has arrived for this entity
+        if (st.lastUpdate.entityID == v.entityID)
+        {
+            v.pos = st.lastUpdate.pos;
+            v.rot = st.lastUpdate.rot;
+            v.vel = st.lastUpdate.vel;
+        }
+        else
+        {
+            v.pos = st.lastCreate.spawnPos;
+            v.rot = st.lastCreate.spawnRot;
+            v.vel = NiPoint3(0.f, 0.f, 0.f);
+        }
+    }
+
+    // Rows are packed in insertion/erase order; readers search by ID
+    std::sort(entities.begin(), entities.end(),
+        [](const CoSyncEntityView& a, const CoSyncEntityView& b) { return a.entityID < b.entityID; });
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "NiTypes.h"
+#include "CoSyncEntityTypes.h"
+#include "CoSyncPublisher.h"
+
+class CoSyncEntityTable;
+
+// -----------------------------------------------------------------------------
+// CoSyncEntityView
+//
+// Read-only copy of one remote entity's row, taken at the end of a game tick.
+// -----------------------------------------------------------------------------
+struct CoSyncEntityView
+{
+    uint32_t entityID = 0;
+    uint32_t ownerEntityID = 0;
+    CoSyncEntityType type = CoSyncEntityType::Player;
+    uint8_t  flags = 0;             // CoSyncEntityTable::HotFlags
+
+    // Last network transform (UPDATE, or CREATE before the first UPDATE)
+    NiPoint3 pos{ 0.f, 0.f, 0.f };
+    NiPoint3 rot{ 0.f, 0.f, 0.f };
+    NiPoint3 vel{ 0.f, 0.f, 0.f };
+    double   lastUpdateLocalTime = 0.0;
+
+    bool hasCreate = false;
+    bool spawned = false;
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncEntitySnapshot
+//
+// The whole entity table as of one game tick, sorted by entityID.
+// Published through g_CoSyncEntitySnapshots; ANY THREAD may read it:
+//
+//   auto snap = g_CoSyncEntitySnapshots.Acquire();
+//   if (snap) { if (const CoSyncEntityView* e = snap->Find(id)) ... }
+// -----------------------------------------------------------------------------
+struct CoSyncEntitySnapshot
+{
+    uint64_t frame = 0;
+    double   time = 0.0;
+
+    std::vector<CoSyncEntityView> entities;
+
+    // Binary search; nullptr if the entity was not in the table this tick
+    const CoSyncEntityView* Find(uint32_t entityID) const;
+
+    // GAME THREAD: rebuild from the live table (reuses capacity)
+    void Build(const CoSyncEntityTable& table, uint64_t frameNumber, double now);
+};
+
+using CoSyncEntitySnapshotPublisher = CoSyncPublisher<CoSyncEntitySnapshot>;
+
+// Published once per frame by CoSyncPlayerManager::TickFlush
+extern CoSyncEntitySnapshotPublisher g_CoSyncEntitySnapshots;
@@ -4,6 +4,8 @@
 
 #include "Packets_EntityCreate.h"
 #include "Packets_EntityUpdate.h"
+#include "CoSyncTimerWheel.h"
+#include "CoSyncNpcReplication.h"
 
 // -----------------------------------------------------------------------------
 // CoSyncEntityState
@@ -34,4 +36,10 @@ struct CoSyncEntityState
 
     // Liveness tracking (local time, seconds)
     double lastUpdateLocalTime = 0.0;
+
+    // Idle-timeout deadline on g_CoSyncTimers (lazily re-armed)
+    CoSyncTimerHandle timeoutTimer{};
+
+    // Host only: last transform replicated for this NPC (dirty tracking)
+    CoSyncNpcSendState npcSend{};
 };
@@ -0,0 +1,173 @@
+#include "CoSyncEntityTable.h"
+
+#include <utility>
+
+// Typical session size; avoids column regrowth during the join burst.
+static constexpr size_t kInitialCapacity = 64;
+
+// -----------------------------------------------------------------------------
+// Construction
+// -----------------------------------------------------------------------------
+CoSyncEntityTable::CoSyncEntityTable()
+{
+    m_slots.reserve(kInitialCapacity);
+    m_entityIDs.reserve(kInitialCapacity);
+    m_rowToSlot.reserve(kInitialCapacity);
+    m_flags.reserve(kInitialCapacity);
+    m_actors.reserve(kInitialCapacity);
+    m_players.reserve(kInitialCapacity);
+    m_states.reserve(kInitialCapacity);
+    m_index.reserve(kInitialCapacity);
+}
+
+// -----------------------------------------------------------------------------
+// Lookup
+// -----------------------------------------------------------------------------
+CoSyncEntityHandle CoSyncEntityTable::Find(uint32_t entityID) const
+{
+    auto it = m_index.find(entityID);
+    return (it != m_index.end()) ? it->second : CoSyncEntityHandle{};
+}
+
+bool CoSyncEntityTable::IsAlive(CoSyncEntityHandle h) const
+{
+    if (!h.IsValid() || h.index >= m_slots.size())
+        return false;
+
+    const Slot& s = m_slots[h.index];
+    return s.generation == h.generation &&
+        s.denseOrNextFree < m_entityIDs.size() &&
+        m_rowToSlot[s.denseOrNextFree] == h.index;
+}
+
+size_t CoSyncEntityTable::RowOf(CoSyncEntityHandle h) const
+{
+    if (!IsAlive(h))
+        return static_cast<size_t>(-1);
+
+    return m_slots[h.index].denseOrNextFree;
+}
+
+// -----------------------------------------------------------------------------
+// Insert
+// -----------------------------------------------------------------------------
+uint32_t CoSyncEntityTable::AllocSlot()
+{
+    if (m_freeHead != CoSyncEntityHandle::kInvalidIndex)
+    {
+        const uint32_t idx = m_freeHead;
+        m_freeHead = m_slots[idx].denseOrNextFree;
+        return idx;
+    }
+
+    m_slots.push_back(Slot{});
+    return static_cast<uint32_t>(m_slots.size() - 1);
+}
+
+CoSyncEntityHandle CoSyncEntityTable::FindOrInsert(uint32_t entityID, bool* outInserted)
+{
+    CoSyncEntityHandle h = Find(entityID);
+    if (h.IsValid())
+    {
+        if (outInserted) *outInserted = false;
+        return h;
+    }
+
+    const uint32_t slotIdx = AllocSlot();
+    const uint32_t row = static_cast<uint32_t>(m_entityIDs.size());
+
+    Slot& slot = m_slots[slotIdx];
+    slot.denseOrNextFree = row;
+
+    m_entityIDs.push_back(entityID);
+    m_rowToSlot.push_back(slotIdx);
+    m_flags.push_back(kHot_None);
+    m_actors.push_back(nullptr);
+
+    m_players.emplace_back("Remote");
+    m_players.back().entityID = entityID;
+
+    m_states.emplace_back();
+    m_states.back().entityID = entityID;
+
+    h.index = slotIdx;
+    h.generation = slot.generation;
+    m_index.emplace(entityID, h);
+
+    if (outInserted) *outInserted = true;
+    return h;
+}
+
+// -----------------------------------------------------------------------------
+// Erase (swap-with-last)
+// -----------------------------------------------------------------------------
+void CoSyncEntityTable::Erase(CoSyncEntityHandle h)
+{
+    if (!IsAlive(h))
+        return;
+
+    Slot& slot = m_slots[h.index];
+    const size_t row = slot.denseOrNextFree;
+    const size_t last = m_entityIDs.size() - 1;
+
+    m_index.erase(m_entityIDs[row]);
+
+    if (row != last)
+    {
+        m_entityIDs[row] = m_entityIDs[last];
+        m_rowToSlot[row] = m_rowToSlot[last];
+        m_flags[row] = m_flags[last];
+        m_actors[row] = m_actors[last];
+        m_players[row] = std::move(m_players[last]);
+        m_states[row] = std::move(m_states[last]);
+
+        m_slots[m_rowToSlot[row]].denseOrNextFree = static_cast<uint32_t>(row);
+    }
+
+    m_entityIDs.pop_back();
+    m_rowToSlot.pop_back();
+    m_flags.pop_back();
+    m_actors.pop_back();
+    m_players.pop_back();
+    m_states.pop_back();
+
+    // Retire the slot: bump generation so stale handles stop resolving
+    ++slot.generation;
+    slot.denseOrNextFree = m_freeHead;
+    m_freeHead = h.index;
+}
+
+void CoSyncEntityTable::Clear()
+{
+    m_slots.clear();
+    m_freeHead = CoSyncEntityHandle::kInvalidIndex;
+    m_index.clear();
+
+    m_entityIDs.clear();
+    m_rowToSlot.clear();
+    m_flags.clear();
+    m_actors.clear();
+    m_players.clear();
+    m_states.clear();
+}
+
+// -----------------------------------------------------------------------------
+// Hot columns
+// -----------------------------------------------------------------------------
+void CoSyncEntityTable::RefreshHotColumns(size_t row)
+{
+    const CoSyncEntityState& st = m_states[row];
+    const CoSyncPlayer& pl = m_players[row];
+
+    uint8_t f = kHot_None;
+
+    if (st.hasCreate)         f |= kHot_HasCreate;
+    if (st.isNPC)             f |= kHot_NPC;
+    if (st.hostAuthoritative) f |= kHot_HostAuthoritative;
+    if (st.isLocallyOwned)    f |= kHot_LocallyOwned;
+    if (pl.isRemoteControlled) f |= kHot_RemoteControlled;
+    if (pl.hasSpawned && pl.actorRef) f |= kHot_Spawned;
+
+    m_flags[row] = f;
+    m_actors[row] = pl.actorRef;
+}
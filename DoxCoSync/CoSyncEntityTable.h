@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "CoSyncEntityState.h"
+#include "CoSyncFlatMap.h"
+#include "CoSyncPlayer.h"
+
+class Actor;
+
+// -----------------------------------------------------------------------------
+// CoSyncEntityHandle
+//
+// Stable reference to a row in CoSyncEntityTable.
+// A handle stays valid until its entity is erased; after that the slot's
+// generation is bumped and the old handle resolves to nothing.
+// -----------------------------------------------------------------------------
+struct CoSyncEntityHandle
+{
+    static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+    uint32_t index = kInvalidIndex;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != kInvalidIndex; }
+
+    bool operator==(const CoSyncEntityHandle& o) const
+    {
+        return index == o.index && generation == o.generation;
+    }
+
+    bool operator!=(const CoSyncEntityHandle& o) const { return !(*this == o); }
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncEntityTable
+//
+// Generational slot map holding ALL remote entities (GAME THREAD ONLY).
+//
+// Layout:
+//   - Sparse slots  : handle.index -> dense row (+ generation)
+//   - Dense columns : one row per live entity, packed, no holes
+//
+// Hot per-frame data lives in its own columns (flags, actor pointer) so the
+// tick loops stream through small contiguous arrays and only touch the
+// proxy / state rows for entities that actually need work.
+//
+// IMPORTANT:
+//   - Erase swaps the last row into the erased row (rows are NOT stable)
+//   - Insert may grow the columns: references returned by PlayerAt/StateAt
+//     are invalidated by Insert/Erase. Hold handles, not references.
+// -----------------------------------------------------------------------------
+class CoSyncEntityTable
+{
+public:
+    // Hot flag column (mirrors state/proxy fields the tick loops branch on)
+    enum HotFlags : uint8_t
+    {
+        kHot_None = 0,
+        kHot_HasCreate = 1 << 0,
+        kHot_Spawned = 1 << 1,          // proxy has a live actor
+        kHot_NPC = 1 << 2,
+        kHot_HostAuthoritative = 1 << 3,
+        kHot_RemoteControlled = 1 << 4,
+        kHot_LocallyOwned = 1 << 5,
+    };
+
+    CoSyncEntityTable();
+
+    // ---------------------------------------------------------------------
+    // Lookup / lifetime
+    // ---------------------------------------------------------------------
+    CoSyncEntityHandle Find(uint32_t entityID) const;
+    CoSyncEntityHandle FindOrInsert(uint32_t entityID, bool* outInserted = nullptr);
+
+    bool IsAlive(CoSyncEntityHandle h) const;
+
+    void Erase(CoSyncEntityHandle h);
+    void Clear();
+
+    // ---------------------------------------------------------------------
+    // Dense row access (0 .. Size()-1)
+    // ---------------------------------------------------------------------
+    size_t Size() const { return m_entityIDs.size(); }
+    bool   Empty() const { return m_entityIDs.empty(); }
+
+    size_t RowOf(CoSyncEntityHandle h) const;
+
+    uint32_t EntityIDAt(size_t row) const { return m_entityIDs[row]; }
+    uint8_t  FlagsAt(size_t row) const { return m_flags[row]; }
+    Actor*   ActorAt(size_t row) const { return m_actors[row]; }
+
+    CoSyncPlayer&            PlayerAt(size_t row) { return m_players[row]; }
+    const CoSyncPlayer&      PlayerAt(size_t row) const { return m_players[row]; }
+    CoSyncEntityState&       StateAt(size_t row) { return m_states[row]; }
+    const CoSyncEntityState& StateAt(size_t row) const { return m_states[row]; }
+
+    // Re-derive the hot columns for a row from its state + proxy.
+    // Call after mutating lifecycle fields (CREATE, spawn, despawn).
+    void RefreshHotColumns(size_t row);
+
+private:
+    struct Slot
+    {
+        uint32_t generation = 0;
+        uint32_t denseOrNextFree = CoSyncEntityHandle::kInvalidIndex;
+    };
+
+    uint32_t AllocSlot();
+
+private:
+    // Sparse
+    std::vector<Slot> m_slots;
+    uint32_t m_freeHead = CoSyncEntityHandle::kInvalidIndex;
+
+    // entityID -> handle
+    CoSyncFlatMap<uint32_t, CoSyncEntityHandle> m_index;
+
+    // Dense columns (same length, same row order)
+    std::vector<uint32_t>          m_entityIDs;
+    std::vector<uint32_t>          m_rowToSlot;
+    std::vector<uint8_t>           m_flags;
+    std::vector<Actor*>            m_actors;
+    std::vector<CoSyncPlayer>      m_players;
+    std::vector<CoSyncEntityState> m_states;
+};
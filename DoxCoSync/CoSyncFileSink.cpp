@@ -0,0 +1,233 @@
+#include "CoSyncFileSink.h"
+
+#include "CoSyncFileSystem.h"
+
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+    int64_t NowTicks()
+    {
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+
+    int64_t SecondsToTicks(double sec)
+    {
+        using Period = std::chrono::steady_clock::period;
+        return static_cast<int64_t>(sec * double(Period::den) / double(Period::num));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Construction
+// -----------------------------------------------------------------------------
+CoSyncFileSink::CoSyncFileSink(const std::string& path)
+    : CoSyncFileSink(path, Config())
+{
+}
+
+CoSyncFileSink::CoSyncFileSink(const std::string& path, const Config& config)
+    : m_path(path)
+    , m_config(config)
+{
+    if (m_config.bufferBytes < 1024)
+        m_config.bufferBytes = 1024;
+    if (m_config.maxFiles < 1)
+        m_config.maxFiles = 1;
+
+    m_buffer.resize(m_config.bufferBytes);
+    m_lastFlushTicks = NowTicks();
+}
+
+CoSyncFileSink::~CoSyncFileSink()
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+
+    FlushLocked();
+
+    if (m_file)
+    {
+        fclose(m_file);
+        m_file = nullptr;
+    }
+}
+
+std::string CoSyncFileSink::RotatedPath(uint32_t n) const
+{
+    const std::string suffix = "." + std::to_string(n);
+
+    const size_t dot = m_path.find_last_of('.');
+    const size_t slash = m_path.find_last_of("\\/");
+
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+        return m_path + suffix;
+
+    return m_path.substr(0, dot) + suffix + m_path.substr(dot);
+}
+
+// -----------------------------------------------------------------------------
+// ISink
+// -----------------------------------------------------------------------------
+void CoSyncFileSink::Write(CoSyncLog::Level level, double timeSec, const char* line, size_t len)
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+
+    char stamp[32];
+    const int stampLen = snprintf(stamp, sizeof(stamp), "[%10.3f] ", timeSec);
+
+    if (stampLen > 0)
+        AppendLocked(stamp, size_t(stampLen));
+
+    AppendLocked(line, len);
+#ifdef _WIN32
+    AppendLocked("\r\n", 2);
+#else
+    AppendLocked("\n", 1);
+#endif
+
+    // Errors hit the disk immediately (likely followed by a crash)
+    if (level >= CoSyncLog::Level::Error)
+        FlushLocked();
+}
+
+void CoSyncFileSink::EndBatch()
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+
+    if (m_used == 0)
+        return;
+
+    if (NowTicks() - m_lastFlushTicks >= SecondsToTicks(m_config.flushIntervalSec))
+        FlushLocked();
+}
+
+void CoSyncFileSink::Flush()
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+    FlushLocked();
+}
+
+void CoSyncFileSink::TryFlush()
+{
+    if (!m_mutex.try_lock())
+        return;
+
+    FlushLocked();
+    m_mutex.unlock();
+}
+
+CoSyncFileSink::Stats CoSyncFileSink::GetStats() const
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+    return m_stats;
+}
+
+// -----------------------------------------------------------------------------
+// Internals (m_mutex held)
+// -----------------------------------------------------------------------------
+void CoSyncFileSink::AppendLocked(const char* data, size_t len)
+{
+    while (len > 0)
+    {
+        if (m_used == m_buffer.size())
+            FlushLocked();
+
+        const size_t room = m_buffer.size() - m_used;
+        const size_t chunk = (len < room) ? len : room;
+
+        memcpy(m_buffer.data() + m_used, data, chunk);
+        m_used += chunk;
+        data += chunk;
+        len -= chunk;
+    }
+}
+
+bool CoSyncFileSink::OpenLocked()
+{
+    if (m_file)
+        return true;
+
+    if (m_openFailed)
+        return false;
+
+    m_file = CoSyncFileSystem::OpenFile(m_path, "ab");
+    if (!m_file)
+    {
+        m_openFailed = true;
+        return false;
+    }
+
+    const int64_t size = CoSyncFileSystem::FileSize(m_path);
+    m_fileBytes = (size > 0) ? uint64_t(size) : 0;
+    return true;
+}
+
+void CoSyncFileSink::RotateLocked()
+{
+    if (m_file)
+    {
+        fclose(m_file);
+        m_file = nullptr;
+    }
+
+    if (m_config.maxFiles > 1)
+    {
+        // Drop the oldest, shift the rest up by one
+        CoSyncFileSystem::RemoveFile(RotatedPath(m_config.maxFiles - 1));
+
+        for (uint32_t n = m_config.maxFiles - 1; n > 1; --n)
+            CoSyncFileSystem::RenameFile(RotatedPath(n - 1), RotatedPath(n));
+
+        CoSyncFileSystem::RenameFile(m_path, RotatedPath(1));
+    }
+    else
+    {
+        CoSyncFileSystem::RemoveFile(m_path);
+    }
+
+    ++m_stats.rotations;
+    m_fileBytes = 0;
+}
+
+void CoSyncFileSink::FlushLocked()
+{
+    m_lastFlushTicks = NowTicks();
+
+    if (m_used == 0)
+        return;
+
+    if (m_file && m_fileBytes > 0 && m_fileBytes + m_used > m_config.maxFileBytes)
+        RotateLocked();
+
+    if (!OpenLocked())
+    {
+        ++m_stats.writeErrors;
+        m_used = 0;
+        return;
+    }
+
+    // Fresh file after open (existing log may already be over the cap)
+    if (m_fileBytes > 0 && m_fileBytes + m_used > m_config.maxFileBytes)
+    {
+        RotateLocked();
+        if (!OpenLocked())
+        {
+            ++m_stats.writeErrors;
+            m_used = 0;
+            return;
+        }
+    }
+
+    const size_t written = fwrite(m_buffer.data(), 1, m_used, m_file);
+    fflush(m_file);
+
+    if (written != m_used)
+        ++m_stats.writeErrors;
+
+    m_fileBytes += written;
+    m_stats.bytesWritten += written;
+    ++m_stats.flushes;
+
+    m_used = 0;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoSyncLog.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// CoSyncFileSink
+//
+// Persistent, buffered, size-rotated log file.
+//
+//   - File opened once (append), kept open
+//   - Lines batched in memory; written when the buffer fills, on an
+//     Error-level line, every flushIntervalSec, or on Flush()
+//   - Rotation: F4MP.log -> F4MP.1.log -> ... -> F4MP.<maxFiles-1>.log
+//
+// Thread-safe (internal lock); normally only the logger thread writes.
+// -----------------------------------------------------------------------------
+class CoSyncFileSink : public CoSyncLog::ISink
+{
+public:
+    struct Config
+    {
+        size_t   bufferBytes = 64 * 1024;
+        uint64_t maxFileBytes = 8ull * 1024 * 1024;
+        uint32_t maxFiles = 3;               // current + rotated backups
+        double   flushIntervalSec = 1.0;
+    };
+
+    struct Stats
+    {
+        uint64_t bytesWritten = 0;
+        uint64_t flushes = 0;
+        uint64_t rotations = 0;
+        uint64_t writeErrors = 0;
+    };
+
+    explicit CoSyncFileSink(const std::string& path);
+    CoSyncFileSink(const std::string& path, const Config& config);
+    ~CoSyncFileSink() override;
+
+    CoSyncFileSink(const CoSyncFileSink&) = delete;
+    CoSyncFileSink& operator=(const CoSyncFileSink&) = delete;
+
+    // ISink
+    void Write(CoSyncLog::Level level, double timeSec, const char* line, size_t len) override;
+    void EndBatch() override;
+    void Flush() override;
+
+    // Crash path: never blocks on the lock
+    void TryFlush();
+
+    const std::string& GetPath() const { return m_path; }
+    Stats GetStats() const;
+
+    // Name of rotated file n (1 = newest backup)
+    std::string RotatedPath(uint32_t n) const;
+
+private:
+    bool OpenLocked();
+    void RotateLocked();
+    void FlushLocked();
+    void AppendLocked(const char* data, size_t len);
+
+private:
+    mutable std::mutex m_mutex;
+
+    std::string m_path;
+    Config m_config;
+
+    FILE*    m_file = nullptr;
+    bool     m_openFailed = false;
+    uint64_t m_fileBytes = 0;
+
+    std::vector<char> m_buffer;
+    size_t m_used = 0;
+
+    int64_t m_lastFlushTicks = 0;
+
+    Stats m_stats;
+};
@@ -0,0 +1,114 @@
+#include "CoSyncFileSystem.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <shlobj.h>
+#include <share.h>
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <cerrno>
+#endif
+
+namespace
+{
+    std::string ResolveLogDirectory()
+    {
+#ifdef _WIN32
+        char docPath[MAX_PATH]{};
+
+        if (SUCCEEDED(SHGetFolderPathA(NULL, CSIDL_PERSONAL, NULL, SHGFP_TYPE_CURRENT, docPath)))
+        {
+            const std::string games = std::string(docPath) + "\\My Games\\Fallout4";
+            const std::string folder = games + "\\F4SE";
+
+            CoSyncFileSystem::EnsureDirectory(games);
+            CoSyncFileSystem::EnsureDirectory(folder);
+
+            return folder;
+        }
+#endif
+        // Fallback: working directory (next to Fallout4.exe in game)
+        return ".";
+    }
+}
+
+const std::string& CoSyncFileSystem::GetLogDirectory()
+{
+    static const std::string s_dir = ResolveLogDirectory();
+    return s_dir;
+}
+
+std::string CoSyncFileSystem::JoinPath(const std::string& dir, const std::string& name)
+{
+    if (dir.empty())
+        return name;
+
+    const char last = dir[dir.size() - 1];
+    if (last == '\\' || last == '/')
+        return dir + name;
+
+#ifdef _WIN32
+    return dir + "\\" + name;
+#else
+    return dir + "/" + name;
+#endif
+}
+
+bool CoSyncFileSystem::EnsureDirectory(const std::string& path)
+{
+#ifdef _WIN32
+    if (CreateDirectoryA(path.c_str(), NULL))
+        return true;
+
+    return GetLastError() == ERROR_ALREADY_EXISTS;
+#else
+    return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+#endif
+}
+
+bool CoSyncFileSystem::FileExists(const std::string& path)
+{
+    return FileSize(path) >= 0;
+}
+
+int64_t CoSyncFileSystem::FileSize(const std::string& path)
+{
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &data))
+        return -1;
+
+    return (int64_t(data.nFileSizeHigh) << 32) | int64_t(data.nFileSizeLow);
+#else
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0)
+        return -1;
+
+    return int64_t(st.st_size);
+#endif
+}
+
+bool CoSyncFileSystem::RemoveFile(const std::string& path)
+{
+    return std::remove(path.c_str()) == 0;
+}
+
+bool CoSyncFileSystem::RenameFile(const std::string& from, const std::string& to)
+{
+#ifdef _WIN32
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+FILE* CoSyncFileSystem::OpenFile(const std::string& path, const char* mode)
+{
+#ifdef _WIN32
+    // Shared-read so the log can be tailed while the game runs
+    return _fsopen(path.c_str(), mode, _SH_DENYWR);
+#else
+    return std::fopen(path.c_str(), mode);
+#endif
+}
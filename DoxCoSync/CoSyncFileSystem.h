@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// CoSyncFileSystem
+//
+// Thin portable file layer for the log sinks. Win32 in the plugin; POSIX
+// elsewhere so file-backed code can be exercised off-Windows.
+// -----------------------------------------------------------------------------
+namespace CoSyncFileSystem
+{
+    // Documents\My Games\Fallout4\F4SE (created on first call; resolved once).
+    // Falls back to the working directory.
+    const std::string& GetLogDirectory();
+
+    std::string JoinPath(const std::string& dir, const std::string& name);
+
+    bool EnsureDirectory(const std::string& path);
+    bool FileExists(const std::string& path);
+
+    // -1 if missing
+    int64_t FileSize(const std::string& path);
+
+    bool RemoveFile(const std::string& path);
+
+    // Replaces an existing target
+    bool RenameFile(const std::string& from, const std::string& to);
+
+    // nullptr on failure
+    FILE* OpenFile(const std::string& path, const char* mode);
+}
@@ -0,0 +1,611 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <tuple>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define COSYNC_FLATMAP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// CoSyncFlatMap / CoSyncFlatSet
+//
+// Small SwissTable-style open-addressing hash table for ID keys
+// (entityID, SteamID, HSteamNetConnection, pointers).
+//
+// Layout:
+//   - One control byte per slot: EMPTY / DELETED / 7-bit hash tag
+//   - Slots stored inline in one flat array (no per-node allocation)
+//   - Probing scans 16 control bytes at a time (SSE2, scalar fallback)
+//
+// Rules:
+//   - Keys MUST be integral, enum or pointer types
+//   - Insert / rehash invalidates iterators and references
+//   - Erase leaves a tombstone; it does NOT move other entries
+//   - NOT thread-safe (callers keep their existing locks)
+// -----------------------------------------------------------------------------
+
+namespace CoSyncFlatDetail
+{
+    static constexpr size_t kGroupWidth = 16;
+
+    static constexpr int8_t kEmpty = -128;  // 0b10000000
+    static constexpr int8_t kDeleted = -2;  // 0b11111110
+
+    inline const int8_t* EmptyGroup()
+    {
+        alignas(16) static const int8_t s_empty[kGroupWidth] = {
+            kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty,
+            kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty
+        };
+        return s_empty;
+    }
+
+    inline uint32_t CountTrailingZeros(uint32_t v)
+    {
+#if defined(_MSC_VER)
+        unsigned long idx = 0;
+        _BitScanForward(&idx, v);
+        return static_cast<uint32_t>(idx);
+#else
+        return static_cast<uint32_t>(__builtin_ctz(v));
+#endif
+    }
+
+    // 64-bit finalizer (murmur3 fmix64). IDs are often sequential or share
+    // low bits (SteamID lower halves), so a real mix matters.
+    inline size_t Mix(uint64_t x)
+    {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return static_cast<size_t>(x);
+    }
+
+    // 16 control bytes probed together
+    struct Group
+    {
+#if COSYNC_FLATMAP_SSE2
+        __m128i ctrl;
+
+        explicit Group(const int8_t* p)
+            : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)))
+        {
+        }
+
+        uint32_t Match(int8_t h2) const
+        {
+            return static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+        }
+
+        uint32_t MatchEmpty() const
+        {
+            return Match(kEmpty);
+        }
+
+        // EMPTY and DELETED are the only negative control values
+        uint32_t MatchEmptyOrDeleted() const
+        {
+            return static_cast<uint32_t>(_mm_movemask_epi8(ctrl));
+        }
+#else
+        int8_t ctrl[kGroupWidth];
+
+        explicit Group(const int8_t* p)
+        {
+            std::memcpy(ctrl, p, kGroupWidth);
+        }
+
+        uint32_t Match(int8_t h2) const
+        {
+            uint32_t bits = 0;
+            for (uint32_t i = 0; i < kGroupWidth; ++i)
+                bits |= static_cast<uint32_t>(ctrl[i] == h2) << i;
+            return bits;
+        }
+
+        uint32_t MatchEmpty() const
+        {
+            return Match(kEmpty);
+        }
+
+        uint32_t MatchEmptyOrDeleted() const
+        {
+            uint32_t bits = 0;
+            for (uint32_t i = 0; i < kGroupWidth; ++i)
+                bits |= static_cast<uint32_t>(ctrl[i] < 0) << i;
+            return bits;
+        }
+#endif
+    };
+}
+
+// -----------------------------------------------------------------------------
+// Hash for ID keys
+// -----------------------------------------------------------------------------
+template <class K>
+struct CoSyncFlatHash
+{
+    static_assert(std::is_integral<K>::value || std::is_enum<K>::value,
+        "CoSyncFlatHash: key must be an integral or enum ID type");
+
+    size_t operator()(K key) const
+    {
+        return CoSyncFlatDetail::Mix(static_cast<uint64_t>(key));
+    }
+};
+
+template <class T>
+struct CoSyncFlatHash<T*>
+{
+    size_t operator()(T* key) const
+    {
+        return CoSyncFlatDetail::Mix(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key)));
+    }
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncFlatMap
+// -----------------------------------------------------------------------------
+template <class K, class V, class Hash = CoSyncFlatHash<K>>
+class CoSyncFlatMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+
+    // ---------------------------------------------------------------------
+    // Iterators (forward only; skip non-full slots)
+    // ---------------------------------------------------------------------
+    template <bool IsConst>
+    class IteratorT
+    {
+    public:
+        using Owner = typename std::conditional<IsConst, const CoSyncFlatMap, CoSyncFlatMap>::type;
+        using Ref = typename std::conditional<IsConst, const value_type&, value_type&>::type;
+        using Ptr = typename std::conditional<IsConst, const value_type*, value_type*>::type;
+
+        IteratorT() = default;
+        IteratorT(Owner* owner, size_t index) : m_owner(owner), m_index(index) { SkipEmpty(); }
+
+        // iterator -> const_iterator
+        template <bool C = IsConst, typename std::enable_if<C, int>::type = 0>
+        IteratorT(const IteratorT<false>& o) : m_owner(o.m_owner), m_index(o.m_index) {}
+
+        Ref operator*() const { return m_owner->m_slots[m_index]; }
+        Ptr operator->() const { return &m_owner->m_slots[m_index]; }
+
+        IteratorT& operator++()
+        {
+            ++m_index;
+            SkipEmpty();
+            return *this;
+        }
+
+        bool operator==(const IteratorT& o) const { return m_index == o.m_index; }
+        bool operator!=(const IteratorT& o) const { return m_index != o.m_index; }
+
+    private:
+        friend class CoSyncFlatMap;
+        template <bool> friend class IteratorT;
+
+        void SkipEmpty()
+        {
+            while (m_index < m_owner->m_capacity && m_owner->m_ctrl[m_index] < 0)
+                ++m_index;
+        }
+
+        Owner* m_owner = nullptr;
+        size_t m_index = 0;
+    };
+
+    using iterator = IteratorT<false>;
+    using const_iterator = IteratorT<true>;
+
+public:
+    CoSyncFlatMap() = default;
+
+    CoSyncFlatMap(const CoSyncFlatMap& o)
+    {
+        reserve(o.m_size);
+        for (const value_type& kv : o)
+            emplace(kv.first, kv.second);
+    }
+
+    CoSyncFlatMap(CoSyncFlatMap&& o) noexcept
+    {
+        Swap(o);
+    }
+
+    CoSyncFlatMap& operator=(const CoSyncFlatMap& o)
+    {
+        if (this != &o)
+        {
+            CoSyncFlatMap tmp(o);
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    CoSyncFlatMap& operator=(CoSyncFlatMap&& o) noexcept
+    {
+        if (this != &o)
+        {
+            CoSyncFlatMap tmp(std::move(o));
+            Swap(tmp);
+        }
+        return *this;
+    }
+
+    ~CoSyncFlatMap()
+    {
+        DestroyAll();
+        Deallocate();
+    }
+
+    // ---------------------------------------------------------------------
+    // Capacity
+    // ---------------------------------------------------------------------
+    size_t size() const { return m_size; }
+    bool   empty() const { return m_size == 0; }
+    size_t capacity() const { return m_capacity; }
+
+    void reserve(size_t count)
+    {
+        const size_t needed = CapacityFor(count);
+        if (needed > m_capacity)
+            Rehash(needed);
+    }
+
+    // ---------------------------------------------------------------------
+    // Iteration
+    // ---------------------------------------------------------------------
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, m_capacity); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_capacity); }
+
+    // ---------------------------------------------------------------------
+    // Lookup
+    // ---------------------------------------------------------------------
+    iterator find(const K& key)
+    {
+        const size_t i = FindIndex(key);
+        return (i != kNotFound) ? iterator(this, i) : end();
+    }
+
+    const_iterator find(const K& key) const
+    {
+        const size_t i = FindIndex(key);
+        return (i != kNotFound) ? const_iterator(this, i) : end();
+    }
+
+    size_t count(const K& key) const { return FindIndex(key) != kNotFound ? 1 : 0; }
+
+    V& operator[](const K& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    // ---------------------------------------------------------------------
+    // Insert
+    // ---------------------------------------------------------------------
+    template <class... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        const size_t hash = Hash()(key);
+
+        size_t i = FindIndex(key, hash);
+        if (i != kNotFound)
+            return std::make_pair(iterator(this, i), false);
+
+        i = PrepareInsert(hash);
+        new (&m_slots[i]) value_type(
+            std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...));
+        ++m_size;
+
+        return std::make_pair(iterator(this, i), true);
+    }
+
+    template <class VV>
+    std::pair<iterator, bool> emplace(const K& key, VV&& value)
+    {
+        return try_emplace(key, std::forward<VV>(value));
+    }
+
+    // ---------------------------------------------------------------------
+    // Erase
+    // ---------------------------------------------------------------------
+    size_t erase(const K& key)
+    {
+        const size_t i = FindIndex(key);
+        if (i == kNotFound)
+            return 0;
+
+        EraseAt(i);
+        return 1;
+    }
+
+    void erase(iterator it)
+    {
+        if (it.m_index < m_capacity && m_ctrl[it.m_index] >= 0)
+            EraseAt(it.m_index);
+    }
+
+    void clear()
+    {
+        DestroyAll();
+
+        if (m_capacity)
+        {
+            std::memset(m_ctrl, CoSyncFlatDetail::kEmpty, m_capacity + CoSyncFlatDetail::kGroupWidth);
+            m_growthLeft = MaxLoad(m_capacity);
+        }
+
+        m_size = 0;
+    }
+
+private:
+    static constexpr size_t kNotFound = static_cast<size_t>(-1);
+
+    // 7/8 max load factor
+    static size_t MaxLoad(size_t cap) { return cap - cap / 8; }
+
+    static size_t CapacityFor(size_t count)
+    {
+        size_t cap = CoSyncFlatDetail::kGroupWidth;
+        while (MaxLoad(cap) < count)
+            cap <<= 1;
+        return cap;
+    }
+
+    static int8_t H2(size_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+    static size_t H1(size_t hash) { return hash >> 7; }
+
+    size_t FindIndex(const K& key) const
+    {
+        return FindIndex(key, Hash()(key));
+    }
+
+    size_t FindIndex(const K& key, size_t hash) const
+    {
+        using namespace CoSyncFlatDetail;
+
+        const int8_t h2 = H2(hash);
+        size_t pos = H1(hash) & m_mask;
+        size_t step = 0;
+
+        for (;;)
+        {
+            const Group g(m_ctrl + pos);
+
+            for (uint32_t bits = g.Match(h2); bits; bits &= bits - 1)
+            {
+                const size_t i = (pos + CountTrailingZeros(bits)) & m_mask;
+                if (m_slots[i].first == key)
+                    return i;
+            }
+
+            if (g.MatchEmpty())
+                return kNotFound;
+
+            step += kGroupWidth;
+            pos = (pos + step) & m_mask;
+        }
+    }
+
+    size_t FindInsertSlot(size_t hash) const
+    {
+        using namespace CoSyncFlatDetail;
+
+        size_t pos = H1(hash) & m_mask;
+        size_t step = 0;
+
+        for (;;)
+        {
+            const Group g(m_ctrl + pos);
+            const uint32_t bits = g.MatchEmptyOrDeleted();
+            if (bits)
+                return (pos + CountTrailingZeros(bits)) & m_mask;
+
+            step += kGroupWidth;
+            pos = (pos + step) & m_mask;
+        }
+    }
+
+    size_t PrepareInsert(size_t hash)
+    {
+        size_t i = (m_capacity != 0) ? FindInsertSlot(hash) : 0;
+
+        // Only claiming a never-used slot consumes growth; reusing a
+        // tombstone does not.
+        if (m_capacity == 0 || (m_growthLeft == 0 && m_ctrl[i] == CoSyncFlatDetail::kEmpty))
+        {
+            // Mostly tombstones -> rebuild in place; otherwise double.
+            const size_t newCap = (m_capacity != 0 && m_size * 2 <= MaxLoad(m_capacity))
+                ? m_capacity
+                : CapacityFor(m_size + 1);
+
+            Rehash(newCap);
+            i = FindInsertSlot(hash);
+        }
+
+        if (m_ctrl[i] == CoSyncFlatDetail::kEmpty)
+            --m_growthLeft;
+
+        SetCtrl(i, H2(hash));
+        return i;
+    }
+
+    void SetCtrl(size_t i, int8_t c)
+    {
+        m_ctrl[i] = c;
+
+        // Mirror the first group past the end so unaligned group loads
+        // near the end wrap around without a branch.
+        if (i < CoSyncFlatDetail::kGroupWidth)
+            m_ctrl[m_capacity + i] = c;
+    }
+
+    void EraseAt(size_t i)
+    {
+        m_slots[i].~value_type();
+        SetCtrl(i, CoSyncFlatDetail::kDeleted);
+        --m_size;
+    }
+
+    void Rehash(size_t newCap)
+    {
+        int8_t* oldCtrl = m_ctrl;
+        value_type* oldSlots = m_slots;
+        const size_t oldCap = m_capacity;
+
+        m_ctrl = new int8_t[newCap + CoSyncFlatDetail::kGroupWidth];
+        std::memset(m_ctrl, CoSyncFlatDetail::kEmpty, newCap + CoSyncFlatDetail::kGroupWidth);
+        m_slots = static_cast<value_type*>(::operator new(sizeof(value_type) * newCap));
+        m_capacity = newCap;
+        m_mask = newCap - 1;
+        m_growthLeft = MaxLoad(newCap) - m_size;
+
+        for (size_t i = 0; i < oldCap; ++i)
+        {
+            if (oldCtrl[i] < 0)
+                continue;
+
+            const size_t hash = Hash()(oldSlots[i].first);
+            const size_t dst = FindInsertSlot(hash);
+
+            SetCtrl(dst, H2(hash));
+            new (&m_slots[dst]) value_type(std::move(oldSlots[i]));
+            oldSlots[i].~value_type();
+        }
+
+        if (oldCap)
+        {
+            delete[] oldCtrl;
+            ::operator delete(oldSlots);
+        }
+    }
+
+    void DestroyAll()
+    {
+        if (std::is_trivially_destructible<value_type>::value)
+            return;
+
+        for (size_t i = 0; i < m_capacity; ++i)
+        {
+            if (m_ctrl[i] >= 0)
+                m_slots[i].~value_type();
+        }
+    }
+
+    void Deallocate()
+    {
+        if (m_capacity)
+        {
+            delete[] m_ctrl;
+            ::operator delete(m_slots);
+        }
+
+        m_ctrl = const_cast<int8_t*>(CoSyncFlatDetail::EmptyGroup());
+        m_slots = nullptr;
+        m_capacity = 0;
+        m_mask = 0;
+        m_size = 0;
+        m_growthLeft = 0;
+    }
+
+    void Swap(CoSyncFlatMap& o) noexcept
+    {
+        std::swap(m_ctrl, o.m_ctrl);
+        std::swap(m_slots, o.m_slots);
+        std::swap(m_capacity, o.m_capacity);
+        std::swap(m_mask, o.m_mask);
+        std::swap(m_size, o.m_size);
+        std::swap(m_growthLeft, o.m_growthLeft);
+    }
+
+private:
+    // Empty tables probe a shared all-EMPTY group (never written)
+    int8_t*     m_ctrl = const_cast<int8_t*>(CoSyncFlatDetail::EmptyGroup());
+    value_type* m_slots = nullptr;
+    size_t      m_capacity = 0;
+    size_t      m_mask = 0;
+    size_t      m_size = 0;
+    size_t      m_growthLeft = 0;
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncFlatSet
+// Key-only view over CoSyncFlatMap (iterates keys).
+// -----------------------------------------------------------------------------
+template <class K, class Hash = CoSyncFlatHash<K>>
+class CoSyncFlatSet
+{
+    struct Unit {};
+    using Map = CoSyncFlatMap<K, Unit, Hash>;
+
+public:
+    class const_iterator
+    {
+    public:
+        explicit const_iterator(typename Map::const_iterator it) : m_it(it) {}
+
+        const K& operator*() const { return m_it->first; }
+        const K* operator->() const { return &m_it->first; }
+
+        const_iterator& operator++()
+        {
+            ++m_it;
+            return *this;
+        }
+
+        bool operator==(const const_iterator& o) const { return m_it == o.m_it; }
+        bool operator!=(const const_iterator& o) const { return m_it != o.m_it; }
+
+    private:
+        friend class CoSyncFlatSet;
+        typename Map::const_iterator m_it;
+    };
+
+    using iterator = const_iterator;
+
+    size_t size() const { return m_map.size(); }
+    bool   empty() const { return m_map.empty(); }
+    void   reserve(size_t n) { m_map.reserve(n); }
+    void   clear() { m_map.clear(); }
+
+    const_iterator begin() const { return const_iterator(m_map.begin()); }
+    const_iterator end() const { return const_iterator(m_map.end()); }
+
+    const_iterator find(const K& key) const { return const_iterator(m_map.find(key)); }
+    size_t count(const K& key) const { return m_map.count(key); }
+
+    std::pair<const_iterator, bool> insert(const K& key)
+    {
+        auto r = m_map.try_emplace(key);
+        return std::make_pair(const_iterator(typename Map::const_iterator(r.first)), r.second);
+    }
+
+    size_t erase(const K& key) { return m_map.erase(key); }
+    void   erase(const_iterator it) { m_map.erase(*it); }
+
+private:
+    Map m_map;
+};
@@ -0,0 +1,79 @@
+#include "CoSyncFormCache.h"
+
+#include "ConsoleLogger.h"
+#include "GameForms.h"
+
+CoSyncFormCache g_CoSyncFormCache;
+
+// -----------------------------------------------------------------------------
+// Lookup
+// -----------------------------------------------------------------------------
+TESNPC* CoSyncFormCache::ResolveLocked(uint32_t baseFormID, bool& outHit)
+{
+    auto it = m_npcs.find(baseFormID);
+    if (it != m_npcs.end())
+    {
+        outHit = true;
+        return it->second;
+    }
+
+    outHit = false;
+
+    TESNPC* npc = nullptr;
+
+    TESForm* f = (baseFormID != 0) ? LookupFormByID(baseFormID) : nullptr;
+    if (f && f->formType == TESNPC::kTypeID)
+        npc = static_cast<TESNPC*>(f);
+
+    if (!npc)
+    {
+        ++m_stats.negatives;
+        LOG_WARN("[FormCache] 0x%08X is not a TESNPC (cached negative)", baseFormID);
+    }
+
+    m_npcs.emplace(baseFormID, npc);
+    return npc;
+}
+
+TESNPC* CoSyncFormCache::ResolveNPC(uint32_t baseFormID)
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+
+    bool hit = false;
+    TESNPC* npc = ResolveLocked(baseFormID, hit);
+
+    if (hit) ++m_stats.hits;
+    else     ++m_stats.misses;
+
+    return npc;
+}
+
+void CoSyncFormCache::Prefetch(uint32_t baseFormID)
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+
+    bool hit = false;
+    ResolveLocked(baseFormID, hit);
+
+    if (!hit)
+        ++m_stats.prefetches;
+}
+
+// -----------------------------------------------------------------------------
+// Invalidation
+// -----------------------------------------------------------------------------
+void CoSyncFormCache::Invalidate()
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+
+    if (!m_npcs.empty())
+        LOG_INFO("[FormCache] Invalidated %zu cached base forms", m_npcs.size());
+
+    m_npcs.clear();
+}
+
+CoSyncFormCache::Stats CoSyncFormCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lk(m_mutex);
+    return m_stats;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+#include "CoSyncFlatMap.h"
+
+class TESNPC;
+
+// -----------------------------------------------------------------------------
+// CoSyncFormCache
+//
+// Base form resolution cache for spawning (baseFormID -> validated TESNPC*).
+//
+//   - Positive AND negative results are cached (nullptr = not a TESNPC)
+//   - Prefetch() validates bases of queued CREATEs before their spawn slot
+//   - Invalidate() on game load / new game (form pointers do not survive)
+//
+// THREAD-SAFE (internal mutex); LookupFormByID itself runs on the caller.
+// -----------------------------------------------------------------------------
+class CoSyncFormCache
+{
+public:
+    struct Stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t negatives = 0;   // cached "not a TESNPC" results
+        uint64_t prefetches = 0;
+    };
+
+    // Cached lookup; resolves + caches on miss
+    TESNPC* ResolveNPC(uint32_t baseFormID);
+
+    // Resolve ahead of time (no-op if already cached)
+    void Prefetch(uint32_t baseFormID);
+
+    void Invalidate();
+
+    Stats GetStats() const;
+
+private:
+    TESNPC* ResolveLocked(uint32_t baseFormID, bool& outHit);
+
+private:
+    mutable std::mutex m_mutex;
+    CoSyncFlatMap<uint32_t, TESNPC*> m_npcs;
+    Stats m_stats;
+};
+
+extern CoSyncFormCache g_CoSyncFormCache;
@@ -0,0 +1,177 @@
+#include "CoSyncFrameGovernor.h"
+
+#include "ConsoleLogger.h"
+#include "CoSyncClock.h"
+#include "CoSyncMetrics.h"
+
+CoSyncFrameGovernor g_CoSyncFrameGovernor;
+
+namespace
+{
+    void CollectGovernorMetrics(CoSyncMetrics& metrics)
+    {
+        g_CoSyncFrameGovernor.PublishMetrics(metrics);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Config
+// -----------------------------------------------------------------------------
+void CoSyncFrameGovernor::SetBudgetMicros(double micros)
+{
+    m_budgetMicros.store((micros > 0.0) ? micros : 0.0, std::memory_order_relaxed);
+
+    if (IsEnabled())
+        LOG_INFO("[Governor] Network budget set to %.0fus/frame", BudgetMicros());
+    else
+        LOG_INFO("[Governor] Network budget disabled");
+}
+
+// -----------------------------------------------------------------------------
+// Frame bracketing
+// -----------------------------------------------------------------------------
+void CoSyncFrameGovernor::BeginFrame()
+{
+    if (!m_overrunHist)
+    {
+        m_overrunHist = &g_CoSyncMetrics.Histogram("governor.overrun_us");
+        m_overBudgetFrames = &g_CoSyncMetrics.Counter("governor.over_budget_frames");
+        m_updatesDeferred = &g_CoSyncMetrics.Counter("governor.updates_deferred");
+        m_updatesCoalesced = &g_CoSyncMetrics.Counter("governor.updates_coalesced");
+        m_spawnFramesDeferred = &g_CoSyncMetrics.Counter("governor.spawn_frames_deferred");
+        m_smoothingSkipped = &g_CoSyncMetrics.Counter("governor.smoothing_skipped");
+
+        g_CoSyncMetrics.AddCollector(&CollectGovernorMetrics);
+    }
+
+    m_frameStart = CoSyncClock::Ticks();
+    m_phaseStart = m_frameStart;
+    m_phase = static_cast<size_t>(CoSyncTickPhase::Count);
+    m_chargedMicros = 0.0;
+    m_inFrame = true;
+
+    for (double& us : m_stats.phaseMicros)
+        us = 0.0;
+}
+
+void CoSyncFrameGovernor::ClosePhase(int64_t nowTicks)
+{
+    if (m_phase < static_cast<size_t>(CoSyncTickPhase::Count))
+        m_stats.phaseMicros[m_phase] += CoSyncClock::TicksToMicros(nowTicks - m_phaseStart);
+
+    m_phaseStart = nowTicks;
+}
+
+void CoSyncFrameGovernor::BeginPhase(CoSyncTickPhase phase)
+{
+    if (!m_inFrame)
+        return;
+
+    ClosePhase(CoSyncClock::Ticks());
+    m_phase = static_cast<size_t>(phase);
+}
+
+void CoSyncFrameGovernor::EndFrame()
+{
+    if (!m_inFrame)
+        return;
+
+    ClosePhase(CoSyncClock::Ticks());
+
+    const double spent = SpentMicros();
+    const double budget = BudgetMicros();
+
+    m_phase = static_cast<size_t>(CoSyncTickPhase::Count);
+    m_inFrame = false;
+
+    ++m_stats.frames;
+    m_stats.lastFrameMicros = spent;
+    m_stats.lastOverrunMicros = 0.0;
+
+    if (budget <= 0.0 || spent <= budget)
+        return;
+
+    const double overrun = spent - budget;
+
+    ++m_stats.overBudgetFrames;
+    m_stats.lastOverrunMicros = overrun;
+    if (overrun > m_stats.maxOverrunMicros)
+        m_stats.maxOverrunMicros = overrun;
+
+    m_overBudgetFrames->Add();
+    m_overrunHist->Record(overrun);
+}
+
+// -----------------------------------------------------------------------------
+// Work-side queries
+// -----------------------------------------------------------------------------
+double CoSyncFrameGovernor::ElapsedMicros() const
+{
+    if (!m_inFrame)
+        return 0.0;
+
+    return CoSyncClock::MicrosSince(m_frameStart);
+}
+
+double CoSyncFrameGovernor::SpentMicros() const
+{
+    if (!m_inFrame)
+        return m_stats.lastFrameMicros;
+
+    return ElapsedMicros() + m_chargedMicros;
+}
+
+double CoSyncFrameGovernor::RemainingMicros() const
+{
+    return BudgetMicros() - SpentMicros();
+}
+
+bool CoSyncFrameGovernor::HasBudget() const
+{
+    const double budget = BudgetMicros();
+    return budget <= 0.0 || SpentMicros() < budget;
+}
+
+void CoSyncFrameGovernor::Charge(double micros)
+{
+    if (micros > 0.0)
+        m_chargedMicros += micros;
+}
+
+// -----------------------------------------------------------------------------
+// Deferral accounting
+// -----------------------------------------------------------------------------
+void CoSyncFrameGovernor::CountDeferredUpdate()
+{
+    if (m_updatesDeferred)
+        m_updatesDeferred->Add();
+}
+
+void CoSyncFrameGovernor::CountCoalescedUpdate()
+{
+    if (m_updatesCoalesced)
+        m_updatesCoalesced->Add();
+}
+
+void CoSyncFrameGovernor::CountDeferredSpawnFrame()
+{
+    if (m_spawnFramesDeferred)
+        m_spawnFramesDeferred->Add();
+}
+
+void CoSyncFrameGovernor::CountSkippedSmoothing(uint32_t n)
+{
+    if (m_smoothingSkipped && n > 0)
+        m_smoothingSkipped->Add(n);
+}
+
+// -----------------------------------------------------------------------------
+// Metrics collector (snapshot timer, GAME THREAD)
+// -----------------------------------------------------------------------------
+void CoSyncFrameGovernor::PublishMetrics(CoSyncMetrics& metrics)
+{
+    metrics.Gauge("governor.budget_us").Set(static_cast<int64_t>(BudgetMicros()));
+    metrics.Gauge("governor.frame_us").Set(static_cast<int64_t>(m_stats.lastFrameMicros));
+    metrics.Gauge("governor.overrun_max_us").Set(static_cast<int64_t>(m_stats.maxOverrunMicros));
+    metrics.Gauge("governor.carry.updates").Set(static_cast<int64_t>(m_carriedUpdates));
+}
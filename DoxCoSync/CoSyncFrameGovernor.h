@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "CoSyncFrameScheduler.h"
+
+class CoSyncCounter;
+class CoSyncLatencyHistogram;
+class CoSyncMetrics;
+
+// -----------------------------------------------------------------------------
+// CoSyncFrameGovernor
+//
+// Per-frame microsecond budget for CoSync's networking work.
+//
+// g_CoSyncFrameScheduler brackets every frame (BeginFrame / BeginPhase /
+// EndFrame), so time spent in each phase is measured here. Work the engine
+// runs outside the frame (spawn tasks) is added with Charge().
+//
+// Deferrable work asks HasBudget() and carries over when the frame is spent:
+//   - UPDATEs past the budget wait in a per-entity carry slot (newest wins)
+//   - far remote entities skip smoothing on most frames
+//   - spawns wait, but never more than kMaxSpawnDeferFrames in a row
+//
+// Never deferred: CREATE, DESTROY, teleport UPDATEs, first-spawn snaps.
+// A minimum number of UPDATEs is applied every frame (no starvation).
+//
+// Budget 0 disables the governor (everything runs every frame).
+// GAME THREAD ONLY, except SetBudgetMicros / BudgetMicros (any thread).
+// -----------------------------------------------------------------------------
+class CoSyncFrameGovernor
+{
+public:
+    static constexpr double   kDefaultBudgetMicros = 3000.0;
+    static constexpr uint32_t kMinUpdatesPerFrame = 16;
+    static constexpr uint32_t kMaxSpawnDeferFrames = 30;
+    static constexpr uint32_t kFarSmoothingStride = 4;     // far entities: 1 frame in N when throttled
+
+    struct Stats
+    {
+        uint64_t frames = 0;
+        uint64_t overBudgetFrames = 0;
+
+        double lastFrameMicros = 0.0;       // measured + charged
+        double lastOverrunMicros = 0.0;
+        double maxOverrunMicros = 0.0;
+
+        // Last frame, per scheduler phase (measured only)
+        double phaseMicros[static_cast<size_t>(CoSyncTickPhase::Count)] = {};
+    };
+
+    // ---------------------------------------------------------------------
+    // Config
+    // ---------------------------------------------------------------------
+    void   SetBudgetMicros(double micros);
+    double BudgetMicros() const { return m_budgetMicros.load(std::memory_order_relaxed); }
+    bool   IsEnabled() const { return BudgetMicros() > 0.0; }
+
+    // ---------------------------------------------------------------------
+    // Frame bracketing (called by CoSyncFrameScheduler)
+    // ---------------------------------------------------------------------
+    void BeginFrame();
+    void BeginPhase(CoSyncTickPhase phase);
+    void EndFrame();
+
+    // ---------------------------------------------------------------------
+    // Work-side queries
+    // ---------------------------------------------------------------------
+    double SpentMicros() const;
+    double RemainingMicros() const;
+    bool   HasBudget() const;
+
+    // Work timed elsewhere but paid for in this frame (e.g. spawn tasks)
+    void Charge(double micros);
+
+    // ---------------------------------------------------------------------
+    // Deferral accounting (counters; see PublishMetrics)
+    // ---------------------------------------------------------------------
+    void CountDeferredUpdate();
+    void CountCoalescedUpdate();
+    void CountDeferredSpawnFrame();
+    void CountSkippedSmoothing(uint32_t n);
+
+    void SetCarriedUpdates(size_t n) { m_carriedUpdates = n; }
+
+    const Stats& GetStats() const { return m_stats; }
+
+    // Metrics collector: budget, carry depth, last-frame overrun
+    void PublishMetrics(CoSyncMetrics& metrics);
+
+private:
+    double ElapsedMicros() const;
+    void   ClosePhase(int64_t nowTicks);
+
+private:
+    std::atomic<double> m_budgetMicros{ kDefaultBudgetMicros };
+
+    int64_t m_frameStart = 0;       // CoSyncClock::Ticks()
+    int64_t m_phaseStart = 0;
+    size_t m_phase = static_cast<size_t>(CoSyncTickPhase::Count);
+    bool   m_inFrame = false;
+    double m_chargedMicros = 0.0;
+
+    size_t m_carriedUpdates = 0;
+
+    Stats m_stats;
+
+    // Registered on the first frame
+    CoSyncLatencyHistogram* m_overrunHist = nullptr;
+    CoSyncCounter* m_overBudgetFrames = nullptr;
+    CoSyncCounter* m_updatesDeferred = nullptr;
+    CoSyncCounter* m_updatesCoalesced = nullptr;
+    CoSyncCounter* m_spawnFramesDeferred = nullptr;
+    CoSyncCounter* m_smoothingSkipped = nullptr;
+};
+
+extern CoSyncFrameGovernor g_CoSyncFrameGovernor;
@@ -0,0 +1,186 @@
+#include "CoSyncFrameScheduler.h"
+
+#include "ConsoleLogger.h"
+#include "CoSyncFrameGovernor.h"
+#include "CoSyncMetrics.h"
+#include "CoSyncTimerWheel.h"
+#include "CoSyncTrace.h"
+
+#include <cmath>
+#include <cstring>
+#include <string>
+
+CoSyncFrameScheduler g_CoSyncFrameScheduler;
+
+namespace
+{
+    const char* const kPhaseNames[] =
+    {
+        "receive",
+        "apply",
+        "spawn",
+        "simulate",
+        "sample_local",
+        "send",
+        "flush",
+    };
+
+    static_assert(sizeof(kPhaseNames) / sizeof(kPhaseNames[0]) ==
+        static_cast<size_t>(CoSyncTickPhase::Count), "phase name table out of date");
+}
+
+const char* CoSyncFrameScheduler::PhaseName(CoSyncTickPhase phase)
+{
+    const size_t i = static_cast<size_t>(phase);
+    return (i < static_cast<size_t>(CoSyncTickPhase::Count)) ? kPhaseNames[i] : "unknown";
+}
+
+// -----------------------------------------------------------------------------
+// Registration
+// -----------------------------------------------------------------------------
+void CoSyncFrameScheduler::AddTask(CoSyncTickPhase phase, const char* name, Task fn)
+{
+    AddFixedStep(phase, name, 0.0, fn, 1);
+}
+
+void CoSyncFrameScheduler::AddFixedStep(
+    CoSyncTickPhase phase,
+    const char* name,
+    double stepSec,
+    Task fn,
+    uint32_t maxStepsPerFrame)
+{
+    const size_t p = static_cast<size_t>(phase);
+    if (!fn || p >= static_cast<size_t>(CoSyncTickPhase::Count))
+        return;
+
+    Entry e;
+    e.name = name ? name : "task";
+    e.fn = fn;
+    e.stepSec = (stepSec > 0.0) ? stepSec : 0.0;
+    e.maxStepsPerFrame = (maxStepsPerFrame > 0) ? maxStepsPerFrame : 1;
+
+    m_phases[p].push_back(e);
+    ++m_taskCount;
+
+    LOG_DEBUG("[Scheduler] %s: %s%s", kPhaseNames[p], e.name, (e.stepSec > 0.0) ? " (fixed step)" : "");
+}
+
+bool CoSyncFrameScheduler::SetFixedStep(const char* name, double stepSec)
+{
+    if (!name || stepSec <= 0.0)
+        return false;
+
+    for (auto& phase : m_phases)
+    {
+        for (Entry& e : phase)
+        {
+            if (e.stepSec > 0.0 && std::strcmp(e.name, name) == 0)
+            {
+                e.stepSec = stepSec;
+                if (e.accumulator > stepSec)
+                    e.accumulator = stepSec;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+// Frame
+// -----------------------------------------------------------------------------
+void CoSyncFrameScheduler::RunPhase(size_t phase, double now)
+{
+    std::vector<Entry>& entries = m_phases[phase];
+    if (entries.empty())
+        return;
+
+    CoSyncScopedLatency timing(*m_phaseTimings[phase]);
+    g_CoSyncFrameGovernor.BeginPhase(static_cast<CoSyncTickPhase>(phase));
+
+    for (Entry& e : entries)
+    {
+        if (e.stepSec <= 0.0)
+        {
+            COSYNC_TRACE_SCOPE(e.name);
+            e.fn(now);
+            continue;
+        }
+
+        e.accumulator += m_frameDelta;
+
+        uint32_t steps = 0;
+        while (e.accumulator >= e.stepSec && steps < e.maxStepsPerFrame)
+        {
+            COSYNC_TRACE_SCOPE(e.name);
+            e.fn(now);
+
+            e.accumulator -= e.stepSec;
+            ++steps;
+        }
+
+        // Drop debt past the per-frame cap instead of bursting later
+        if (e.accumulator >= e.stepSec)
+            e.accumulator = std::fmod(e.accumulator, e.stepSec);
+    }
+}
+
+bool CoSyncFrameScheduler::RunFrame(double now)
+{
+    if (m_running)
+    {
+        if (!m_warnedReentry)
+        {
+            m_warnedReentry = true;
+            LOG_WARN("[Scheduler] RunFrame re-entered; nested call ignored");
+        }
+        return false;
+    }
+
+    if (m_frameIndex != 0 && now <= m_lastFrameTime)
+        return false;
+
+    if (!m_frameTiming)
+    {
+        m_frameTiming = &g_CoSyncMetrics.Histogram("phase.frame_us");
+        m_timerTiming = &g_CoSyncMetrics.Histogram("phase.timers_us");
+
+        for (size_t p = 0; p < static_cast<size_t>(CoSyncTickPhase::Count); ++p)
+        {
+            const std::string name = std::string("phase.") + kPhaseNames[p] + "_us";
+            m_phaseTimings[p] = &g_CoSyncMetrics.Histogram(name.c_str());
+        }
+    }
+
+    m_running = true;
+
+    m_frameDelta = (m_frameIndex != 0) ? (now - m_lastFrameTime) : 0.0;
+    if (m_frameDelta > kMaxFrameDeltaSec)
+        m_frameDelta = kMaxFrameDeltaSec;
+
+    m_lastFrameTime = now;
+    ++m_frameIndex;
+
+    {
+        COSYNC_TRACE_SCOPE("Scheduler.Frame");
+        CoSyncScopedLatency frameTiming(*m_frameTiming);
+        g_CoSyncFrameGovernor.BeginFrame();
+
+        // Deadlines (entity timeouts, pings, periodic logs) fire before Receive
+        {
+            COSYNC_TRACE_SCOPE("Timers.Advance");
+            CoSyncScopedLatency timerTiming(*m_timerTiming);
+            g_CoSyncTimers.Advance(now);
+        }
+
+        for (size_t p = 0; p < static_cast<size_t>(CoSyncTickPhase::Count); ++p)
+            RunPhase(p, now);
+
+        g_CoSyncFrameGovernor.EndFrame();
+    }
+
+    m_running = false;
+    return true;
+}
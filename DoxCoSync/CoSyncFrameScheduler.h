@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class CoSyncLatencyHistogram;
+
+// -----------------------------------------------------------------------------
+// Tick phases, in execution order
+// -----------------------------------------------------------------------------
+enum class CoSyncTickPhase : uint8_t
+{
+    Receive,        // pump GNS, drain transport inbox, session upkeep
+    Apply,          // CREATE / UPDATE / DESTROY into entity state
+    Spawn,          // budgeted spawn pump, actor pool prewarm
+    Simulate,       // remote smoothing / extrapolation
+    SampleLocal,    // read the local player's transform
+    Send,           // rate-limited outbound (fixed steps)
+    Flush,          // engine writes, snapshot publish, metrics
+
+    Count
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncFrameScheduler
+//
+// The single per-frame driver for CoSync. RunFrame() is called from ONE
+// place (the Present hook via CoSyncRuntime_TickGameThread) and runs:
+//
+//   timers -> Receive -> Apply -> Spawn -> Simulate -> SampleLocal -> Send -> Flush
+//
+// Within a phase, tasks run in registration order. A nested or repeated
+// call for the same frame is ignored, so nothing runs twice per frame.
+//
+// Fixed steps run on an accumulator of frame time (e.g. 20 Hz sends):
+//   - at most maxStepsPerFrame per frame; older debt is dropped rather
+//     than bursting after a hitch
+//   - large frame gaps (loads, alt-tab) are clamped to kMaxFrameDeltaSec
+//
+// Each phase is timed into the "phase.<name>_us" histogram and traced,
+// and the frame is bracketed for g_CoSyncFrameGovernor's budget.
+// GAME THREAD ONLY.
+// -----------------------------------------------------------------------------
+class CoSyncFrameScheduler
+{
+public:
+    using Task = void(*)(double now);
+
+    static constexpr double kMaxFrameDeltaSec = 0.25;
+
+    // ---------------------------------------------------------------------
+    // Registration (name must be a string literal; used for traces)
+    // ---------------------------------------------------------------------
+    void AddTask(CoSyncTickPhase phase, const char* name, Task fn);
+
+    void AddFixedStep(
+        CoSyncTickPhase phase,
+        const char* name,
+        double stepSec,
+        Task fn,
+        uint32_t maxStepsPerFrame = 1);
+
+    // Change a fixed step's period (e.g. send rate); false if unknown
+    bool SetFixedStep(const char* name, double stepSec);
+
+    bool HasTasks() const { return m_taskCount != 0; }
+
+    // ---------------------------------------------------------------------
+    // Driver
+    // ---------------------------------------------------------------------
+    // Returns false (and does nothing) when re-entered or called again
+    // for a frame that already ran
+    bool RunFrame(double now);
+
+    uint64_t FrameIndex() const { return m_frameIndex; }
+    double   FrameDelta() const { return m_frameDelta; }
+
+    static const char* PhaseName(CoSyncTickPhase phase);
+
+private:
+    struct Entry
+    {
+        const char* name = "";
+        Task fn = nullptr;
+
+        // Fixed step (stepSec > 0)
+        double   stepSec = 0.0;
+        double   accumulator = 0.0;
+        uint32_t maxStepsPerFrame = 1;
+    };
+
+    void RunPhase(size_t phase, double now);
+
+private:
+    std::vector<Entry> m_phases[static_cast<size_t>(CoSyncTickPhase::Count)];
+    size_t m_taskCount = 0;
+
+    CoSyncLatencyHistogram* m_phaseTimings[static_cast<size_t>(CoSyncTickPhase::Count)] = {};
+    CoSyncLatencyHistogram* m_timerTiming = nullptr;
+    CoSyncLatencyHistogram* m_frameTiming = nullptr;
+
+    uint64_t m_frameIndex = 0;
+    double   m_lastFrameTime = 0.0;
+    double   m_frameDelta = 0.0;
+    bool     m_running = false;
+    bool     m_warnedReentry = false;
+};
+
+extern CoSyncFrameScheduler g_CoSyncFrameScheduler;
@@ -1,4 +1,6 @@
 ﻿#include "CoSyncGameAPI.h"
+#include "CoSyncActorPool.h"
+#include "CoSyncFormCache.h"
 
 #include "ConsoleLogger.h"
 #include "Relocation.h"
@@ -25,7 +27,7 @@ static Actor* GetPlayerActor()
 // -----------------------------------------------------------------------------
 // SpawnRemoteActor — F4MP-aligned
 // -----------------------------------------------------------------------------
-Actor* CoSyncGameAPI::SpawnRemoteActor(TESNPC* npcBase)
+Actor* CoSyncGameAPI::SpawnRemoteActor(TESNPC* npcBase, bool initiallyDisabled)
 {
     if (!npcBase)
     {
@@ -57,7 +59,7 @@ Actor* CoSyncGameAPI::SpawnRemoteActor(TESNPC* npcBase)
         form,
         1,
         true,   // force persist
-        false,  // not disabled
+        initiallyDisabled,
         false
         );
 
@@ -132,3 +134,99 @@ void CoSyncGameAPI::EnableActorAI(Actor* actor)
     VMArray<VMVariable> args;
     CallFunctionNoWait(actor, BSFixedString("EnableAI"), args);
 }
+
+// -----------------------------------------------------------------------------
+// Visibility / lifetime (Papyrus no-wait)
+// -----------------------------------------------------------------------------
+static void CallWithFadeArg(Actor* actor, const char* fn)
+{
+    bool fade = false;
+
+    VMVariable arg;
+    arg.Set(&fade);
+
+    VMArray<VMVariable> args;
+    args.Push(&arg);
+
+    CallFunctionNoWait(actor, BSFixedString(fn), args);
+}
+
+void CoSyncGameAPI::EnableActor(Actor* actor)
+{
+    if (!actor)
+        return;
+
+    CallWithFadeArg(actor, "Enable");
+}
+
+void CoSyncGameAPI::DisableActor(Actor* actor)
+{
+    if (!actor)
+        return;
+
+    CallWithFadeArg(actor, "Disable");
+}
+
+void CoSyncGameAPI::DeleteActor(Actor* actor)
+{
+    if (!actor)
+        return;
+
+    VMArray<VMVariable> args;
+    CallFunctionNoWait(actor, BSFixedString("Delete"), args);
+}
+
+void CoSyncGameAPI::MoveActorToPlayer(Actor* actor)
+{
+    Actor* player = GetPlayerActor();
+    if (!actor || !player)
+        return;
+
+    NiPoint3 pos(player->pos.x, player->pos.y, player->pos.z);
+    NiPoint3 rot(player->rot.x, player->rot.y, player->rot.z);
+
+    UInt32 dummyHandle = 0;
+
+    MoveRefrToPosition(
+        actor,
+        &dummyHandle,
+        player->parentCell,
+        nullptr,
+        &pos,
+        &rot
+    );
+}
+
+// -----------------------------------------------------------------------------
+// Actor engine (CoSyncActorPool backend)
+// -----------------------------------------------------------------------------
+namespace
+{
+    class GameActorEngine final : public ICoSyncActorEngine
+    {
+    public:
+        Actor* CreateActor(uint32_t baseFormID, bool initiallyDisabled) override
+        {
+            TESNPC* npcBase = g_CoSyncFormCache.ResolveNPC(baseFormID);
+            if (!npcBase)
+            {
+                LOG_ERROR("[CoSyncGameAPI] CreateActor: 0x%08X is not TESNPC", baseFormID);
+                return nullptr;
+            }
+
+            return CoSyncGameAPI::SpawnRemoteActor(npcBase, initiallyDisabled);
+        }
+
+        void EnableActor(Actor* actor) override { CoSyncGameAPI::EnableActor(actor); }
+        void DisableActor(Actor* actor) override { CoSyncGameAPI::DisableActor(actor); }
+        void DeleteActor(Actor* actor) override { CoSyncGameAPI::DeleteActor(actor); }
+        void MoveActorToPlayer(Actor* actor) override { CoSyncGameAPI::MoveActorToPlayer(actor); }
+    };
+
+    GameActorEngine s_gameActorEngine;
+}
+
+ICoSyncActorEngine& CoSyncGameAPI::GetActorEngine()
+{
+    return s_gameActorEngine;
+}
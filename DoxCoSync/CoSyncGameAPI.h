@@ -4,6 +4,8 @@
 #include "GameReferences.h"   // Actor
 #include "GameForms.h"        // TESNPC
 
+class ICoSyncActorEngine;
+
 // -----------------------------------------------------------------------------
 // CoSyncGameAPI
 //
@@ -20,7 +22,20 @@ namespace CoSyncGameAPI
     // -----------------------------------------------------------------
     // Spawning (NPC base only)
     // -----------------------------------------------------------------
-    Actor* SpawnRemoteActor(TESNPC* npcBase);
+    Actor* SpawnRemoteActor(TESNPC* npcBase, bool initiallyDisabled = false);
+
+    // -----------------------------------------------------------------
+    // Visibility / lifetime (Papyrus no-wait)
+    // -----------------------------------------------------------------
+    void EnableActor(Actor* actor);
+    void DisableActor(Actor* actor);
+    void DeleteActor(Actor* actor);
+
+    // Move next to the local player (recycled pool actors)
+    void MoveActorToPlayer(Actor* actor);
+
+    // Game-backed engine for CoSyncActorPool
+    ICoSyncActorEngine& GetActorEngine();
 
     // -----------------------------------------------------------------
     // Transform
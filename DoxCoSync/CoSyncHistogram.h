@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// CoSyncHistogram
+//
+// Fixed HDR-style latency histogram (microseconds): log2 octaves, each split
+// into kSubBuckets linear sub-buckets, so every bucket is within 1/16 of
+// its value (6.25% relative precision) from 16 us to 2^32 us.
+//   bucket i < 16 : [i, i + 1) us
+//   above         : octave [2^e, 2^(e+1)) in 16 steps of 2^(e-4) us
+//
+// Record() is O(1) and allocation-free. Percentiles interpolate linearly
+// within the bucket holding the rank, clamped to the observed min / max.
+// NOT thread-safe; owners serialize access.
+// -----------------------------------------------------------------------------
+class CoSyncHistogram
+{
+public:
+    static constexpr size_t kSubBucketBits = 4;
+    static constexpr size_t kSubBuckets = size_t(1) << kSubBucketBits;          // per octave
+    static constexpr size_t kOctaves = 32 - kSubBucketBits;                     // 16 us .. 2^32 us
+    static constexpr size_t kBucketCount = kSubBuckets + kOctaves * kSubBuckets;
+
+    // Bucket for a (non-negative) sample; shared with CoSyncMetrics
+    static size_t BucketIndex(double micros)
+    {
+        if (!(micros > 0.0))
+            return 0;
+        if (micros >= 4294967296.0)
+            return kBucketCount - 1;
+
+        const uint64_t v = static_cast<uint64_t>(micros);
+        if (v < kSubBuckets)
+            return static_cast<size_t>(v);
+
+        // Top kSubBucketBits + 1 bits select the octave and sub-bucket
+        const uint32_t shift = FloorLog2(v) - static_cast<uint32_t>(kSubBucketBits);
+        return kSubBuckets * (1 + shift) + static_cast<size_t>((v >> shift) - kSubBuckets);
+    }
+
+    // Edges of bucket i in microseconds
+    static double BucketLowerMicros(size_t i)
+    {
+        if (i < kSubBuckets)
+            return double(i);
+
+        const size_t octave = i / kSubBuckets - 1;
+        const size_t sub = i % kSubBuckets;
+        return double(uint64_t(kSubBuckets + sub) << octave);
+    }
+
+    static double BucketUpperMicros(size_t i)
+    {
+        return BucketLowerMicros(i + 1);
+    }
+
+    // Rank-p value over a bucket array (p in [0, 1]); shared with CoSyncMetrics
+    static double PercentileOf(const uint64_t* buckets, uint64_t count, double p,
+                               double minMicros, double maxMicros)
+    {
+        if (count == 0)
+            return 0.0;
+
+        if (p <= 0.0) return minMicros;
+        if (p >= 1.0) return maxMicros;
+
+        const uint64_t target = static_cast<uint64_t>(p * double(count - 1)) + 1;
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBucketCount; ++i)
+        {
+            if (buckets[i] == 0 || seen + buckets[i] < target)
+            {
+                seen += buckets[i];
+                continue;
+            }
+
+            // Samples spread evenly across the bucket; the last one at its edge
+            const double lower = BucketLowerMicros(i);
+            const double upper = BucketUpperMicros(i);
+            const double frac = double(target - seen) / double(buckets[i]);
+
+            double v = lower + (upper - lower) * frac;
+            if (v > maxMicros) v = maxMicros;
+            if (v < minMicros) v = minMicros;
+            return v;
+        }
+
+        return maxMicros;
+    }
+
+    void Record(double micros)
+    {
+        if (micros < 0.0)
+            micros = 0.0;
+
+        ++m_buckets[BucketIndex(micros)];
+        ++m_count;
+        m_sum += micros;
+
+        if (m_count == 1 || micros < m_min) m_min = micros;
+        if (m_count == 1 || micros > m_max) m_max = micros;
+    }
+
+    void Reset()
+    {
+        for (size_t i = 0; i < kBucketCount; ++i)
+            m_buckets[i] = 0;
+
+        m_count = 0;
+        m_sum = 0.0;
+        m_min = 0.0;
+        m_max = 0.0;
+    }
+
+    uint64_t Count() const { return m_count; }
+    double   Min() const { return m_min; }
+    double   Max() const { return m_max; }
+    double   Mean() const { return m_count ? (m_sum / double(m_count)) : 0.0; }
+
+    uint64_t BucketCount(size_t i) const { return (i < kBucketCount) ? m_buckets[i] : 0; }
+
+    // p in [0, 1]
+    double Percentile(double p) const
+    {
+        return PercentileOf(m_buckets, m_count, p, m_min, m_max);
+    }
+
+private:
+    static uint32_t FloorLog2(uint64_t v)   // v != 0
+    {
+#if defined(_MSC_VER)
+        unsigned long idx = 0;
+        _BitScanReverse64(&idx, v);
+        return static_cast<uint32_t>(idx);
+#else
+        return 63u - static_cast<uint32_t>(__builtin_clzll(v));
+#endif
+    }
+
+private:
+    uint64_t m_buckets[kBucketCount] = {};
+    uint64_t m_count = 0;
+    double   m_sum = 0.0;
+    double   m_min = 0.0;
+    double   m_max = 0.0;
+};
@@ -0,0 +1,186 @@
+#include "CoSyncInterpolation.h"
+
+#include "IniReader.h"
+
+#include <cctype>
+#include <cmath>
+#include <string>
+
+namespace
+{
+    constexpr float kTwoPi = 6.28318530718f;
+    constexpr float kInvTwoPi = 0.159154943092f;
+    constexpr float kMinSpan = 0.000001f;
+
+    // Indexed by CoSyncEntityType value
+    constexpr size_t kTypeCount = 3;
+
+    CoSyncInterpolation::Modes s_modes[kTypeCount];
+    size_t s_historyCapacity[kTypeCount] = { 8, 8, 8 };
+
+    size_t TypeIndex(CoSyncEntityType type)
+    {
+        const size_t i = static_cast<size_t>(type);
+        return (i < kTypeCount) ? i : 0;
+    }
+
+    // INI key suffix per configurable type
+    struct TypeKey
+    {
+        CoSyncEntityType type;
+        const char* name;
+    };
+
+    const TypeKey kConfigTypes[] =
+    {
+        { CoSyncEntityType::Player, "Player" },
+        { CoSyncEntityType::NPC, "NPC" },
+    };
+
+    bool EqualsNoCase(const std::string& a, const char* b)
+    {
+        size_t i = 0;
+        for (; i < a.size() && b[i]; ++i)
+        {
+            if (std::tolower(static_cast<unsigned char>(a[i])) !=
+                std::tolower(static_cast<unsigned char>(b[i])))
+                return false;
+        }
+
+        return i == a.size() && !b[i];
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Mode table
+// -----------------------------------------------------------------------------
+CoSyncInterpolation::Modes CoSyncInterpolation::GetModes(CoSyncEntityType type)
+{
+    return s_modes[TypeIndex(type)];
+}
+
+void CoSyncInterpolation::SetModes(CoSyncEntityType type, const Modes& modes)
+{
+    s_modes[TypeIndex(type)] = modes;
+}
+
+size_t CoSyncInterpolation::GetHistoryCapacity(CoSyncEntityType type)
+{
+    return s_historyCapacity[TypeIndex(type)];
+}
+
+void CoSyncInterpolation::SetHistoryCapacity(CoSyncEntityType type, size_t capacity)
+{
+    s_historyCapacity[TypeIndex(type)] = (capacity >= 2) ? capacity : 2;
+}
+
+bool CoSyncInterpolation::LoadConfig(const char* iniPath)
+{
+    IniReader ini;
+    if (!iniPath || !ini.Load(iniPath))
+        return false;
+
+    for (const TypeKey& k : kConfigTypes)
+    {
+        Modes modes = GetModes(k.type);
+
+        const std::string pos = ini.GetString(std::string("InterpPosition_") + k.name);
+        if (EqualsNoCase(pos, "Linear"))
+            modes.position = PositionMode::Linear;
+        else if (EqualsNoCase(pos, "Hermite"))
+            modes.position = PositionMode::Hermite;
+
+        const std::string rot = ini.GetString(std::string("InterpRotation_") + k.name);
+        if (EqualsNoCase(rot, "Euler"))
+            modes.rotation = RotationMode::Euler;
+        else if (EqualsNoCase(rot, "ShortestArc"))
+            modes.rotation = RotationMode::ShortestArc;
+
+        SetModes(k.type, modes);
+
+        const int history = ini.GetInt(std::string("InterpHistory_") + k.name, 0);
+        if (history > 0)
+            SetHistoryCapacity(k.type, static_cast<size_t>(history));
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Position
+// -----------------------------------------------------------------------------
+NiPoint3 CoSyncInterpolation::LerpPosition(const NiPoint3& a, const NiPoint3& b, float t)
+{
+    const float s = 1.0f - t;
+
+    return NiPoint3{
+        s * a.x + t * b.x,
+        s * a.y + t * b.y,
+        s * a.z + t * b.z
+    };
+}
+
+NiPoint3 CoSyncInterpolation::HermitePosition(
+    const NiPoint3& p0, const NiPoint3& v0,
+    const NiPoint3& p1, const NiPoint3& v1,
+    float t, float spanSec)
+{
+    if (spanSec <= kMinSpan)
+        return LerpPosition(p0, p1, t);
+
+    const float t2 = t * t;
+    const float t3 = t2 * t;
+
+    // Hermite basis; tangents are velocity scaled to the sample span
+    const float h01 = 3.0f * t2 - 2.0f * t3;
+    const float h00 = 1.0f - h01;
+    const float h10 = (t3 - 2.0f * t2 + t) * spanSec;
+    const float h11 = (t3 - t2) * spanSec;
+
+    return NiPoint3{
+        h00 * p0.x + h10 * v0.x + h01 * p1.x + h11 * v1.x,
+        h00 * p0.y + h10 * v0.y + h01 * p1.y + h11 * v1.y,
+        h00 * p0.z + h10 * v0.z + h01 * p1.z + h11 * v1.z
+    };
+}
+
+NiPoint3 CoSyncInterpolation::InterpolatePosition(
+    const NiPoint3& p0, const NiPoint3& v0,
+    const NiPoint3& p1, const NiPoint3& v1,
+    float t, float spanSec, PositionMode mode)
+{
+    if (mode == PositionMode::Hermite)
+        return HermitePosition(p0, v0, p1, v1, t, spanSec);
+
+    return LerpPosition(p0, p1, t);
+}
+
+// -----------------------------------------------------------------------------
+// Rotation
+// -----------------------------------------------------------------------------
+float CoSyncInterpolation::LerpAngle(float a, float b, float t)
+{
+    // d -= 2PI * round(d / 2PI): delta wrapped into [-PI, PI]
+    float d = b - a;
+    d -= kTwoPi * std::nearbyint(d * kInvTwoPi);
+
+    return a + d * t;
+}
+
+NiPoint3 CoSyncInterpolation::LerpRotation(const NiPoint3& a, const NiPoint3& b, float t, RotationMode mode)
+{
+    if (mode == RotationMode::Euler)
+    {
+        return NiPoint3{
+            a.x + (b.x - a.x) * t,
+            a.y + (b.y - a.y) * t,
+            a.z + (b.z - a.z) * t
+        };
+    }
+
+    return NiPoint3{
+        LerpAngle(a.x, b.x, t),
+        LerpAngle(a.y, b.y, t),
+        LerpAngle(a.z, b.z, t)
+    };
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "NiTypes.h"   // NiPoint3
+#include "CoSyncEntityTypes.h"
+
+// -----------------------------------------------------------------------------
+// CoSyncInterpolation
+//
+// Transform interpolation between two network samples.
+//
+// Position:
+//   - Linear  : straight lerp (corners visible at low send rates)
+//   - Hermite : cubic Hermite using each sample's transmitted velocity
+//               (C1-continuous; 10 Hz looks like linear at 20 Hz)
+//
+// Rotation (Euler radians, per axis):
+//   - Euler       : component-wise lerp (legacy; spins the long way at +-PI)
+//   - ShortestArc : wrap each axis delta into [-PI, PI] before lerping
+//
+// Modes are chosen per CoSyncEntityType (code or DoxCoSync.ini; GAME THREAD
+// ONLY for the table). The kernels below are the scalar
+// reference; CoSyncBatchInterp's SSE2 path mirrors them and its scalar
+// fallback calls them directly.
+// -----------------------------------------------------------------------------
+namespace CoSyncInterpolation
+{
+    enum class PositionMode : uint8_t
+    {
+        Linear = 0,
+        Hermite = 1,
+    };
+
+    enum class RotationMode : uint8_t
+    {
+        Euler = 0,
+        ShortestArc = 1,
+    };
+
+    struct Modes
+    {
+        PositionMode position = PositionMode::Hermite;
+        RotationMode rotation = RotationMode::ShortestArc;
+    };
+
+    // ---------------------------------------------------------------------
+    // Per entity type selection (defaults: Hermite + ShortestArc)
+    // ---------------------------------------------------------------------
+    Modes GetModes(CoSyncEntityType type);
+    void  SetModes(CoSyncEntityType type, const Modes& modes);
+
+    // Transform history length per entity type (applied at spawn; rounded
+    // up to a power of two, max CoSyncPlayer::kMaxHistory). Default 8.
+    size_t GetHistoryCapacity(CoSyncEntityType type);
+    void   SetHistoryCapacity(CoSyncEntityType type, size_t capacity);
+
+    // Reads InterpPosition_<Type> (Linear/Hermite), InterpRotation_<Type>
+    // (Euler/ShortestArc) and InterpHistory_<Type> (samples), <Type> =
+    // Player or NPC. Missing file = no change.
+    bool LoadConfig(const char* iniPath);
+
+    // ---------------------------------------------------------------------
+    // Kernels (t in [0,1]; spanSec = time between the two samples)
+    // ---------------------------------------------------------------------
+    NiPoint3 LerpPosition(const NiPoint3& a, const NiPoint3& b, float t);
+
+    NiPoint3 HermitePosition(
+        const NiPoint3& p0, const NiPoint3& v0,
+        const NiPoint3& p1, const NiPoint3& v1,
+        float t, float spanSec);
+
+    float    LerpAngle(float a, float b, float t);   // shortest arc
+    NiPoint3 LerpRotation(const NiPoint3& a, const NiPoint3& b, float t, RotationMode mode);
+
+    // Dispatch on the given modes
+    NiPoint3 InterpolatePosition(
+        const NiPoint3& p0, const NiPoint3& v0,
+        const NiPoint3& p1, const NiPoint3& v1,
+        float t, float spanSec, PositionMode mode);
+}
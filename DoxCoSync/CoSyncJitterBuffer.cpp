@@ -0,0 +1,131 @@
+#include "CoSyncJitterBuffer.h"
+
+#include <algorithm>
+#include <cmath>
+
+// -----------------------------------------------------------------------------
+// Tuning
+// -----------------------------------------------------------------------------
+static constexpr double kInitialDelaySec = 0.10;    // until the window has data
+static constexpr double kMinDelaySec = 0.02;
+static constexpr double kMaxDelaySec = 0.35;
+static constexpr double kMarginSec = 0.01;           // ~1 frame
+static constexpr double kMaxIntervalSec = 0.10;      // sparse (dead-reckoned) streams extrapolate instead
+static constexpr double kIntervalAlpha = 0.1;
+static constexpr double kJitterPercentile = 0.95;
+
+static constexpr double kMaxTimeScaleDelta = 0.05;   // +-5% playout rate
+static constexpr double kCatchUpGain = 1.0;          // scale delta per second of error
+static constexpr double kSnapErrorSec = 0.25;        // beyond this, re-anchor
+
+// -----------------------------------------------------------------------------
+// Samples
+// -----------------------------------------------------------------------------
+void CoSyncJitterBuffer::Reset()
+{
+    m_head = 0;
+    m_count = 0;
+    m_minTransit = 0.0;
+    m_lastHostTime = 0.0;
+    m_sendIntervalEma = 0.0;
+    m_renderTime = 0.0;
+    m_lastNow = 0.0;
+    m_clockStarted = false;
+    m_starved = false;
+
+    const uint32_t underflows = m_stats.underflows;
+    m_stats = Stats{};
+    m_stats.delaySec = kInitialDelaySec;
+    m_stats.underflows = underflows;   // lifetime counter
+}
+
+void CoSyncJitterBuffer::OnSample(double hostTime, double localRecvTime)
+{
+    const double transit = localRecvTime - hostTime;
+
+    if (m_count == 0)
+        m_minTransit = transit;
+
+    if (m_lastHostTime > 0.0 && hostTime > m_lastHostTime)
+    {
+        const double gap = std::min(hostTime - m_lastHostTime, kMaxIntervalSec);
+        m_sendIntervalEma = (m_sendIntervalEma > 0.0)
+            ? m_sendIntervalEma + (gap - m_sendIntervalEma) * kIntervalAlpha
+            : gap;
+    }
+    m_lastHostTime = hostTime;
+
+    // Stored relative to the running minimum (keeps float precision)
+    m_transit[m_head] = static_cast<float>(transit - m_minTransit);
+    m_head = (m_head + 1) % kWindow;
+    if (m_count < kWindow)
+        ++m_count;
+
+    ++m_stats.samples;
+    Recompute();
+}
+
+void CoSyncJitterBuffer::Recompute()
+{
+    float sorted[kWindow];
+    std::copy(m_transit, m_transit + m_count, sorted);
+
+    // Re-base on the window minimum (drift / route changes age out)
+    const float minRel = *std::min_element(sorted, sorted + m_count);
+    if (minRel != 0.0f)
+    {
+        for (size_t i = 0; i < kWindow; ++i)
+            m_transit[i] -= minRel;
+        for (size_t i = 0; i < m_count; ++i)
+            sorted[i] -= minRel;
+        m_minTransit += minRel;
+    }
+
+    const size_t k = static_cast<size_t>(kJitterPercentile * double(m_count - 1));
+    std::nth_element(sorted, sorted + k, sorted + m_count);
+
+    m_stats.jitterSec = sorted[k];
+
+    const double delay = m_stats.jitterSec + m_sendIntervalEma + kMarginSec;
+    m_stats.delaySec = std::max(kMinDelaySec, std::min(kMaxDelaySec, delay));
+}
+
+// -----------------------------------------------------------------------------
+// Playout clock
+// -----------------------------------------------------------------------------
+double CoSyncJitterBuffer::RenderTime(double now)
+{
+    if (m_count == 0)
+        return 0.0;
+
+    const double target = (now - m_minTransit) - m_stats.delaySec;
+
+    if (!m_clockStarted || std::fabs(target - m_renderTime) > kSnapErrorSec)
+    {
+        m_renderTime = target;
+        m_lastNow = now;
+        m_clockStarted = true;
+        m_stats.timeScale = 1.0;
+        return m_renderTime;
+    }
+
+    const double dt = now - m_lastNow;
+    m_lastNow = now;
+
+    double delta = (target - m_renderTime) * kCatchUpGain;
+    delta = std::max(-kMaxTimeScaleDelta, std::min(kMaxTimeScaleDelta, delta));
+
+    m_stats.timeScale = 1.0 + delta;
+    if (dt > 0.0)
+        m_renderTime += dt * m_stats.timeScale;
+
+    return m_renderTime;
+}
+
+void CoSyncJitterBuffer::NoteStarved(bool starved)
+{
+    if (starved && !m_starved)
+        ++m_stats.underflows;
+
+    m_starved = starved;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// -----------------------------------------------------------------------------
+// CoSyncJitterBuffer
+//
+// Adaptive playout clock for one remote entity's snapshot stream.
+//
+//   transit  = localRecvTime - hostTime   (clock offset + one-way latency)
+//   jitter   = transit - min(transit)     over the last kWindow samples
+//   delay    = p95(jitter) + send interval (EMA, capped) + margin
+//
+// RenderTime() returns a host-time playout clock that advances with the
+// local clock and is nudged (max +-5% time scale) toward
+// (estimated host now - delay), so delay changes never jump the picture.
+//
+// LAN peers settle near one send interval; jittery peers grow until the
+// buffer stops underflowing. GAME THREAD ONLY.
+// -----------------------------------------------------------------------------
+class CoSyncJitterBuffer
+{
+public:
+    static constexpr size_t kWindow = 64;
+
+    struct Stats
+    {
+        double   delaySec = 0.0;       // current target playout delay
+        double   jitterSec = 0.0;      // p95 transit deviation
+        double   timeScale = 1.0;      // last playout clock rate
+        uint32_t underflows = 0;       // times playout ran past the newest sample
+        uint32_t samples = 0;
+    };
+
+    void Reset();
+
+    // Feed every accepted sample (host timestamp + local receive time)
+    void OnSample(double hostTime, double localRecvTime);
+
+    // Host-time instant to render at `now` (local clock)
+    double RenderTime(double now);
+
+    // Report whether playout is currently past the newest sample
+    void NoteStarved(bool starved);
+
+    const Stats& GetStats() const { return m_stats; }
+    bool HasSamples() const { return m_count > 0; }
+
+private:
+    void Recompute();
+
+private:
+    float  m_transit[kWindow] = {};
+    size_t m_head = 0;
+    size_t m_count = 0;
+
+    double m_minTransit = 0.0;
+    double m_lastHostTime = 0.0;
+    double m_sendIntervalEma = 0.0;
+
+    double m_renderTime = 0.0;
+    double m_lastNow = 0.0;
+    bool   m_clockStarted = false;
+    bool   m_starved = false;
+
+    Stats m_stats;
+};
@@ -0,0 +1,689 @@
+#include "CoSyncLog.h"
+
+#include "ConsoleLogger.h"
+#include "CoSyncFileSink.h"
+#include "CoSyncFileSystem.h"
+#include "IniReader.h"
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <strings.h>
+#define _stricmp strcasecmp
+#endif
+
+namespace
+{
+    using namespace CoSyncLog;
+
+    // 256 x 512 B = 128 KB per logging thread
+    constexpr uint32_t kRingSlots = 256;
+    constexpr uint32_t kRingMask = kRingSlots - 1;
+    static_assert((kRingSlots & kRingMask) == 0, "ring size must be a power of two");
+
+    constexpr auto kIdleSleep = std::chrono::milliseconds(2);
+
+    // -------------------------------------------------------------------------
+    // Per-thread SPSC ring (producer = owning thread, consumer = drain)
+    // -------------------------------------------------------------------------
+    struct ThreadRing
+    {
+        // Producer and consumer indices on separate cache lines
+        std::atomic<uint32_t> tail{ 0 };      // producer
+        char pad0[64 - sizeof(std::atomic<uint32_t>)];
+        std::atomic<uint32_t> head{ 0 };      // consumer
+        char pad1[64 - sizeof(std::atomic<uint32_t>)];
+        std::atomic<uint64_t> dropped{ 0 };
+
+        Record slots[kRingSlots];
+    };
+
+    thread_local ThreadRing* t_ring = nullptr;
+
+    std::atomic<uint64_t> s_seq{ 0 };
+    std::atomic<uint64_t> s_droppedTotal{ 0 };
+
+    std::once_flag s_startOnce;
+
+    int64_t NowTicks()
+    {
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+
+    double TicksToSeconds(int64_t ticks)
+    {
+        using Period = std::chrono::steady_clock::period;
+        return double(ticks) * double(Period::num) / double(Period::den);
+    }
+
+    // -------------------------------------------------------------------------
+    // Default sinks
+    // -------------------------------------------------------------------------
+    class ConsoleSink : public ISink
+    {
+    public:
+        void Write(Level level, double, const char* line, size_t len) override
+        {
+#ifdef _WIN32
+            EnsureConsole();
+
+            HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+            SetConsoleTextAttribute(hConsole, (int)ColorFor(level));
+#else
+            (void)level;
+#endif
+
+            fwrite(line, 1, len, stdout);
+            fputc('\n', stdout);
+
+#ifdef _WIN32
+            SetConsoleTextAttribute(hConsole, 7);
+#endif
+            m_dirty = true;
+        }
+
+        void EndBatch() override
+        {
+            if (m_dirty)
+                Flush();
+        }
+
+        void Flush() override
+        {
+            fflush(stdout);
+            m_dirty = false;
+        }
+
+    private:
+        static LogColor ColorFor(Level level)
+        {
+            switch (level)
+            {
+            case Level::Debug: return LogColor::CYAN;
+            case Level::Warn:  return LogColor::YELLOW;
+            case Level::Error: return LogColor::RED;
+            default:           return LogColor::GREEN;
+            }
+        }
+
+        bool m_dirty = false;
+    };
+
+    // -------------------------------------------------------------------------
+    // Logger state: created once, never destroyed, so the detached thread
+    // can't outlive its mutexes during static teardown
+    // -------------------------------------------------------------------------
+    struct LoggerState
+    {
+        // Registration only (once per thread); never taken on the write path
+        std::mutex registryMutex;
+        std::vector<ThreadRing*> rings;
+
+        // Serializes the consumer side: logger thread vs Flush()
+        std::mutex drainMutex;
+        std::vector<ISink*> sinks;
+
+        ConsoleSink    consoleSink;
+        CoSyncFileSink fileSink{
+            CoSyncFileSystem::JoinPath(CoSyncFileSystem::GetLogDirectory(), "F4MP.log") };
+
+        int64_t originTicks = 0;
+    };
+
+    LoggerState* s_state = nullptr;
+
+    // -------------------------------------------------------------------------
+    // Consumer
+    // -------------------------------------------------------------------------
+    void EmitLine(Level level, int64_t ticks, const char* line, size_t len)
+    {
+        const double timeSec = TicksToSeconds(ticks - s_state->originTicks);
+
+        for (ISink* sink : s_state->sinks)
+            sink->Write(level, timeSec, line, len);
+    }
+
+    // Caller holds drainMutex. Returns records written.
+    size_t DrainLocked()
+    {
+        std::vector<ThreadRing*> rings;
+        {
+            std::lock_guard<std::mutex> lk(s_state->registryMutex);
+            rings = s_state->rings;
+        }
+
+        char line[2048];
+        size_t written = 0;
+
+        for (;;)
+        {
+            // Oldest pending record across all threads
+            ThreadRing* best = nullptr;
+            uint64_t bestSeq = 0;
+
+            for (ThreadRing* ring : rings)
+            {
+                const uint32_t head = ring->head.load(std::memory_order_relaxed);
+                if (head == ring->tail.load(std::memory_order_acquire))
+                    continue;
+
+                const uint64_t seq = ring->slots[head & kRingMask].seq;
+                if (!best || seq < bestSeq)
+                {
+                    best = ring;
+                    bestSeq = seq;
+                }
+            }
+
+            if (!best)
+                break;
+
+            const uint32_t head = best->head.load(std::memory_order_relaxed);
+            const Record& r = best->slots[head & kRingMask];
+
+            const size_t len = Format(r, line, sizeof(line));
+            EmitLine(r.level, r.ticks, line, len);
+
+            best->head.store(head + 1, std::memory_order_release);
+            ++written;
+        }
+
+        for (ThreadRing* ring : rings)
+        {
+            const uint64_t dropped = ring->dropped.exchange(0, std::memory_order_relaxed);
+            if (dropped == 0)
+                continue;
+
+            const int len = snprintf(line, sizeof(line),
+                "[WARN] [Log] Dropped %llu records (thread ring full)",
+                (unsigned long long)dropped);
+            EmitLine(Level::Warn, NowTicks(), line, (len > 0) ? size_t(len) : 0);
+            ++written;
+        }
+
+        for (ISink* sink : s_state->sinks)
+            sink->EndBatch();
+
+        return written;
+    }
+
+    void LoggerThreadMain()
+    {
+        for (;;)
+        {
+            size_t written;
+            {
+                std::lock_guard<std::mutex> lk(s_state->drainMutex);
+                written = DrainLocked();
+            }
+
+            if (!written)
+                std::this_thread::sleep_for(kIdleSleep);
+        }
+    }
+
+    void StartLogger()
+    {
+        LoggerState* state = new LoggerState();
+        state->originTicks = NowTicks();
+        state->sinks.push_back(&state->consoleSink);
+        state->sinks.push_back(&state->fileSink);
+
+        s_state = state;
+
+        // Detached: never joined from a static destructor (loader lock)
+        std::thread(&LoggerThreadMain).detach();
+    }
+
+    ThreadRing* RegisterThread()
+    {
+        std::call_once(s_startOnce, &StartLogger);
+
+        // Leaked on purpose: a thread that exits leaves its tail to be drained
+        ThreadRing* ring = new ThreadRing();
+
+        {
+            std::lock_guard<std::mutex> lk(s_state->registryMutex);
+            s_state->rings.push_back(ring);
+        }
+
+        t_ring = ring;
+        return ring;
+    }
+
+    // -------------------------------------------------------------------------
+    // Formatting
+    // -------------------------------------------------------------------------
+    void Append(char* out, size_t cap, size_t& pos, const char* s, size_t len)
+    {
+        if (pos + 1 >= cap)
+            return;
+
+        if (len > cap - 1 - pos)
+            len = cap - 1 - pos;
+
+        memcpy(out + pos, s, len);
+        pos += len;
+    }
+
+    void AppendFormatted(size_t cap, size_t& pos, int len)
+    {
+        if (len <= 0 || pos + 1 >= cap)
+            return;
+
+        pos += (size_t(len) < cap - 1 - pos) ? size_t(len) : cap - 1 - pos;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Levels / channels
+// -----------------------------------------------------------------------------
+std::atomic<uint8_t> CoSyncLog::Detail::g_runtimeLevels[kChannelCount] = {};
+
+namespace
+{
+    const char* const kChannelNames[kChannelCount] =
+    {
+        "General",
+        "Transport",
+        "Net",
+        "PlayerMgr",
+        "Spawn",
+        "GNS",
+        "Papyrus",
+    };
+
+    const char* const kLevelNames[] = { "Debug", "Info", "Warn", "Error", "Off" };
+
+    bool ParseLevel(const std::string& text, Level& out)
+    {
+        if (text.empty())
+            return false;
+
+        if (text.size() == 1 && text[0] >= '0' && text[0] <= '4')
+        {
+            out = static_cast<Level>(text[0] - '0');
+            return true;
+        }
+
+        for (uint8_t i = 0; i <= static_cast<uint8_t>(Level::Off); ++i)
+        {
+            if (_stricmp(text.c_str(), kLevelNames[i]) == 0)
+            {
+                out = static_cast<Level>(i);
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
+
+void CoSyncLog::SetLevel(Channel channel, Level level)
+{
+    if (channel >= Channel::Count)
+        return;
+
+    Detail::g_runtimeLevels[static_cast<size_t>(channel)].store(
+        static_cast<uint8_t>(level), std::memory_order_relaxed);
+}
+
+CoSyncLog::Level CoSyncLog::GetLevel(Channel channel)
+{
+    if (channel >= Channel::Count)
+        return Level::Off;
+
+    return static_cast<Level>(
+        Detail::g_runtimeLevels[static_cast<size_t>(channel)].load(std::memory_order_relaxed));
+}
+
+const char* CoSyncLog::ChannelName(Channel channel)
+{
+    return (channel < Channel::Count) ? kChannelNames[static_cast<size_t>(channel)] : "?";
+}
+
+const char* CoSyncLog::LevelName(Level level)
+{
+    return (level <= Level::Off) ? kLevelNames[static_cast<size_t>(level)] : "?";
+}
+
+bool CoSyncLog::LoadLevels(const char* iniPath)
+{
+    IniReader ini;
+    if (!iniPath || !ini.Load(iniPath))
+        return false;
+
+    Level level;
+    if (ParseLevel(ini.GetString("LogLevel"), level))
+    {
+        for (size_t i = 0; i < kChannelCount; ++i)
+            SetLevel(static_cast<Channel>(i), level);
+    }
+
+    for (size_t i = 0; i < kChannelCount; ++i)
+    {
+        const std::string key = std::string("LogLevel_") + kChannelNames[i];
+        if (ParseLevel(ini.GetString(key), level))
+            SetLevel(static_cast<Channel>(i), level);
+    }
+
+    return true;
+}
+
+bool CoSyncLog::RateLimit(std::atomic<int64_t>& nextTicks, double intervalSec)
+{
+    using Period = std::chrono::steady_clock::period;
+
+    const int64_t now = NowTicks();
+    int64_t due = nextTicks.load(std::memory_order_relaxed);
+
+    if (now < due)
+        return false;
+
+    const int64_t interval = static_cast<int64_t>(intervalSec * double(Period::den) / double(Period::num));
+
+    // One winner per interval when several threads hit the same site
+    return nextTicks.compare_exchange_strong(due, now + interval, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+// Public
+// -----------------------------------------------------------------------------
+void CoSyncLog::AddSink(ISink* sink)
+{
+    if (!sink)
+        return;
+
+    std::call_once(s_startOnce, &StartLogger);
+
+    std::lock_guard<std::mutex> lk(s_state->drainMutex);
+    s_state->sinks.push_back(sink);
+}
+
+void CoSyncLog::Flush()
+{
+    if (!s_state)
+        return;
+
+    std::lock_guard<std::mutex> lk(s_state->drainMutex);
+    DrainLocked();
+
+    for (ISink* sink : s_state->sinks)
+        sink->Flush();
+}
+
+void CoSyncLog::FlushForCrash()
+{
+    LoggerState* state = s_state;
+    if (!state)
+        return;
+
+    if (state->drainMutex.try_lock())
+    {
+        DrainLocked();
+
+        for (ISink* sink : state->sinks)
+            sink->Flush();
+
+        state->drainMutex.unlock();
+        return;
+    }
+
+    // Crashed mid-drain: at least persist what the file buffer holds
+    state->fileSink.TryFlush();
+}
+
+namespace
+{
+#ifdef _WIN32
+    LPTOP_LEVEL_EXCEPTION_FILTER s_prevExceptionFilter = nullptr;
+
+    LONG WINAPI CrashFlushFilter(EXCEPTION_POINTERS* info)
+    {
+        CoSyncLog::FlushForCrash();
+
+        return s_prevExceptionFilter ? s_prevExceptionFilter(info) : EXCEPTION_CONTINUE_SEARCH;
+    }
+#else
+    void CrashFlushSignal(int sig)
+    {
+        CoSyncLog::FlushForCrash();
+
+        std::signal(sig, SIG_DFL);
+        std::raise(sig);
+    }
+#endif
+
+    std::once_flag s_crashFlushOnce;
+}
+
+void CoSyncLog::InstallCrashFlush()
+{
+    std::call_once(s_crashFlushOnce, []()
+    {
+#ifdef _WIN32
+        s_prevExceptionFilter = SetUnhandledExceptionFilter(&CrashFlushFilter);
+#else
+        std::signal(SIGSEGV, &CrashFlushSignal);
+        std::signal(SIGABRT, &CrashFlushSignal);
+        std::signal(SIGFPE, &CrashFlushSignal);
+        std::signal(SIGILL, &CrashFlushSignal);
+#endif
+    });
+}
+
+uint64_t CoSyncLog::DroppedCount()
+{
+    return s_droppedTotal.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+// Producer (caller thread)
+// -----------------------------------------------------------------------------
+CoSyncLog::Record* CoSyncLog::Detail::Begin(Level level, const char* fmt)
+{
+    ThreadRing* ring = t_ring ? t_ring : RegisterThread();
+
+    const uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+    const uint32_t head = ring->head.load(std::memory_order_acquire);
+
+    if (tail - head >= kRingSlots)
+    {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        s_droppedTotal.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Record& r = ring->slots[tail & kRingMask];
+    r.seq = s_seq.fetch_add(1, std::memory_order_relaxed);
+    r.ticks = NowTicks();
+    r.fmt = fmt;
+    r.level = level;
+    r.argCount = 0;
+    r.stringBytes = 0;
+
+    return &r;
+}
+
+void CoSyncLog::Detail::Commit()
+{
+    ThreadRing* ring = t_ring;
+    ring->tail.store(ring->tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+// Format
+//
+// printf subset over packed args. Each conversion is re-issued through
+// snprintf with a normalized length modifier, so widths/precision/flags
+// behave exactly like the old synchronous path.
+// -----------------------------------------------------------------------------
+size_t CoSyncLog::Format(const Record& r, char* out, size_t cap)
+{
+    if (!out || cap == 0)
+        return 0;
+
+    size_t pos = 0;
+    uint8_t argIndex = 0;
+
+    const char* p = r.fmt ? r.fmt : "";
+
+    while (*p)
+    {
+        if (*p != '%')
+        {
+            const char* lit = p;
+            while (*p && *p != '%')
+                ++p;
+
+            Append(out, cap, pos, lit, size_t(p - lit));
+            continue;
+        }
+
+        if (p[1] == '%')
+        {
+            Append(out, cap, pos, "%", 1);
+            p += 2;
+            continue;
+        }
+
+        // %[flags][width][.precision][length]conv
+        char spec[32];
+        size_t n = 0;
+        spec[n++] = *p++;
+
+        while (*p && strchr("-+ #0", *p) && n < 16)
+            spec[n++] = *p++;
+        while (*p >= '0' && *p <= '9' && n < 20)
+            spec[n++] = *p++;
+        if (*p == '.')
+        {
+            spec[n++] = *p++;
+            while (*p >= '0' && *p <= '9' && n < 26)
+                spec[n++] = *p++;
+        }
+
+        // Length modifier: only "wide" (64-bit) vs not matters after packing
+        bool wide = false;
+        while (*p && strchr("hlLzjtqI", *p))
+        {
+            if (*p == 'z' || *p == 'j' || *p == 't' || *p == 'q' || *p == 'L' ||
+                (p[0] == 'l' && p[1] == 'l') || (p[0] == 'I' && p[1] == '6' && p[2] == '4'))
+            {
+                wide = true;
+            }
+
+            if (p[0] == 'I' && p[1] == '6' && p[2] == '4')
+                p += 3;
+            else if (p[0] == 'I' && p[1] == '3' && p[2] == '2')
+                p += 3;
+            else
+                ++p;
+        }
+
+        const char conv = *p;
+        if (!conv)
+            break;
+        ++p;
+
+        if (argIndex >= r.argCount)
+        {
+            Append(out, cap, pos, "<?>", 3);
+            continue;
+        }
+
+        const uint8_t type = r.types[argIndex];
+        const uint64_t value = r.values[argIndex];
+        ++argIndex;
+
+        double dv = 0.0;
+        if (type == kArgDouble)
+            memcpy(&dv, &value, sizeof(dv));
+
+        char* dst = out + pos;
+        const size_t room = cap - pos;
+
+        switch (conv)
+        {
+        case 'd':
+        case 'i':
+        {
+            spec[n++] = 'l'; spec[n++] = 'l'; spec[n++] = conv; spec[n] = '\0';
+
+            long long v = (type == kArgDouble) ? (long long)dv : (long long)value;
+            if (!wide)
+                v = (long long)(int32_t)v;
+
+            AppendFormatted(cap, pos, snprintf(dst, room, spec, v));
+            break;
+        }
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+        {
+            spec[n++] = 'l'; spec[n++] = 'l'; spec[n++] = conv; spec[n] = '\0';
+
+            unsigned long long v = (type == kArgDouble) ? (unsigned long long)dv : value;
+            if (!wide)
+                v = (uint32_t)v;
+
+            AppendFormatted(cap, pos, snprintf(dst, room, spec, v));
+            break;
+        }
+        case 'c':
+        {
+            spec[n++] = 'c'; spec[n] = '\0';
+            AppendFormatted(cap, pos, snprintf(dst, room, spec, (int)(char)value));
+            break;
+        }
+        case 'f': case 'F':
+        case 'e': case 'E':
+        case 'g': case 'G':
+        case 'a': case 'A':
+        {
+            spec[n++] = conv; spec[n] = '\0';
+
+            if (type == kArgInt)
+                dv = double((int64_t)value);
+            else if (type == kArgUInt)
+                dv = double(value);
+
+            AppendFormatted(cap, pos, snprintf(dst, room, spec, dv));
+            break;
+        }
+        case 's':
+        {
+            spec[n++] = 's'; spec[n] = '\0';
+
+            const char* s = "(bad-arg)";
+            if (type == kArgString)
+                s = (value < Record::kStringCapacity) ? r.strings + value : "(truncated)";
+
+            AppendFormatted(cap, pos, snprintf(dst, room, spec, s));
+            break;
+        }
+        case 'p':
+        {
+            spec[n++] = 'p'; spec[n] = '\0';
+            AppendFormatted(cap, pos, snprintf(dst, room, spec, (void*)(uintptr_t)value));
+            break;
+        }
+        default:
+            // Unsupported conversion (%n, %*d, ...): emit it verbatim
+            Append(out, cap, pos, spec, n);
+            Append(out, cap, pos, &conv, 1);
+            break;
+        }
+    }
+
+    out[pos] = '\0';
+    return pos;
+}
@@ -0,0 +1,303 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+// -----------------------------------------------------------------------------
+// Compile-time minimum levels (0=Debug 1=Info 2=Warn 3=Error 4=Off)
+// Calls below the minimum are compiled out, args included. Override per
+// build, globally or per channel.
+// -----------------------------------------------------------------------------
+#ifndef COSYNC_LOG_MIN_LEVEL
+#define COSYNC_LOG_MIN_LEVEL 0
+#endif
+
+#ifndef COSYNC_LOG_MIN_LEVEL_GENERAL
+#define COSYNC_LOG_MIN_LEVEL_GENERAL COSYNC_LOG_MIN_LEVEL
+#endif
+#ifndef COSYNC_LOG_MIN_LEVEL_TRANSPORT
+#define COSYNC_LOG_MIN_LEVEL_TRANSPORT COSYNC_LOG_MIN_LEVEL
+#endif
+#ifndef COSYNC_LOG_MIN_LEVEL_NET
+#define COSYNC_LOG_MIN_LEVEL_NET COSYNC_LOG_MIN_LEVEL
+#endif
+#ifndef COSYNC_LOG_MIN_LEVEL_PLAYERMGR
+#define COSYNC_LOG_MIN_LEVEL_PLAYERMGR COSYNC_LOG_MIN_LEVEL
+#endif
+#ifndef COSYNC_LOG_MIN_LEVEL_SPAWN
+#define COSYNC_LOG_MIN_LEVEL_SPAWN COSYNC_LOG_MIN_LEVEL
+#endif
+#ifndef COSYNC_LOG_MIN_LEVEL_GNS
+#define COSYNC_LOG_MIN_LEVEL_GNS COSYNC_LOG_MIN_LEVEL
+#endif
+#ifndef COSYNC_LOG_MIN_LEVEL_PAPYRUS
+#define COSYNC_LOG_MIN_LEVEL_PAPYRUS COSYNC_LOG_MIN_LEVEL
+#endif
+
+// -----------------------------------------------------------------------------
+// CoSyncLog
+//
+// Asynchronous logger behind the LOG_* macros (ConsoleLogger.h).
+//
+// Caller side (any thread, lock-free):
+//   - Writes ONE fixed-size Record into its own SPSC ring: level, format
+//     pointer (string literal), packed args; %s strings copied inline
+//   - No formatting, no console/file I/O, no locks
+//   - Ring full -> record dropped and counted (callers never block)
+//
+// Background thread:
+//   - Drains all rings in sequence order, formats, and hands lines to the
+//     registered sinks (console + file by default)
+//
+// RULES:
+//   - fmt MUST be a string literal (the pointer is stored, not copied)
+//   - Args: integers, enums, floating point, pointers, C strings
+//   - Flush() drains synchronously (crash paths / before exit)
+// -----------------------------------------------------------------------------
+namespace CoSyncLog
+{
+    enum class Level : uint8_t
+    {
+        Debug = 0,
+        Info = 1,
+        Warn = 2,
+        Error = 3,
+        Off = 4,      // thresholds only
+    };
+
+    // -------------------------------------------------------------------------
+    // Channels (one per subsystem; a .cpp picks its channel with
+    // #define COSYNC_LOG_CHANNEL <Name> before its first #include)
+    // -------------------------------------------------------------------------
+    enum class Channel : uint8_t
+    {
+        General = 0,
+        Transport,
+        Net,
+        PlayerMgr,
+        Spawn,
+        GNS,
+        Papyrus,
+
+        Count
+    };
+
+    static constexpr size_t kChannelCount = static_cast<size_t>(Channel::Count);
+
+    static constexpr uint8_t kCompiledMinLevel[kChannelCount] =
+    {
+        COSYNC_LOG_MIN_LEVEL_GENERAL,
+        COSYNC_LOG_MIN_LEVEL_TRANSPORT,
+        COSYNC_LOG_MIN_LEVEL_NET,
+        COSYNC_LOG_MIN_LEVEL_PLAYERMGR,
+        COSYNC_LOG_MIN_LEVEL_SPAWN,
+        COSYNC_LOG_MIN_LEVEL_GNS,
+        COSYNC_LOG_MIN_LEVEL_PAPYRUS,
+    };
+
+    constexpr bool CompiledIn(Channel channel, Level level)
+    {
+        return static_cast<uint8_t>(level) >= kCompiledMinLevel[static_cast<size_t>(channel)];
+    }
+
+    namespace Detail
+    {
+        extern std::atomic<uint8_t> g_runtimeLevels[kChannelCount];
+    }
+
+    // Runtime filter: one load + compare
+    inline bool IsEnabled(Channel channel, Level level)
+    {
+        return static_cast<uint8_t>(level) >=
+            Detail::g_runtimeLevels[static_cast<size_t>(channel)].load(std::memory_order_relaxed);
+    }
+
+    void  SetLevel(Channel channel, Level level);
+    Level GetLevel(Channel channel);
+
+    const char* ChannelName(Channel channel);
+    const char* LevelName(Level level);
+
+    // Reads LogLevel (all channels) and LogLevel_<Channel> overrides.
+    // Values: Debug/Info/Warn/Error/Off or 0-4. Missing file = no change.
+    bool LoadLevels(const char* iniPath);
+
+    // Per-call-site limiter for LOG_*_EVERY_SEC; true at most once per interval
+    bool RateLimit(std::atomic<int64_t>& nextTicks, double intervalSec);
+
+    // -------------------------------------------------------------------------
+    // Sinks (called on the logger thread, or inside Flush())
+    // -------------------------------------------------------------------------
+    class ISink
+    {
+    public:
+        virtual ~ISink() {}
+        // timeSec = seconds since the logger started (caller's timestamp)
+        virtual void Write(Level level, double timeSec, const char* line, size_t len) = 0;
+
+        // After every drain pass (also idle ones); buffered sinks may defer
+        virtual void EndBatch() { Flush(); }
+
+        // Everything written so far must reach its destination
+        virtual void Flush() {}
+    };
+
+    // Sink must outlive the logger (static / leaked)
+    void AddSink(ISink* sink);
+
+    void Flush();
+
+    // Drains + flushes from an unhandled-exception / fatal-signal handler.
+    // Non-blocking: skipped if the faulting thread holds the logger lock.
+    void FlushForCrash();
+
+    // Registers FlushForCrash (SetUnhandledExceptionFilter, chained; POSIX
+    // fatal signals elsewhere). Idempotent.
+    void InstallCrashFlush();
+
+    // Records dropped because a thread's ring was full
+    uint64_t DroppedCount();
+
+    // -------------------------------------------------------------------------
+    // Record layout (512 bytes)
+    // -------------------------------------------------------------------------
+    enum ArgType : uint8_t
+    {
+        kArgInt,
+        kArgUInt,
+        kArgDouble,
+        kArgPtr,
+        kArgString,   // value = offset into Record::strings
+    };
+
+    static constexpr size_t kMaxArgs = 16;
+    static constexpr size_t kRecordBytes = 512;
+
+    struct RecordHeader
+    {
+        uint64_t    seq;
+        int64_t     ticks;
+        const char* fmt;
+        Level       level;
+        uint8_t     argCount;
+        uint16_t    stringBytes;
+        uint8_t     types[kMaxArgs];
+        uint64_t    values[kMaxArgs];
+    };
+
+    struct Record : RecordHeader
+    {
+        static constexpr size_t kStringCapacity = kRecordBytes - sizeof(RecordHeader);
+        char strings[kStringCapacity];
+    };
+
+    static_assert(sizeof(Record) == kRecordBytes, "CoSyncLog::Record must stay one fixed slot");
+
+    // -------------------------------------------------------------------------
+    // Internals used by Write()
+    // -------------------------------------------------------------------------
+    namespace Detail
+    {
+        Record* Begin(Level level, const char* fmt);   // nullptr if ring full
+        void    Commit();
+
+        inline void PutValue(Record& r, ArgType type, uint64_t value)
+        {
+            if (r.argCount >= kMaxArgs)
+                return;
+
+            r.types[r.argCount] = type;
+            r.values[r.argCount] = value;
+            ++r.argCount;
+        }
+
+        // Strings that don't fit are clipped visibly ("..." suffix)
+        inline void PutString(Record& r, const char* s)
+        {
+            static constexpr char   kClipMark[] = "...";
+            static constexpr size_t kClipLen = sizeof(kClipMark) - 1;
+
+            if (!s)
+                s = "(null)";
+
+            const size_t room = Record::kStringCapacity - r.stringBytes;
+            size_t len = std::strlen(s);
+            const bool clipped = (len + 1 > room);
+            if (clipped)
+                len = room ? room - 1 : 0;
+
+            const uint64_t offset = r.stringBytes;
+            if (room)
+            {
+                std::memcpy(r.strings + offset, s, len);
+                if (clipped && len >= kClipLen)
+                    std::memcpy(r.strings + offset + len - kClipLen, kClipMark, kClipLen);
+
+                r.strings[offset + len] = '\0';
+                r.stringBytes = static_cast<uint16_t>(r.stringBytes + len + 1);
+            }
+
+            PutValue(r, kArgString, room ? offset : Record::kStringCapacity);
+        }
+
+        template <class T>
+        inline typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type
+            Pack(Record& r, T v)
+        {
+            if (std::is_signed<T>::value || std::is_enum<T>::value)
+                PutValue(r, kArgInt, static_cast<uint64_t>(static_cast<int64_t>(v)));
+            else
+                PutValue(r, kArgUInt, static_cast<uint64_t>(v));
+        }
+
+        template <class T>
+        inline typename std::enable_if<std::is_floating_point<T>::value>::type
+            Pack(Record& r, T v)
+        {
+            const double d = static_cast<double>(v);
+            uint64_t bits;
+            std::memcpy(&bits, &d, sizeof(bits));
+            PutValue(r, kArgDouble, bits);
+        }
+
+        inline void Pack(Record& r, const char* s) { PutString(r, s); }
+        inline void Pack(Record& r, char* s) { PutString(r, s); }
+
+        template <class T>
+        inline void Pack(Record& r, T* p)
+        {
+            PutValue(r, kArgPtr, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p)));
+        }
+
+        inline void Pack(Record& r, std::nullptr_t) { PutValue(r, kArgPtr, 0); }
+
+        inline void PackAll(Record&) {}
+
+        template <class T, class... Rest>
+        inline void PackAll(Record& r, T first, Rest... rest)
+        {
+            Pack(r, first);
+            PackAll(r, rest...);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Entry point (LOG_* macros)
+    // -------------------------------------------------------------------------
+    template <class... Args>
+    inline void Write(Level level, const char* fmt, Args... args)
+    {
+        Record* r = Detail::Begin(level, fmt);
+        if (!r)
+            return;
+
+        Detail::PackAll(*r, args...);
+        Detail::Commit();
+    }
+
+    // Formats a record into out (logger thread / Flush; exposed for sinks)
+    size_t Format(const Record& r, char* out, size_t cap);
+}
@@ -0,0 +1,405 @@
+#include "CoSyncMetrics.h"
+
+#include "ConsoleLogger.h"
+#include "CoSyncFileSystem.h"
+
+#include <cstring>
+
+CoSyncMetrics g_CoSyncMetrics;
+
+namespace
+{
+    // Percentile over window bucket deltas (interpolated within the bucket,
+    // clamped to the window max; the window keeps no min)
+    double WindowPercentile(const uint64_t* buckets, uint64_t count, double p, double maxMicros)
+    {
+        return CoSyncHistogram::PercentileOf(buckets, count, p, 0.0, maxMicros);
+    }
+
+    const char* KindName(CoSyncMetrics::Kind kind)
+    {
+        switch (kind)
+        {
+        case CoSyncMetrics::Kind::Gauge:     return "gauge";
+        case CoSyncMetrics::Kind::Histogram: return "histogram";
+        default:                             return "counter";
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Registration
+// -----------------------------------------------------------------------------
+size_t CoSyncMetrics::Register(const char* name, Kind kind)
+{
+    auto it = m_byName.find(name);
+    if (it != m_byName.end())
+    {
+        if (m_slots[it->second].kind != kind)
+            LOG_WARN("[Metrics] '%s' registered again with a different kind", name);
+
+        return it->second;
+    }
+
+    Slot slot;
+    slot.name = name;
+    slot.kind = kind;
+
+    switch (kind)
+    {
+    case Kind::Counter:
+        m_counters.emplace_back();
+        slot.index = m_counters.size() - 1;
+        break;
+    case Kind::Gauge:
+        m_gauges.emplace_back();
+        slot.index = m_gauges.size() - 1;
+        break;
+    case Kind::Histogram:
+        m_histograms.emplace_back();
+        slot.index = m_histograms.size() - 1;
+        break;
+    }
+
+    m_slots.push_back(slot);
+    m_byName.emplace(slot.name, m_slots.size() - 1);
+    return m_slots.size() - 1;
+}
+
+CoSyncCounter& CoSyncMetrics::Counter(const char* name)
+{
+    std::lock_guard<std::mutex> lk(m_registryMutex);
+    const Slot& s = m_slots[Register(name, Kind::Counter)];
+
+    // Kind mismatch: hand back a scratch metric rather than the wrong type
+    if (s.kind != Kind::Counter)
+    {
+        m_counters.emplace_back();
+        return m_counters.back();
+    }
+
+    return m_counters[s.index];
+}
+
+CoSyncGauge& CoSyncMetrics::Gauge(const char* name)
+{
+    std::lock_guard<std::mutex> lk(m_registryMutex);
+    const Slot& s = m_slots[Register(name, Kind::Gauge)];
+
+    if (s.kind != Kind::Gauge)
+    {
+        m_gauges.emplace_back();
+        return m_gauges.back();
+    }
+
+    return m_gauges[s.index];
+}
+
+CoSyncLatencyHistogram& CoSyncMetrics::Histogram(const char* name)
+{
+    std::lock_guard<std::mutex> lk(m_registryMutex);
+    const Slot& s = m_slots[Register(name, Kind::Histogram)];
+
+    if (s.kind != Kind::Histogram)
+    {
+        m_histograms.emplace_back();
+        return m_histograms.back();
+    }
+
+    return m_histograms[s.index];
+}
+
+void CoSyncMetrics::AddCollector(Collector fn)
+{
+    if (!fn)
+        return;
+
+    std::lock_guard<std::mutex> lk(m_registryMutex);
+
+    for (Collector c : m_collectors)
+    {
+        if (c == fn)
+            return;
+    }
+
+    m_collectors.push_back(fn);
+}
+
+void CoSyncMetrics::AddListener(Listener fn)
+{
+    if (!fn)
+        return;
+
+    std::lock_guard<std::mutex> lk(m_registryMutex);
+
+    for (Listener l : m_listeners)
+    {
+        if (l == fn)
+            return;
+    }
+
+    m_listeners.push_back(fn);
+}
+
+// -----------------------------------------------------------------------------
+// Snapshot
+// -----------------------------------------------------------------------------
+void CoSyncMetrics::SnapshotThunk(void* ctx, uint64_t, double now)
+{
+    static_cast<CoSyncMetrics*>(ctx)->Snapshot(now);
+}
+
+void CoSyncMetrics::Tick()
+{
+    if (!g_CoSyncTimers.IsPending(m_timer))
+    {
+        m_timer = g_CoSyncTimers.ScheduleIn(
+            kSnapshotIntervalSec, &SnapshotThunk, this, 0, kSnapshotIntervalSec);
+    }
+}
+
+void CoSyncMetrics::Snapshot(double now)
+{
+    std::vector<Collector> collectors;
+    std::vector<Listener> listeners;
+    {
+        std::lock_guard<std::mutex> lk(m_registryMutex);
+        collectors = m_collectors;
+        listeners = m_listeners;
+    }
+
+    // Collectors register/set gauges; must run without the registry lock
+    for (Collector c : collectors)
+        c(*this);
+
+    const double window = (m_lastSnapshotTime > 0.0 && now > m_lastSnapshotTime)
+        ? (now - m_lastSnapshotTime)
+        : kSnapshotIntervalSec;
+    m_lastSnapshotTime = now;
+
+    std::vector<Sample> samples;
+
+    {
+        std::lock_guard<std::mutex> lk(m_registryMutex);
+        samples.reserve(m_slots.size());
+
+        for (Slot& slot : m_slots)
+        {
+            Sample s;
+            s.name = slot.name;
+            s.kind = slot.kind;
+
+            switch (slot.kind)
+            {
+            case Kind::Counter:
+            {
+                const uint64_t total = m_counters[slot.index].Value();
+                s.value = double(total);
+                s.ratePerSec = double(total - slot.prevTotal) / window;
+                slot.prevTotal = total;
+                break;
+            }
+            case Kind::Gauge:
+                s.value = double(m_gauges[slot.index].Value());
+                break;
+
+            case Kind::Histogram:
+            {
+                CoSyncLatencyHistogram& h = m_histograms[slot.index];
+
+                uint64_t delta[CoSyncLatencyHistogram::kBucketCount];
+                uint64_t count = 0;
+
+                for (size_t i = 0; i < CoSyncLatencyHistogram::kBucketCount; ++i)
+                {
+                    const uint64_t b = h.Bucket(i);
+                    delta[i] = b - slot.prevBuckets[i];
+                    slot.prevBuckets[i] = b;
+                    count += delta[i];
+                }
+
+                const uint64_t sum = h.SumNanos();
+                const uint64_t sumDelta = sum - slot.prevSumNanos;
+                slot.prevSumNanos = sum;
+
+                s.count = count;
+                s.ratePerSec = double(count) / window;
+                s.max = double(h.TakeWindowMaxNanos()) / 1000.0;
+                s.value = count ? (double(sumDelta) / 1000.0) / double(count) : 0.0;
+                s.p50 = WindowPercentile(delta, count, 0.50, s.max);
+                s.p90 = WindowPercentile(delta, count, 0.90, s.max);
+                s.p99 = WindowPercentile(delta, count, 0.99, s.max);
+                break;
+            }
+            }
+
+            samples.push_back(std::move(s));
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(m_snapshotMutex);
+        m_snapshot.swap(samples);
+
+        if (m_dumpIntervalSec > 0.0 && now - m_lastDumpTime >= m_dumpIntervalSec)
+        {
+            m_lastDumpTime = now;
+            DumpLocked(now);
+        }
+    }
+
+    // m_snapshot is only replaced here (game thread); safe to read unlocked
+    for (Listener l : listeners)
+        l(m_snapshot, now);
+}
+
+std::vector<CoSyncMetrics::Sample> CoSyncMetrics::GetSnapshot() const
+{
+    std::lock_guard<std::mutex> lk(m_snapshotMutex);
+    return m_snapshot;
+}
+
+bool CoSyncMetrics::Query(const char* name, Sample& out) const
+{
+    if (!name)
+        return false;
+
+    std::lock_guard<std::mutex> lk(m_snapshotMutex);
+
+    for (const Sample& s : m_snapshot)
+    {
+        if (s.name == name)
+        {
+            out = s;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// One JSON object per line: {"t":..,"metrics":{"name":{...},...}}
+void CoSyncMetrics::DumpLocked(double now)
+{
+    if (!m_dumpFile)
+    {
+        if (m_dumpFailed)
+            return;
+
+        const std::string path = CoSyncFileSystem::JoinPath(
+            CoSyncFileSystem::GetLogDirectory(), "CoSyncMetrics.jsonl");
+
+        m_dumpFile = CoSyncFileSystem::OpenFile(path, "wb");
+        if (!m_dumpFile)
+        {
+            m_dumpFailed = true;
+            LOG_WARN("[Metrics] Cannot open %s; dump disabled", path.c_str());
+            return;
+        }
+    }
+
+    FILE* f = m_dumpFile;
+    fprintf(f, "{\"t\":%.3f,\"metrics\":{", now);
+
+    for (size_t i = 0; i < m_snapshot.size(); ++i)
+    {
+        const Sample& s = m_snapshot[i];
+        fprintf(f, "%s\"%s\":{\"kind\":\"%s\"", i ? "," : "", s.name.c_str(), KindName(s.kind));
+
+        switch (s.kind)
+        {
+        case Kind::Counter:
+            fprintf(f, ",\"total\":%.0f,\"rate\":%.3f}", s.value, s.ratePerSec);
+            break;
+        case Kind::Gauge:
+            fprintf(f, ",\"value\":%.6g}", s.value);
+            break;
+        case Kind::Histogram:
+            fprintf(f, ",\"count\":%llu,\"mean\":%.2f,\"p50\":%.2f,\"p90\":%.2f,\"p99\":%.2f,\"max\":%.2f}",
+                (unsigned long long)s.count, s.value, s.p50, s.p90, s.p99, s.max);
+            break;
+        }
+    }
+
+    fputs("}}\n", f);
+    fflush(f);
+}
+
+// -----------------------------------------------------------------------------
+// Wire counters
+// -----------------------------------------------------------------------------
+namespace
+{
+    enum WireType : size_t
+    {
+        kWireHello,
+        kWireCreate,
+        kWireUpdate,
+        kWireDestroy,
+        kWireTimeSync,
+        kWireTimePong,
+        kWireOther,
+
+        kWireTypeCount
+    };
+
+    const char* const kWireNames[kWireTypeCount] = { "HELLO", "EC", "EU", "ED", "TS", "TP", "other" };
+
+    WireType Classify(const std::string& msg)
+    {
+        if (msg.size() >= 3 && msg[2] == '|')
+        {
+            if (msg[0] == 'E')
+            {
+                if (msg[1] == 'U') return kWireUpdate;
+                if (msg[1] == 'C') return kWireCreate;
+                if (msg[1] == 'D') return kWireDestroy;
+            }
+            else if (msg[0] == 'T')
+            {
+                if (msg[1] == 'S') return kWireTimeSync;
+                if (msg[1] == 'P') return kWireTimePong;
+            }
+        }
+
+        if (msg.compare(0, 6, "HELLO|") == 0)
+            return kWireHello;
+
+        return kWireOther;
+    }
+
+    struct WireCounters
+    {
+        CoSyncCounter* msgs[kWireTypeCount];
+        CoSyncCounter* bytes[kWireTypeCount];
+
+        explicit WireCounters(const char* dir)
+        {
+            for (size_t i = 0; i < kWireTypeCount; ++i)
+            {
+                const std::string base = std::string("net.") + dir + "." + kWireNames[i];
+                msgs[i] = &g_CoSyncMetrics.Counter((base + ".msgs").c_str());
+                bytes[i] = &g_CoSyncMetrics.Counter((base + ".bytes").c_str());
+            }
+        }
+
+        void Count(const std::string& msg)
+        {
+            const WireType t = Classify(msg);
+            msgs[t]->Add();
+            bytes[t]->Add(msg.size());
+        }
+    };
+}
+
+void CoSyncWireMetrics::CountReceived(const std::string& msg)
+{
+    static WireCounters s_rx("rx");
+    s_rx.Count(msg);
+}
+
+void CoSyncWireMetrics::CountSent(const std::string& msg)
+{
+    static WireCounters s_tx("tx");
+    s_tx.Count(msg);
+}
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CoSyncClock.h"
+#include "CoSyncHistogram.h"
+#include "CoSyncTimerWheel.h"
+
+// -----------------------------------------------------------------------------
+// Metric primitives (lock-free; any thread)
+// -----------------------------------------------------------------------------
+class CoSyncCounter
+{
+public:
+    void     Add(uint64_t n = 1) { m_value.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t Value() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> m_value{ 0 };
+};
+
+class CoSyncGauge
+{
+public:
+    void    Set(int64_t v) { m_value.store(v, std::memory_order_relaxed); }
+    void    Add(int64_t n) { m_value.fetch_add(n, std::memory_order_relaxed); }
+    int64_t Value() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> m_value{ 0 };
+};
+
+// Same HDR bucket layout as CoSyncHistogram, with atomic buckets
+class CoSyncLatencyHistogram
+{
+public:
+    static constexpr size_t kBucketCount = CoSyncHistogram::kBucketCount;
+
+    void Record(double micros)
+    {
+        if (micros < 0.0)
+            micros = 0.0;
+
+        m_buckets[CoSyncHistogram::BucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+        m_sumNanos.fetch_add(static_cast<uint64_t>(micros * 1000.0), std::memory_order_relaxed);
+
+        // Max of the current snapshot window
+        const uint64_t ns = static_cast<uint64_t>(micros * 1000.0);
+        uint64_t prev = m_windowMaxNanos.load(std::memory_order_relaxed);
+        while (ns > prev &&
+            !m_windowMaxNanos.compare_exchange_weak(prev, ns, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    uint64_t Bucket(size_t i) const { return m_buckets[i].load(std::memory_order_relaxed); }
+    uint64_t SumNanos() const { return m_sumNanos.load(std::memory_order_relaxed); }
+
+    // Snapshot only
+    uint64_t TakeWindowMaxNanos() { return m_windowMaxNanos.exchange(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> m_buckets[kBucketCount] = {};
+    std::atomic<uint64_t> m_sumNanos{ 0 };
+    std::atomic<uint64_t> m_windowMaxNanos{ 0 };
+};
+
+// Records the enclosing scope's duration (us) into a latency histogram
+class CoSyncScopedLatency
+{
+public:
+    explicit CoSyncScopedLatency(CoSyncLatencyHistogram& histogram)
+        : m_histogram(histogram)
+        , m_start(CoSyncClock::Ticks())
+    {
+    }
+
+    ~CoSyncScopedLatency()
+    {
+        m_histogram.Record(CoSyncClock::MicrosSince(m_start));
+    }
+
+    CoSyncScopedLatency(const CoSyncScopedLatency&) = delete;
+    CoSyncScopedLatency& operator=(const CoSyncScopedLatency&) = delete;
+
+private:
+    CoSyncLatencyHistogram& m_histogram;
+    int64_t m_start;
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncMetrics
+//
+// Named registry of counters, gauges and latency histograms.
+//
+// Usage (hot path keeps the reference; registration locks once):
+//   static CoSyncCounter& s_drops = g_CoSyncMetrics.Counter("transport.inbox.dropped");
+//   s_drops.Add();
+//
+// Snapshot (GAME THREAD, once per second on the timer wheel):
+//   - counters  : total + rate over the last window
+//   - gauges    : current value
+//   - histograms: window count / mean / p50 / p90 / p99 / max (us)
+//   - collectors run first so existing Stats structs publish as gauges
+//   - every kDumpIntervalSec one JSON line is appended to
+//     <log dir>\CoSyncMetrics.jsonl
+//
+// GetSnapshot()/Query() copy the last snapshot; safe from any thread.
+// -----------------------------------------------------------------------------
+class CoSyncMetrics
+{
+public:
+    enum class Kind : uint8_t
+    {
+        Counter,
+        Gauge,
+        Histogram,
+    };
+
+    struct Sample
+    {
+        std::string name;
+        Kind        kind = Kind::Counter;
+
+        double   value = 0.0;       // counter total / gauge value / window mean (us)
+        double   ratePerSec = 0.0;  // counters and histograms (samples/s)
+
+        uint64_t count = 0;         // histogram samples in window
+        double   p50 = 0.0;
+        double   p90 = 0.0;
+        double   p99 = 0.0;
+        double   max = 0.0;
+    };
+
+    using Collector = void(*)(CoSyncMetrics& metrics);
+    using Listener = void(*)(const std::vector<Sample>& samples, double now);
+
+    static constexpr double kSnapshotIntervalSec = 1.0;
+    static constexpr double kDumpIntervalSec = 10.0;
+
+    // ---------------------------------------------------------------------
+    // Registration (returned references stay valid for the process)
+    // ---------------------------------------------------------------------
+    CoSyncCounter&          Counter(const char* name);
+    CoSyncGauge&            Gauge(const char* name);
+    CoSyncLatencyHistogram& Histogram(const char* name);
+
+    // Called at the start of every snapshot (game thread)
+    void AddCollector(Collector fn);
+
+    // Called with the fresh samples at the end of every snapshot (game thread)
+    void AddListener(Listener fn);
+
+    // ---------------------------------------------------------------------
+    // Snapshot
+    // ---------------------------------------------------------------------
+    // Arms the 1 Hz snapshot timer; call every frame (cheap)
+    void Tick();
+
+    void Snapshot(double now);
+
+    std::vector<Sample> GetSnapshot() const;
+    bool Query(const char* name, Sample& out) const;
+
+    // 0 disables the file dump
+    void SetDumpInterval(double seconds) { m_dumpIntervalSec = seconds; }
+
+private:
+    struct Slot
+    {
+        std::string name;
+        Kind        kind;
+        size_t      index;
+
+        uint64_t prevTotal = 0;
+        uint64_t prevBuckets[CoSyncLatencyHistogram::kBucketCount] = {};
+        uint64_t prevSumNanos = 0;
+    };
+
+    size_t Register(const char* name, Kind kind);
+    void   DumpLocked(double now);
+
+    static void SnapshotThunk(void* ctx, uint64_t, double now);
+
+private:
+    mutable std::mutex m_registryMutex;
+    std::unordered_map<std::string, size_t> m_byName;
+    std::vector<Slot> m_slots;
+
+    std::deque<CoSyncCounter>          m_counters;
+    std::deque<CoSyncGauge>            m_gauges;
+    std::deque<CoSyncLatencyHistogram> m_histograms;
+
+    std::vector<Collector> m_collectors;
+    std::vector<Listener>  m_listeners;
+
+    mutable std::mutex  m_snapshotMutex;
+    std::vector<Sample> m_snapshot;
+
+    CoSyncTimerHandle m_timer{};
+    double m_lastSnapshotTime = 0.0;
+    double m_lastDumpTime = 0.0;
+    double m_dumpIntervalSec = kDumpIntervalSec;
+    FILE*  m_dumpFile = nullptr;
+    bool   m_dumpFailed = false;
+};
+
+extern CoSyncMetrics g_CoSyncMetrics;
+
+// -----------------------------------------------------------------------------
+// Per-message-type wire counters (HELLO / EC / EU / ED / TS / TP / other)
+// net.rx.<type>.msgs|bytes and net.tx.<type>.msgs|bytes
+// -----------------------------------------------------------------------------
+namespace CoSyncWireMetrics
+{
+    void CountReceived(const std::string& msg);
+    void CountSent(const std::string& msg);
+}
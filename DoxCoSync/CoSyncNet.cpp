@@ -1,4 +1,6 @@
 ﻿// CoSyncNet.cpp
+#define COSYNC_LOG_CHANNEL Net
+
 #include "CoSyncNet.h"
 
 #include "ConsoleLogger.h"
@@ -11,9 +13,12 @@
 #include "Packets_EntityUpdate.h"
 #include "Packets_EntityDestroy.h"
 #include "EntitySerialization.h"
+#include "CoSyncFlatMap.h"
+#include "CoSyncClockSync.h"
+#include "CoSyncTrace.h"
+#include "CoSyncMetrics.h"
 
 #include <mutex>
-#include <unordered_map>
 #include <sstream>
 #include <string>
 #include <functional>
@@ -46,7 +51,7 @@ namespace
         double lastSeen = 0.0;
     };
 
-    std::unordered_map<uint64_t, RemotePeer> s_peers;
+    CoSyncFlatMap<uint64_t, RemotePeer> s_peers;
     std::mutex s_peerMutex;
 }
 
@@ -227,6 +232,7 @@ void CoSyncNet::Shutdown()
         s_peers.clear();
     }
 
+    CoSyncClockSync::Reset();
     CoSyncLocalPlayer::Shutdown();
     CoSyncTransport::Shutdown();
 }
@@ -279,19 +285,17 @@ void CoSyncNet::SetMySteamID(uint64_t sid)
 }
 
 // ============================================================================
-// TICK
+// TICK (scheduler Receive phase, after the transport pump)
 // ============================================================================
 void CoSyncNet::Tick(double now)
 {
-    // 1) Always pump transport first (enqueues inbound)
-    CoSyncTransport::Tick(now);
+    COSYNC_TRACE_SCOPE("Net.Tick");
 
-    // 2) Ensure delayed init happens as soon as world ready
+    // Ensure delayed init happens as soon as world ready
     PerformPendingInit();
 
-    // 3) PlayerMgr tick applies inbox + spawn pump
-    if (s_initialized)
-        g_CoSyncPlayerManager.Tick();
+    // Clients keep their host-clock estimate fresh
+    CoSyncClockSync::Tick(now, s_isHost, s_connected);
 
     if (!s_initialized)
         return;
@@ -299,9 +303,6 @@ void CoSyncNet::Tick(double now)
     // Host publishes its own create after connection is live.
     if (s_isHost && s_connected)
         HostPublishHostCreateIfNeeded();
-
-    // Host NPC authority updates are handled in PlayerMgr (your existing code)
-    g_CoSyncPlayerManager.HostSendNpcUpdates(now);
 }
 
 // ============================================================================
@@ -322,7 +323,11 @@ void CoSyncNet::SendMyEntityUpdate(
     u.pos = pos;
     u.rot = rot;
     u.vel = vel;
-    u.timestamp = now;
+
+    // Sample time on the shared host timeline
+    u.timestamp = CoSyncClockSync::HostNow(now);
+    if (s_isHost || CoSyncClockSync::IsSynced())
+        u.flags |= EntityUpdatePacket::HostTime;
 
     CoSyncTransport::Send(SerializeEntityUpdate(u));
 }
@@ -358,16 +363,30 @@ void CoSyncNet::HostSpawnNpc(
 // ============================================================================
 void CoSyncNet::OnReceive(const std::string& msg, double now, HSteamNetConnection conn)
 {
+    COSYNC_TRACE_SCOPE("Net.OnReceive");
+
+    static CoSyncCounter& s_parseFailures = g_CoSyncMetrics.Counter("net.rx.parse_fail");
+    static CoSyncCounter& s_unhandled = g_CoSyncMetrics.Counter("net.rx.unhandled");
+
+    CoSyncWireMetrics::CountReceived(msg);
+
     // Host-role must be known even before Init completes.
     const bool isHostRole = s_isHost || (s_pendingInit && s_pendingHostFlag);
 
+    // Clock sync ping/pong (never reaches gameplay)
+    if (CoSyncClockSync::HandleMessage(msg, now, conn, isHostRole))
+        return;
+
     // HELLO (client -> host only)
     if (msg.rfind("HELLO|", 0) == 0)
     {
         std::string name;
         uint64_t sid = 0;
         if (!ParseHello(msg, name, sid))
+        {
+            s_parseFailures.Add();
             return;
+        }
 
         const uint32_t eid = EntityIDFromSteamID(sid);
 
@@ -420,13 +439,21 @@ void CoSyncNet::OnReceive(const std::string& msg, double now, HSteamNetConnectio
     {
         EntityUpdatePacket u{};
         if (!DeserializeEntityUpdate(msg, u))
+        {
+            s_parseFailures.Add();
             return;
+        }
 
         // F4MP rule: only host re-broadcasts; clients just enqueue
         if (isHostRole)
         {
-            // Host rebroadcast (authoritative fanout)
-            u.timestamp = now;
+            // Host rebroadcast (authoritative fanout). Synced senders'
+            // sample times are kept; unsynced ones get our receive time.
+            if (!(u.flags & EntityUpdatePacket::HostTime))
+            {
+                u.timestamp = now;
+                u.flags |= EntityUpdatePacket::HostTime;
+            }
             CoSyncTransport::Send(SerializeEntityUpdate(u));
         }
 
@@ -440,6 +467,8 @@ void CoSyncNet::OnReceive(const std::string& msg, double now, HSteamNetConnectio
         EntityDestroyPacket d{};
         if (DeserializeEntityDestroy(msg, d))
             g_CoSyncPlayerManager.EnqueueEntityDestroy(d);
+        else
+            s_parseFailures.Add();
         return;
     }
 
@@ -448,7 +477,10 @@ void CoSyncNet::OnReceive(const std::string& msg, double now, HSteamNetConnectio
     {
         EntityCreatePacket p{};
         if (!DeserializeEntityCreate(msg, p))
+        {
+            s_parseFailures.Add();
             return;
+        }
 
         // Host should not re-enqueue creates it originated unless you explicitly want it;
         // but enqueue is safe on client and host.
@@ -456,6 +488,7 @@ void CoSyncNet::OnReceive(const std::string& msg, double now, HSteamNetConnectio
         return;
     }
 
+    s_unhandled.Add();
     (void)conn;
 }
 
@@ -493,6 +526,7 @@ void CoSyncNet::OnGNSConnected()
 void CoSyncNet::OnGNSDisconnected()
 {
     s_connected = false;
+    CoSyncClockSync::Reset();
     s_helloSent = false;
     s_hostCreatePublished = false;
 }
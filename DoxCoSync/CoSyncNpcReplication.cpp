@@ -0,0 +1,135 @@
+#define COSYNC_LOG_CHANNEL PlayerMgr
+
+#include "CoSyncNpcReplication.h"
+
+#include "ConsoleLogger.h"
+
+#include <cmath>
+
+// -----------------------------------------------------------------------------
+// Tuning (game units; ~70 units per metre)
+// -----------------------------------------------------------------------------
+static constexpr float  kPosEpsilon = 2.0f;      // ~3 cm
+static constexpr float  kRotEpsilon = 0.01f;     // ~0.6 degrees
+static constexpr double kHeartbeatSec = 2.0;     // idle NPCs, well under the 15 s timeout
+
+struct DistanceTier
+{
+    float  maxDist;
+    double intervalSec;
+};
+
+static const DistanceTier kTiers[] =
+{
+    {  2048.0f, 0.05 },   // ~30 m  : 20 Hz
+    {  6144.0f, 0.10 },   // ~90 m  : 10 Hz
+    { 16384.0f, 0.25 },   // ~235 m :  4 Hz
+};
+
+static constexpr double kFarIntervalSec = 1.0;   // beyond the last tier
+
+static float AngleDelta(float a, float b)
+{
+    return std::fabs(std::remainder(a - b, 6.28318530718f));
+}
+
+// -----------------------------------------------------------------------------
+// Pass bookkeeping
+// -----------------------------------------------------------------------------
+void CoSyncNpcReplicator::BeginPass(double now)
+{
+    m_observers.clear();
+
+    if (m_windowStart == 0.0)
+        m_windowStart = now;
+
+    if (now - m_windowStart < 1.0)
+        return;
+
+    m_stats.sentPerSec = m_windowSent;
+    m_stats.skippedPerSec = m_windowSkipped;
+
+    if (m_windowSent || m_windowSkipped)
+    {
+        LOG_DEBUG("[NpcRepl] sent=%u/s skipped=%u/s",
+            m_stats.sentPerSec, m_stats.skippedPerSec);
+    }
+
+    m_windowStart = now;
+    m_windowSent = 0;
+    m_windowSkipped = 0;
+}
+
+// -----------------------------------------------------------------------------
+// Policy
+// -----------------------------------------------------------------------------
+double CoSyncNpcReplicator::TierIntervalFor(const NiPoint3& pos) const
+{
+    if (m_observers.empty())
+        return kTiers[0].intervalSec;
+
+    float bestSq = -1.0f;
+    for (const NiPoint3& o : m_observers)
+    {
+        const float dx = pos.x - o.x;
+        const float dy = pos.y - o.y;
+        const float dz = pos.z - o.z;
+        const float dSq = dx * dx + dy * dy + dz * dz;
+
+        if (bestSq < 0.0f || dSq < bestSq)
+            bestSq = dSq;
+    }
+
+    for (const DistanceTier& t : kTiers)
+    {
+        if (bestSq <= t.maxDist * t.maxDist)
+            return t.intervalSec;
+    }
+
+    return kFarIntervalSec;
+}
+
+bool CoSyncNpcReplicator::ShouldSend(
+    const CoSyncNpcSendState& st,
+    const NiPoint3& pos,
+    const NiPoint3& rot,
+    double now) const
+{
+    if (!st.hasSent)
+        return true;
+
+    const double elapsed = now - st.lastSentTime;
+
+    if (elapsed >= kHeartbeatSec)
+        return true;
+
+    // Small slack so a 20 Hz timer never misses a 20 Hz tier by rounding
+    if (elapsed + 0.005 < TierIntervalFor(pos))
+        return false;
+
+    const float dx = pos.x - st.pos.x;
+    const float dy = pos.y - st.pos.y;
+    const float dz = pos.z - st.pos.z;
+
+    if (dx * dx + dy * dy + dz * dz > kPosEpsilon * kPosEpsilon)
+        return true;
+
+    return AngleDelta(rot.x, st.rot.x) > kRotEpsilon ||
+        AngleDelta(rot.y, st.rot.y) > kRotEpsilon ||
+        AngleDelta(rot.z, st.rot.z) > kRotEpsilon;
+}
+
+void CoSyncNpcReplicator::MarkSent(
+    CoSyncNpcSendState& st,
+    const NiPoint3& pos,
+    const NiPoint3& rot,
+    double now)
+{
+    st.pos = pos;
+    st.rot = rot;
+    st.lastSentTime = now;
+    st.hasSent = true;
+
+    ++m_windowSent;
+    ++m_stats.totalSent;
+}
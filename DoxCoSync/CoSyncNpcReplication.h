@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "NiTypes.h"   // NiPoint3
+
+// -----------------------------------------------------------------------------
+// CoSyncNpcSendState
+// Per-NPC record of what the host last replicated (lives in CoSyncEntityState).
+// -----------------------------------------------------------------------------
+struct CoSyncNpcSendState
+{
+    NiPoint3 pos{ 0.f, 0.f, 0.f };
+    NiPoint3 rot{ 0.f, 0.f, 0.f };
+
+    double lastSentTime = 0.0;
+    bool   hasSent = false;
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncNpcReplicator
+//
+// Host-side send policy for host-authoritative NPC transforms.
+// GAME THREAD ONLY.
+//
+// An NPC is sent when:
+//   - it has never been sent, OR
+//   - its distance tier interval elapsed AND pos/rot moved past epsilon, OR
+//   - the idle heartbeat interval elapsed (keeps client timeouts alive)
+//
+// Distance tier = distance to the NEAREST remote player proxy (the
+// interested clients). No known observers -> nearest tier (full rate).
+// -----------------------------------------------------------------------------
+class CoSyncNpcReplicator
+{
+public:
+    struct Stats
+    {
+        // Last completed one-second window
+        uint32_t sentPerSec = 0;
+        uint32_t skippedPerSec = 0;
+
+        uint64_t totalSent = 0;
+        uint64_t totalSkipped = 0;
+    };
+
+    // ---------------------------------------------------------------------
+    // Per-pass usage
+    // ---------------------------------------------------------------------
+    void BeginPass(double now);
+    void AddObserver(const NiPoint3& pos) { m_observers.push_back(pos); }
+
+    bool ShouldSend(const CoSyncNpcSendState& st, const NiPoint3& pos, const NiPoint3& rot, double now) const;
+
+    void MarkSent(CoSyncNpcSendState& st, const NiPoint3& pos, const NiPoint3& rot, double now);
+    void MarkSkipped() { ++m_windowSkipped; ++m_stats.totalSkipped; }
+
+    const Stats& GetStats() const { return m_stats; }
+
+private:
+    double TierIntervalFor(const NiPoint3& pos) const;
+
+private:
+    std::vector<NiPoint3> m_observers;   // reused per pass
+
+    double   m_windowStart = 0.0;
+    uint32_t m_windowSent = 0;
+    uint32_t m_windowSkipped = 0;
+
+    Stats m_stats;
+};
@@ -4,6 +4,12 @@
 #include "HamachiUtil.h"
 #include "F4MP_Main.h"
 #include "GNS_Session.h"
+#include "CoSyncTrace.h"
+#include "CoSyncMetrics.h"
+#include "CoSyncPerfPanel.h"
+#include "CoSyncEntitySnapshot.h"
+#include "CoSyncFrameGovernor.h"
+#include "CoSyncTransformWriter.h"
 
 #include <cstring>
 
@@ -16,6 +22,18 @@ static std::string g_ipField;
 // Return value buffer for CoSyncOverlay_GetHostIP()
 static std::string g_lastReturnedHostIP;
 
+// Last trace dump written from the Profiling section
+static std::string g_lastTracePath;
+
+// Separate performance window (graphs / per-connection / per-entity)
+static bool g_showPerfPanel = false;
+
+// Frame governor budget slider (applied on release)
+static float g_netBudgetField = static_cast<float>(CoSyncFrameGovernor::kDefaultBudgetMicros);
+
+// Transform writer move cap slider (applied on release; -1 = read from writer)
+static int g_maxMovesField = -1;
+
 // ------------------------------------------------------------
 // Visibility
 // ------------------------------------------------------------
@@ -133,8 +151,110 @@ void CoSyncOverlay_Render()
         }
     }
 
+    // ============================================================
+    // PROFILING
+    // ============================================================
+    ImGui::Separator();
+
+    if (ImGui::CollapsingHeader("Profiling"))
+    {
+        bool tracing = CoSyncTrace::IsEnabled();
+        if (ImGui::Checkbox("Record frame trace", &tracing))
+        {
+            if (tracing)
+                CoSyncTrace::Start();
+            else
+                CoSyncTrace::Stop();
+        }
+
+        if (ImGui::Button("Dump trace (Chrome JSON)"))
+            g_lastTracePath = CoSyncTrace::DumpToLogDirectory();
+
+        if (!g_lastTracePath.empty())
+            ImGui::TextWrapped("Last dump: %s", g_lastTracePath.c_str());
+
+        ImGui::Checkbox("Performance panel", &g_showPerfPanel);
+
+        // Frame governor (0 = unlimited); stats from the last metrics snapshot
+        ImGui::SliderFloat("Net budget (us/frame)", &g_netBudgetField, 0.0f, 10000.0f, "%.0f");
+        if (ImGui::IsItemDeactivatedAfterEdit())
+            g_CoSyncFrameGovernor.SetBudgetMicros(g_netBudgetField);
+
+        // Smoothed actor moves per frame (0 = unlimited); the INI may have set it
+        if (g_maxMovesField < 0)
+            g_maxMovesField = static_cast<int>(g_CoSyncTransformWriter.MaxMovesPerFrame());
+
+        ImGui::SliderInt("Actor moves/frame", &g_maxMovesField, 0, 128);
+        if (ImGui::IsItemDeactivatedAfterEdit())
+            g_CoSyncTransformWriter.SetMaxMovesPerFrame(static_cast<uint32_t>(g_maxMovesField));
+
+        CoSyncMetrics::Sample overBudget;
+        CoSyncMetrics::Sample overrun;
+        if (g_CoSyncMetrics.Query("governor.over_budget_frames", overBudget) &&
+            g_CoSyncMetrics.Query("governor.overrun_us", overrun))
+        {
+            ImGui::Text("Over budget: %.0f frames/s (total %.0f), overrun p99 %.0fus max %.0fus",
+                overBudget.ratePerSec, overBudget.value, overrun.p99, overrun.max);
+        }
+    }
+
+    if (ImGui::CollapsingHeader("Entities"))
+    {
+        // Render thread: read the published tick snapshot, never the live table
+        auto snap = g_CoSyncEntitySnapshots.Acquire();
+
+        if (!snap || snap->entities.empty())
+        {
+            ImGui::TextDisabled("No remote entities");
+        }
+        else
+        {
+            ImGui::Text("%zu entities (tick %llu)", snap->entities.size(), (unsigned long long)snap->frame);
+
+            for (const CoSyncEntityView& e : snap->entities)
+            {
+                ImGui::Text("%08X %-6s owner=%08X %s pos=(%.0f, %.0f, %.0f)",
+                    e.entityID,
+                    (e.type == CoSyncEntityType::NPC) ? "NPC" : "Player",
+                    e.ownerEntityID,
+                    e.spawned ? "spawned" : "pending",
+                    e.pos.x, e.pos.y, e.pos.z);
+            }
+        }
+    }
+
+    if (ImGui::CollapsingHeader("Metrics"))
+    {
+        // Last 1 Hz snapshot; histograms are per-window, in microseconds
+        const std::vector<CoSyncMetrics::Sample> samples = g_CoSyncMetrics.GetSnapshot();
+
+        if (samples.empty())
+            ImGui::TextDisabled("No snapshot yet");
+
+        for (const CoSyncMetrics::Sample& s : samples)
+        {
+            switch (s.kind)
+            {
+            case CoSyncMetrics::Kind::Counter:
+                ImGui::Text("%-28s %12.0f  (%.1f/s)", s.name.c_str(), s.value, s.ratePerSec);
+                break;
+
+            case CoSyncMetrics::Kind::Gauge:
+                ImGui::Text("%-28s %12.0f", s.name.c_str(), s.value);
+                break;
+
+            case CoSyncMetrics::Kind::Histogram:
+                ImGui::Text("%-28s n=%llu p50=%.0f p99=%.0f max=%.0f us",
+                    s.name.c_str(), (unsigned long long)s.count, s.p50, s.p99, s.max);
+                break;
+            }
+        }
+    }
+
     ImGui::Separator();
     ImGui::Text("Press INSERT to toggle overlay");
 
     ImGui::End();
+
+    CoSyncPerfPanel_Render(&g_showPerfPanel);
 }
@@ -1,4 +1,6 @@
 // CoSyncPapyrusHelper.cpp
+#define COSYNC_LOG_CHANNEL Papyrus
+
 #include "CoSyncPapyrusHelper.h"
 
 #include "ConsoleLogger.h"
@@ -0,0 +1,203 @@
+#include "CoSyncPerfPanel.h"
+
+#include "imgui.h"
+
+namespace
+{
+    // Latest copy; refreshed only when CoSyncPerfStats publishes
+    CoSyncPerfModel s_view;
+
+    constexpr ImGuiTableFlags kTableFlags =
+        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit;
+
+    template <size_t N>
+    void Plot(const char* label, const CoSyncPerfHistory<N>& h, const char* unit)
+    {
+        char overlay[48];
+        snprintf(overlay, sizeof(overlay), "%.1f %s (max %.1f)", h.Latest(), unit, h.Max());
+
+        ImGui::PlotLines(label, h.Data(), h.Count(), h.Offset(), overlay,
+            0.f, FLT_MAX, ImVec2(0.f, 48.f));
+    }
+
+    void DrawBandwidth(const CoSyncPerfModel& m)
+    {
+        Plot("rx B/s", m.rxBytesPerSec, "B/s");
+        Plot("tx B/s", m.txBytesPerSec, "B/s");
+
+        if (!ImGui::BeginTable("##wire", 5, kTableFlags))
+            return;
+
+        ImGui::TableSetupColumn("Type");
+        ImGui::TableSetupColumn("rx B/s");
+        ImGui::TableSetupColumn("rx msg/s");
+        ImGui::TableSetupColumn("tx B/s");
+        ImGui::TableSetupColumn("tx msg/s");
+        ImGui::TableHeadersRow();
+
+        for (const CoSyncPerfModel::WireRow& r : m.wire)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(r.type);
+            ImGui::TableNextColumn(); ImGui::Text("%.0f", r.rxBytesPerSec);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", r.rxMsgsPerSec);
+            ImGui::TableNextColumn(); ImGui::Text("%.0f", r.txBytesPerSec);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", r.txMsgsPerSec);
+        }
+
+        ImGui::EndTable();
+    }
+
+    void DrawConnections(const CoSyncPerfModel& m)
+    {
+        Plot("worst ping", m.worstPingMs, "ms");
+
+        if (m.connections.empty())
+        {
+            ImGui::TextDisabled("No connections");
+            return;
+        }
+
+        if (!ImGui::BeginTable("##conns", 7, kTableFlags))
+            return;
+
+        ImGui::TableSetupColumn("Conn");
+        ImGui::TableSetupColumn("SteamID");
+        ImGui::TableSetupColumn("RTT ms");
+        ImGui::TableSetupColumn("Loss L/R %");
+        ImGui::TableSetupColumn("in B/s");
+        ImGui::TableSetupColumn("out B/s");
+        ImGui::TableSetupColumn("Pending");
+        ImGui::TableHeadersRow();
+
+        for (const CoSyncPerfModel::ConnectionRow& r : m.connections)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("%u", r.conn);
+            ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)r.steamID);
+            ImGui::TableNextColumn(); ImGui::Text("%d", r.pingMs);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f / %.1f", r.lossLocal * 100.f, r.lossRemote * 100.f);
+            ImGui::TableNextColumn(); ImGui::Text("%.0f", r.inBytesPerSec);
+            ImGui::TableNextColumn(); ImGui::Text("%.0f", r.outBytesPerSec);
+            ImGui::TableNextColumn(); ImGui::Text("%d", r.pendingReliableBytes);
+        }
+
+        ImGui::EndTable();
+    }
+
+    void DrawQueues(const CoSyncPerfModel& m)
+    {
+        ImGui::Text("Inbox: transport %lld, manager %lld   Spawn queue: %lld",
+            (long long)m.transportInbox, (long long)m.playerMgrInbox, (long long)m.spawnQueue);
+
+        Plot("inbox", m.inboxDepth, "msgs");
+        Plot("spawn queue", m.spawnQueueDepth, "");
+    }
+
+    void DrawEntities(const CoSyncPerfModel& m)
+    {
+        if (m.entities.empty())
+        {
+            ImGui::TextDisabled("No remote entities");
+            return;
+        }
+
+        const ImVec2 size(0.f, ImGui::GetTextLineHeightWithSpacing() * 10.f);
+        if (!ImGui::BeginTable("##entities", 6, kTableFlags | ImGuiTableFlags_ScrollY, size))
+            return;
+
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Entity");
+        ImGui::TableSetupColumn("Kind");
+        ImGui::TableSetupColumn("Delay ms");
+        ImGui::TableSetupColumn("Jitter ms");
+        ImGui::TableSetupColumn("Extrap ms");
+        ImGui::TableSetupColumn("Underflows");
+        ImGui::TableHeadersRow();
+
+        // Only visible rows are submitted
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(m.entities.size()));
+
+        while (clipper.Step())
+        {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+            {
+                const CoSyncPerfModel::EntityRow& r = m.entities[i];
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%08X", r.entityID);
+                ImGui::TableNextColumn(); ImGui::TextUnformatted(r.isNpc ? "NPC" : "Player");
+                ImGui::TableNextColumn(); ImGui::Text("%.1f", r.delayMs);
+                ImGui::TableNextColumn(); ImGui::Text("%.1f", r.jitterMs);
+                ImGui::TableNextColumn(); ImGui::Text("%.1f", r.extrapolationMs);
+                ImGui::TableNextColumn(); ImGui::Text("%u", r.underflows);
+            }
+        }
+
+        ImGui::EndTable();
+    }
+
+    void DrawPhases(const CoSyncPerfModel& m)
+    {
+        Plot("frame p99", m.frameP99Us, "us");
+
+        if (!ImGui::BeginTable("##phases", 4, kTableFlags))
+            return;
+
+        ImGui::TableSetupColumn("Phase");
+        ImGui::TableSetupColumn("p50 us");
+        ImGui::TableSetupColumn("p99 us");
+        ImGui::TableSetupColumn("max us");
+        ImGui::TableHeadersRow();
+
+        for (const CoSyncPerfModel::PhaseRow& r : m.phases)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(r.name.c_str());
+            ImGui::TableNextColumn(); ImGui::Text("%.0f", r.p50Us);
+            ImGui::TableNextColumn(); ImGui::Text("%.0f", r.p99Us);
+            ImGui::TableNextColumn(); ImGui::Text("%.0f", r.maxUs);
+        }
+
+        ImGui::EndTable();
+    }
+}
+
+void CoSyncPerfPanel_Draw(const CoSyncPerfModel& m)
+{
+    if (m.version == 0)
+    {
+        ImGui::TextDisabled("Waiting for the first metrics snapshot...");
+        return;
+    }
+
+    if (ImGui::CollapsingHeader("Bandwidth", ImGuiTreeNodeFlags_DefaultOpen))
+        DrawBandwidth(m);
+
+    if (ImGui::CollapsingHeader("Connections", ImGuiTreeNodeFlags_DefaultOpen))
+        DrawConnections(m);
+
+    if (ImGui::CollapsingHeader("Queues", ImGuiTreeNodeFlags_DefaultOpen))
+        DrawQueues(m);
+
+    if (ImGui::CollapsingHeader("Entities"))
+        DrawEntities(m);
+
+    if (ImGui::CollapsingHeader("Tick phases", ImGuiTreeNodeFlags_DefaultOpen))
+        DrawPhases(m);
+}
+
+void CoSyncPerfPanel_Render(bool* open)
+{
+    if (open && !*open)
+        return;
+
+    CoSyncPerfStats::CopyIfNewer(s_view);
+
+    ImGui::SetNextWindowSize(ImVec2(520.f, 640.f), ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("CoSync Performance", open))
+        CoSyncPerfPanel_Draw(s_view);
+
+    ImGui::End();
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "CoSyncPerfStats.h"
+
+// -----------------------------------------------------------------------------
+// Performance panel (ImGui)
+//
+// Pure consumer of CoSyncPerfModel: no metric lookups, Steam calls or entity
+// walks per frame. Render() refreshes its copy at most once per snapshot.
+// -----------------------------------------------------------------------------
+
+// Separate window; `open` is cleared by the close button
+void CoSyncPerfPanel_Render(bool* open);
+
+// Draws an explicit model into the current window (headless tests / tooling)
+void CoSyncPerfPanel_Draw(const CoSyncPerfModel& model);
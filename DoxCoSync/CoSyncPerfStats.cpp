@@ -0,0 +1,197 @@
+#include "CoSyncPerfStats.h"
+
+#include "CoSyncMetrics.h"
+#include "CoSyncPlayerManager.h"
+#include "CoSyncEntityTable.h"
+#include "GNS_Session.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    // Keep the per-second copy to the overlay small
+    constexpr size_t kMaxEntityRows = 256;
+
+    const char* const kWireTypes[] = { "HELLO", "EC", "EU", "ED", "TS", "TP", "other" };
+
+    std::mutex s_modelMutex;
+    CoSyncPerfModel s_model;            // guarded by s_modelMutex
+    CoSyncPerfModel s_building;         // game thread only
+    std::vector<GNSConnectionStats> s_connScratch;
+    bool s_installed = false;
+
+    using SampleIndex = std::unordered_map<std::string, const CoSyncMetrics::Sample*>;
+
+    const CoSyncMetrics::Sample* Find(const SampleIndex& index, const std::string& name)
+    {
+        auto it = index.find(name);
+        return (it != index.end()) ? it->second : nullptr;
+    }
+
+    float Rate(const SampleIndex& index, const std::string& name)
+    {
+        const CoSyncMetrics::Sample* s = Find(index, name);
+        return s ? static_cast<float>(s->ratePerSec) : 0.f;
+    }
+
+    int64_t Value(const SampleIndex& index, const char* name)
+    {
+        const CoSyncMetrics::Sample* s = Find(index, name);
+        return s ? static_cast<int64_t>(s->value) : 0;
+    }
+
+    void BuildWire(const SampleIndex& index, CoSyncPerfModel& m)
+    {
+        m.wire.clear();
+
+        float rxTotal = 0.f;
+        float txTotal = 0.f;
+
+        for (const char* type : kWireTypes)
+        {
+            const std::string rx = std::string("net.rx.") + type;
+            const std::string tx = std::string("net.tx.") + type;
+
+            CoSyncPerfModel::WireRow row;
+            row.type = type;
+            row.rxBytesPerSec = Rate(index, rx + ".bytes");
+            row.txBytesPerSec = Rate(index, tx + ".bytes");
+            row.rxMsgsPerSec = Rate(index, rx + ".msgs");
+            row.txMsgsPerSec = Rate(index, tx + ".msgs");
+
+            rxTotal += row.rxBytesPerSec;
+            txTotal += row.txBytesPerSec;
+
+            m.wire.push_back(row);
+        }
+
+        m.rxBytesPerSec.Push(rxTotal);
+        m.txBytesPerSec.Push(txTotal);
+    }
+
+    void BuildConnections(CoSyncPerfModel& m)
+    {
+        GNS_Session::Get().GetConnectionStats(s_connScratch);
+
+        m.connections.clear();
+        int worstPing = 0;
+
+        for (const GNSConnectionStats& c : s_connScratch)
+        {
+            CoSyncPerfModel::ConnectionRow row;
+            row.conn = c.conn;
+            row.steamID = c.steamID;
+            row.pingMs = c.pingMs;
+            row.lossLocal = (c.qualityLocal >= 0.f) ? 1.f - c.qualityLocal : 0.f;
+            row.lossRemote = (c.qualityRemote >= 0.f) ? 1.f - c.qualityRemote : 0.f;
+            row.inBytesPerSec = c.inBytesPerSec;
+            row.outBytesPerSec = c.outBytesPerSec;
+            row.pendingReliableBytes = c.pendingReliableBytes;
+
+            worstPing = (c.pingMs > worstPing) ? c.pingMs : worstPing;
+            m.connections.push_back(row);
+        }
+
+        m.worstPingMs.Push(static_cast<float>(worstPing));
+    }
+
+    void BuildEntities(CoSyncPerfModel& m)
+    {
+        const CoSyncEntityTable& table = g_CoSyncPlayerManager.GetEntities();
+
+        m.entities.clear();
+
+        for (size_t row = 0; row < table.Size() && m.entities.size() < kMaxEntityRows; ++row)
+        {
+            const uint8_t flags = table.FlagsAt(row);
+            if (!(flags & CoSyncEntityTable::kHot_Spawned))
+                continue;
+
+            const CoSyncPlayer& p = table.PlayerAt(row);
+            const CoSyncJitterBuffer::Stats& playout = p.GetPlayoutStats();
+
+            CoSyncPerfModel::EntityRow e;
+            e.entityID = table.EntityIDAt(row);
+            e.isNpc = (flags & CoSyncEntityTable::kHot_NPC) != 0;
+            e.delayMs = static_cast<float>(playout.delaySec * 1000.0);
+            e.jitterMs = static_cast<float>(playout.jitterSec * 1000.0);
+            e.extrapolationMs = static_cast<float>(p.GetExtrapolationSec() * 1000.0);
+            e.underflows = playout.underflows;
+
+            m.entities.push_back(e);
+        }
+    }
+
+    void BuildPhases(const std::vector<CoSyncMetrics::Sample>& samples, CoSyncPerfModel& m)
+    {
+        m.phases.clear();
+
+        for (const CoSyncMetrics::Sample& s : samples)
+        {
+            if (s.kind != CoSyncMetrics::Kind::Histogram)
+                continue;
+
+            if (s.name.compare(0, 6, "phase.") != 0)
+                continue;
+
+            CoSyncPerfModel::PhaseRow row;
+            row.name = s.name;
+            row.p50Us = static_cast<float>(s.p50);
+            row.p99Us = static_cast<float>(s.p99);
+            row.maxUs = static_cast<float>(s.max);
+
+            if (s.name == "phase.frame_us")
+                m.frameP99Us.Push(row.p99Us);
+
+            m.phases.push_back(row);
+        }
+    }
+
+    void OnSnapshot(const std::vector<CoSyncMetrics::Sample>& samples, double now)
+    {
+        SampleIndex index;
+        index.reserve(samples.size());
+        for (const CoSyncMetrics::Sample& s : samples)
+            index.emplace(s.name, &s);
+
+        CoSyncPerfModel& m = s_building;
+        m.time = now;
+
+        BuildWire(index, m);
+        BuildConnections(m);
+
+        m.transportInbox = Value(index, "transport.inbox.depth");
+        m.playerMgrInbox = Value(index, "playermgr.inbox.depth");
+        m.spawnQueue = Value(index, "spawn.queue");
+        m.inboxDepth.Push(static_cast<float>(m.transportInbox + m.playerMgrInbox));
+        m.spawnQueueDepth.Push(static_cast<float>(m.spawnQueue));
+
+        BuildEntities(m);
+        BuildPhases(samples, m);
+
+        std::lock_guard<std::mutex> lk(s_modelMutex);
+        ++m.version;
+        s_model = m;
+    }
+}
+
+void CoSyncPerfStats::Install()
+{
+    if (s_installed)
+        return;
+
+    s_installed = true;
+    g_CoSyncMetrics.AddListener(&OnSnapshot);
+}
+
+bool CoSyncPerfStats::CopyIfNewer(CoSyncPerfModel& inOut)
+{
+    std::lock_guard<std::mutex> lk(s_modelMutex);
+
+    if (s_model.version == inOut.version)
+        return false;
+
+    inOut = s_model;
+    return true;
+}
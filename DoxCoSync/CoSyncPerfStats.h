@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// CoSyncPerfHistory<N>
+//
+// Fixed rolling window of float samples, laid out for ImGui::PlotLines
+// (values, Count(), Offset()). Oldest sample is overwritten when full.
+// -----------------------------------------------------------------------------
+template <size_t N>
+class CoSyncPerfHistory
+{
+public:
+    void Push(float v)
+    {
+        m_values[(m_offset + m_count) % N] = v;
+
+        if (m_count < N)
+            ++m_count;
+        else
+            m_offset = (m_offset + 1) % N;
+    }
+
+    const float* Data() const { return m_values; }
+    int Count() const { return static_cast<int>(m_count); }
+    int Offset() const { return static_cast<int>(m_offset); }
+
+    float Latest() const { return m_count ? m_values[(m_offset + m_count - 1) % N] : 0.f; }
+
+    float Max() const
+    {
+        float m = 0.f;
+        for (size_t i = 0; i < m_count; ++i)
+            m = (m_values[i] > m) ? m_values[i] : m;
+        return m;
+    }
+
+private:
+    float  m_values[N] = {};
+    size_t m_offset = 0;
+    size_t m_count = 0;
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncPerfModel
+//
+// Pre-aggregated data behind the performance panel. Plain values only (no
+// engine or Steam types) so the panel can be drawn from a hand-built model
+// in a headless ImGui context.
+// -----------------------------------------------------------------------------
+struct CoSyncPerfModel
+{
+    static constexpr size_t kHistorySeconds = 120;
+    using History = CoSyncPerfHistory<kHistorySeconds>;
+
+    // Per wire message type (HELLO / EC / EU / ED / TS / TP / other)
+    struct WireRow
+    {
+        const char* type = "";
+        float rxBytesPerSec = 0.f;
+        float txBytesPerSec = 0.f;
+        float rxMsgsPerSec = 0.f;
+        float txMsgsPerSec = 0.f;
+    };
+
+    struct ConnectionRow
+    {
+        uint32_t conn = 0;
+        uint64_t steamID = 0;
+        int      pingMs = 0;
+        float    lossLocal = 0.f;       // 0..1
+        float    lossRemote = 0.f;
+        float    inBytesPerSec = 0.f;
+        float    outBytesPerSec = 0.f;
+        int      pendingReliableBytes = 0;
+    };
+
+    // Remote proxies only
+    struct EntityRow
+    {
+        uint32_t entityID = 0;
+        bool     isNpc = false;
+        float    delayMs = 0.f;          // playout (interpolation) delay
+        float    jitterMs = 0.f;
+        float    extrapolationMs = 0.f;  // 0 while interpolating
+        uint32_t underflows = 0;
+    };
+
+    // phase.* histograms (last window, us)
+    struct PhaseRow
+    {
+        std::string name;
+        float p50Us = 0.f;
+        float p99Us = 0.f;
+        float maxUs = 0.f;
+    };
+
+    uint64_t version = 0;   // bumped per publish
+    double   time = 0.0;
+
+    std::vector<WireRow> wire;
+    History rxBytesPerSec;
+    History txBytesPerSec;
+
+    std::vector<ConnectionRow> connections;
+    History worstPingMs;
+
+    int64_t transportInbox = 0;
+    int64_t playerMgrInbox = 0;
+    int64_t spawnQueue = 0;
+    History inboxDepth;     // transport + manager
+    History spawnQueueDepth;
+
+    std::vector<EntityRow> entities;
+
+    std::vector<PhaseRow> phases;
+    History frameP99Us;
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncPerfStats
+//
+// Builds CoSyncPerfModel from each metrics snapshot (1 Hz, game thread),
+// plus per-connection and per-entity rows gathered at the same moment.
+// The overlay copies the model only when its version changes.
+// -----------------------------------------------------------------------------
+namespace CoSyncPerfStats
+{
+    // Registers the snapshot listener (idempotent)
+    void Install();
+
+    // Copies the latest model into `inOut` when newer; returns true if copied
+    bool CopyIfNewer(CoSyncPerfModel& inOut);
+}
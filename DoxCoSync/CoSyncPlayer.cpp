@@ -1,4 +1,6 @@
-﻿#include "CoSyncPlayer.h"
+﻿#define COSYNC_LOG_CHANNEL PlayerMgr
+
+#include "CoSyncPlayer.h"
 #include "CoSyncPlayerManager.h"
 #include "CoSyncEntityRegistry.h"
 #include "ConsoleLogger.h"
@@ -6,37 +8,20 @@
 #include "GameForms.h"
 #include "GameReferences.h"
 #include "CoSyncGameAPI.h"
+#include "CoSyncActorPool.h"
+#include "CoSyncDeadReckoning.h"
+#include "CoSyncInterpolation.h"
+#include "CoSyncTransformWriter.h"
+#include "CoSyncClock.h"
 
-#define WIN32_LEAN_AND_MEAN
-#include <Windows.h>
+#include <cmath>
 
 extern RelocPtr<PlayerCharacter*> g_player;
 
-// -----------------------------------------------------------------------------
-// Timing helpers
-// -----------------------------------------------------------------------------
-static double NowSeconds()
-{
-    LARGE_INTEGER f{}, c{};
-    QueryPerformanceFrequency(&f);
-    QueryPerformanceCounter(&c);
-    return static_cast<double>(c.QuadPart) / static_cast<double>(f.QuadPart);
-}
-
-// Render slightly in the past to absorb jitter (players only)
-static constexpr double kInterpDelay = 0.10;
-
-// -----------------------------------------------------------------------------
-// Helpers
-// -----------------------------------------------------------------------------
-static NiPoint3 Lerp(const NiPoint3& a, const NiPoint3& b, double t)
-{
-    return NiPoint3{
-        a.x + float((b.x - a.x) * t),
-        a.y + float((b.y - a.y) * t),
-        a.z + float((b.z - a.z) * t)
-    };
-}
+// Extrapolation error correction: decay time constant, and the largest
+// jump we blend (anything bigger is a teleport and snaps)
+static constexpr double kCorrectionTau = 0.10;
+static constexpr float  kMaxCorrectionDist = 256.0f;
 
 // -----------------------------------------------------------------------------
 // Construction
@@ -49,7 +34,7 @@ CoSyncPlayer::CoSyncPlayer(const std::string& name)
 // -----------------------------------------------------------------------------
 // Spawn
 // -----------------------------------------------------------------------------
-bool CoSyncPlayer::SpawnInWorld(TESObjectREFR* anchor, TESNPC* npcBase)
+bool CoSyncPlayer::SpawnInWorld(TESObjectREFR* anchor, TESNPC* npcBase, bool startHidden)
 {
     if (hasSpawned)
         return true;
@@ -57,18 +42,28 @@ bool CoSyncPlayer::SpawnInWorld(TESObjectREFR* anchor, TESNPC* npcBase)
     if (!anchor || !npcBase)
         return false;
 
-    Actor* actor = CoSyncGameAPI::SpawnRemoteActor(npcBase);
+    // Recycled (disabled) actor if the pool has one, else PlaceAtMe
+    bool reused = false;
+    Actor* actor = g_CoSyncActorPool.Acquire(npcBase->formID, startHidden, &reused);
     if (!actor)
         return false;
 
     actorRef = actor;
+    spawnBaseFormID = npcBase->formID;
+    spawnedFromPool = reused;
+    hiddenUntilUpdate = startHidden;
     g_CoSyncEntities.Register(entityID, actorRef);
 
     // Reset smoothing state
-    m_tfBuffer.clear();
+    m_tfBuffer.SetCapacity(CoSyncInterpolation::GetHistoryCapacity(createType));
+    m_jitter.Reset();
     m_lastHostTime = 0.0;
-    m_lastRecvLocalTime = NowSeconds();
+    m_lastRecvLocalTime = CoSyncClock::Now();
     m_hasAny = false;
+    m_hasRendered = false;
+    m_extrapolating = false;
+    m_correctionPending = false;
+    m_correction = NiPoint3(0.f, 0.f, 0.f);
 
     hasSpawned = true;
 
@@ -76,25 +71,47 @@ bool CoSyncPlayer::SpawnInWorld(TESObjectREFR* anchor, TESNPC* npcBase)
     if (hasPendingTransform)
         ApplyPendingTransformIfAny();
 
-    LOG_INFO("[CoSyncPlayer] Spawn END entity=%u actor=%p", entityID, actorRef);
+    // UPDATE already arrived while the spawn was queued
+    if (hasReceivedUpdate)
+        RevealIfHidden();
+
+    LOG_INFO("[CoSyncPlayer] Spawn END entity=%u actor=%p%s%s", entityID, actorRef,
+        reused ? " (pooled)" : "", hiddenUntilUpdate ? " (hidden)" : "");
     return true;
 }
 
+void CoSyncPlayer::RevealIfHidden()
+{
+    if (!hiddenUntilUpdate || !actorRef)
+        return;
+
+    hiddenUntilUpdate = false;
+    CoSyncGameAPI::EnableActor(actorRef);
+
+    LOG_DEBUG("[CoSyncPlayer] Reveal entity=%u actor=%p (first UPDATE)", entityID, actorRef);
+}
+
 // -----------------------------------------------------------------------------
 // Receive UPDATE
 // -----------------------------------------------------------------------------
-void CoSyncPlayer::ApplyUpdate(const EntityUpdatePacket& u)
+void CoSyncPlayer::ApplyUpdate(const EntityUpdatePacket& u, double recvLocalTime)
 {
     lastPacketTime = u.timestamp;
-    m_lastRecvLocalTime = NowSeconds();
+    m_lastRecvLocalTime = recvLocalTime;
 
     pendingPos = u.pos;
     pendingRot = u.rot;
     pendingVel = u.vel;
-    hasPendingTransform = true;
+    hasReceivedUpdate = true;
 
+    // Not spawned yet: the newest UPDATE becomes the first snap
     if (!hasSpawned || !actorRef)
+    {
+        hasPendingTransform = true;
         return;
+    }
+
+    RevealIfHidden();
 
     // -----------------------------------------------------------------
     // F4MP-aligned NPC rule:
@@ -104,7 +121,7 @@ void CoSyncPlayer::ApplyUpdate(const EntityUpdatePacket& u)
     // -----------------------------------------------------------------
     if (createType == CoSyncEntityType::NPC)
     {
-        CoSyncGameAPI::PositionRemoteActor(actorRef, u.pos, u.rot);
+        g_CoSyncTransformWriter.Write(actorRef, u.pos, u.rot);
         hasPendingTransform = false;
         return;
     }
@@ -113,18 +130,30 @@ void CoSyncPlayer::ApplyUpdate(const EntityUpdatePacket& u)
     if (m_hasAny && u.timestamp < m_lastHostTime)
         return;
 
+    // Teleport: snap and restart the stream (never blended)
+    if (u.flags & EntityUpdatePacket::Teleport)
+    {
+        hasPendingTransform = true;
+        pendingTeleport = true;
+        ApplyPendingTransformIfAny();
+        return;
+    }
+
     NetTransform tf{};
     tf.pos = u.pos;
     tf.rot = u.rot;
+    tf.vel = u.vel;
     tf.scale = 1.0f;
     tf.hostTime = u.timestamp;
 
-    m_tfBuffer.push_back(tf);
+    m_tfBuffer.PushBack(tf);
+    m_jitter.OnSample(tf.hostTime, m_lastRecvLocalTime);
     m_lastHostTime = tf.hostTime;
     m_hasAny = true;
 
-    while (m_tfBuffer.size() > 8)
-        m_tfBuffer.pop_front();
+    // Real data after a starved stretch: blend out the prediction error
+    if (m_extrapolating)
+        m_correctionPending = true;
 }
 
 // -----------------------------------------------------------------------------
@@ -135,74 +164,161 @@ void CoSyncPlayer::ApplyPendingTransformIfAny()
     if (!hasSpawned || !actorRef || !hasPendingTransform)
         return;
 
-    // Engine-safe movement only (no actor->pos writes)
-    CoSyncGameAPI::PositionRemoteActor(actorRef, pendingPos, pendingRot);
+    // Engine-safe movement only (no actor->pos writes); always snaps
+    g_CoSyncTransformWriter.Write(actorRef, pendingPos, pendingRot, true);
 
     // NPCs never maintain an interpolation buffer
     if (createType == CoSyncEntityType::NPC)
     {
         hasPendingTransform = false;
+        pendingTeleport = false;
         return;
     }
 
-    // Seed interpolation buffer with the snapped transform for players
-    m_tfBuffer.clear();
-
-    NetTransform tf{};
-    tf.pos = pendingPos;
-    tf.rot = pendingRot;
-    tf.scale = 1.0f;
-    tf.hostTime = lastPacketTime;
+    // Seed interpolation buffer with the snapped transform for players.
+    // The playout clock only restarts on the first snap or a teleport;
+    // a repeated CREATE keeps the measured jitter.
+    m_tfBuffer.Clear();
+    const bool restartClock = !m_hasAny || pendingTeleport;
+    if (restartClock)
+        m_jitter.Reset();
+
+    // A snap from CREATE alone has no host timestamp: buffer and playout
+    // clock stay empty until the first UPDATE anchors them
+    if (hasReceivedUpdate)
+    {
+        if (restartClock)
+            m_jitter.OnSample(lastPacketTime, m_lastRecvLocalTime);
+
+        NetTransform tf{};
+        tf.pos = pendingPos;
+        tf.rot = pendingRot;
+        tf.vel = pendingVel;
+        tf.scale = 1.0f;
+        tf.hostTime = lastPacketTime;
+
+        m_tfBuffer.PushBack(tf);
+        m_lastHostTime = tf.hostTime;
+        m_hasAny = true;
+    }
 
-    m_tfBuffer.push_back(tf);
-    m_lastHostTime = tf.hostTime;
-    m_hasAny = true;
+    // Snapped: nothing to blend from
+    m_lastRenderedPos = pendingPos;
+    m_hasRendered = true;
+    m_extrapolating = false;
+    m_correctionPending = false;
+    m_correction = NiPoint3(0.f, 0.f, 0.f);
 
     hasPendingTransform = false;
+    pendingTeleport = false;
 }
 
 // -----------------------------------------------------------------------------
 // Per-frame smoothing (players only)
+//
+// Split around CoSyncBatchInterp: Prepare (clock + bracket search) and
+// Finish (error correction + engine write) are per entity; the blend
+// itself runs batched over all proxies.
 // -----------------------------------------------------------------------------
-void CoSyncPlayer::TickSmoothing(double now)
+bool CoSyncPlayer::PrepareSmoothing(double now, CoSyncInterpJob& out)
 {
-    (void)now;
-
     if (!hasSpawned || !actorRef)
-        return;
+        return false;
 
     // NPCs must NEVER be smoothed or interpolated (F4MP-aligned)
     if (createType == CoSyncEntityType::NPC)
-        return;
+        return false;
 
-    if (m_tfBuffer.size() < 2)
-        return;
+    if (m_tfBuffer.Empty())
+        return false;
 
-    const double renderTime = m_lastHostTime - kInterpDelay;
+    // Steady host-time playout clock (adaptive jitter delay)
+    const double renderTime = m_jitter.RenderTime(now);
     if (renderTime <= 0.0)
-        return;
+        return false;
+
+    const NetTransform& newest = m_tfBuffer.Back();
+    m_jitter.NoteStarved(renderTime > newest.hostTime);
+
+    const CoSyncInterpolation::Modes modes = CoSyncInterpolation::GetModes(createType);
+    out.shortestArc = (modes.rotation == CoSyncInterpolation::RotationMode::ShortestArc);
+
+    if (renderTime > newest.hostTime)
+    {
+        // Buffer starved: bounded dead reckoning from the newest sample,
+        // as a linear blend toward the prediction at the clamp horizon
+        const double horizon = CoSyncDeadReckoning::kMaxExtrapolationSec;
+
+        out.p0 = newest.pos;
+        out.p1 = CoSyncDeadReckoning::Extrapolate(newest.pos, newest.vel, horizon);
+        out.r0 = newest.rot;
+        out.r1 = newest.rot;
+        out.elapsed = static_cast<float>(renderTime - newest.hostTime);
+        out.span = static_cast<float>(horizon);
+        out.hermite = false;
+
+        m_extrapolating = true;
+        m_extrapolationSec = renderTime - newest.hostTime;
+        return true;
+    }
+
+    if (m_tfBuffer.Size() < 2)
+        return false;
+
+    // Binary search; bracket samples are referenced in place
+    const NetTransform* a = nullptr;
+    const NetTransform* b = nullptr;
+    m_tfBuffer.FindBracket(renderTime, a, b);
+
+    out.p0 = a->pos;
+    out.v0 = a->vel;
+    out.p1 = b->pos;
+    out.v1 = b->vel;
+    out.r0 = a->rot;
+    out.r1 = b->rot;
+    out.elapsed = static_cast<float>(renderTime - a->hostTime);
+    out.span = static_cast<float>(b->hostTime - a->hostTime);
+    out.hermite = (modes.position == CoSyncInterpolation::PositionMode::Hermite);
+
+    m_extrapolating = false;
+    return true;
+}
+
+void CoSyncPlayer::FinishSmoothing(double now, NiPoint3 pos, const NiPoint3& rot)
+{
+    // Error correction: capture the jump once, then decay it
+    if (m_correctionPending && m_hasRendered)
+    {
+        const NiPoint3 err(
+            m_lastRenderedPos.x - pos.x,
+            m_lastRenderedPos.y - pos.y,
+            m_lastRenderedPos.z - pos.z);
+
+        const float errSq = err.x * err.x + err.y * err.y + err.z * err.z;
+        m_correction = (errSq <= kMaxCorrectionDist * kMaxCorrectionDist)
+            ? err
+            : NiPoint3(0.f, 0.f, 0.f);
+    }
+    m_correctionPending = false;
 
-    NetTransform a = m_tfBuffer.front();
-    NetTransform b = m_tfBuffer.back();
+    const double dt = (m_lastSmoothTime > 0.0) ? (now - m_lastSmoothTime) : 0.0;
+    m_lastSmoothTime = now;
 
-    for (size_t i = 1; i < m_tfBuffer.size(); ++i)
+    if (dt > 0.0)
     {
-        if (m_tfBuffer[i].hostTime >= renderTime)
-        {
-            a = m_tfBuffer[i - 1];
-            b = m_tfBuffer[i];
-            break;
-        }
+        const float decay = static_cast<float>(std::exp(-dt / kCorrectionTau));
+        m_correction.x *= decay;
+        m_correction.y *= decay;
+        m_correction.z *= decay;
     }
 
-    const double denom = (b.hostTime - a.hostTime);
-    double t = (denom > 0.000001) ? (renderTime - a.hostTime) / denom : 0.0;
-    if (t < 0.0) t = 0.0;
-    if (t > 1.0) t = 1.0;
+    pos.x += m_correction.x;
+    pos.y += m_correction.y;
+    pos.z += m_correction.z;
 
-    const NiPoint3 pos = Lerp(a.pos, b.pos, t);
-    const NiPoint3 rot = Lerp(a.rot, b.rot, t);
+    m_lastRenderedPos = pos;
+    m_hasRendered = true;
 
-    // Always route through engine-safe wrapper
-    CoSyncGameAPI::PositionRemoteActor(actorRef, pos, rot);
+    // Coalesced + frame-capped engine write (applied in Flush)
+    g_CoSyncTransformWriter.Submit(actorRef, pos, rot);
 }
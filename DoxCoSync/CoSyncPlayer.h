@@ -2,13 +2,15 @@
 
 #include <string>
 #include <cstdint>
-#include <deque>
 
 #include "NiTypes.h"
 #include "GameReferences.h"
 #include "LocalPlayerState.h"
 #include "Packets_EntityUpdate.h"
 #include "CoSyncEntityTypes.h"
+#include "CoSyncJitterBuffer.h"
+#include "CoSyncRingBuffer.h"
+#include "CoSyncBatchInterp.h"
 
 
 // -----------------------------------------------------------------------------
@@ -25,18 +27,31 @@ public:
     // ---------------------------------------------------------------------
     // Spawn (GAME THREAD ONLY)
     // ---------------------------------------------------------------------
-    bool SpawnInWorld(TESObjectREFR* anchor, TESNPC* npcBase);
+    // startHidden: actor stays disabled until the first UPDATE (HiddenOnSpawn)
+    bool SpawnInWorld(TESObjectREFR* anchor, TESNPC* npcBase, bool startHidden = false);
 
     // ---------------------------------------------------------------------
     // Network replication
     // ---------------------------------------------------------------------
-    void ApplyUpdate(const EntityUpdatePacket& u);
+    // recvLocalTime: CoSyncClock time the packet arrived (not when applied)
+    void ApplyUpdate(const EntityUpdatePacket& u, double recvLocalTime);
 
     // Apply cached transform if UPDATE arrived before spawn
     void ApplyPendingTransformIfAny();
 
-    // Per-frame interpolation (players only)
-    void TickSmoothing(double now);
+    // Per-frame interpolation (players only), driven by the manager:
+    //   PrepareSmoothing -> CoSyncBatchInterp::Run -> FinishSmoothing
+    bool PrepareSmoothing(double now, CoSyncInterpJob& out);
+    void FinishSmoothing(double now, NiPoint3 pos, const NiPoint3& rot);
+
+    // Adaptive playout delay / underflow metrics (players only)
+    const CoSyncJitterBuffer::Stats& GetPlayoutStats() const { return m_jitter.GetStats(); }
+
+    // How far past the newest sample the last frame rendered (0 = interpolating)
+    double GetExtrapolationSec() const { return m_extrapolating ? m_extrapolationSec : 0.0; }
+
+    // Enable a HiddenOnSpawn actor (no-op if already visible)
+    void RevealIfHidden();
 
 public:
     // ---------------------------------------------------------------------
@@ -68,6 +83,14 @@ public:
     Actor* actorRef = nullptr;
     bool   hasSpawned = false;
 
+    // Pool bookkeeping (actor is returned to CoSyncActorPool on despawn)
+    uint32_t spawnBaseFormID = 0;
+    bool     spawnedFromPool = false;
+
+    // HiddenOnSpawn: disabled until the first authoritative UPDATE
+    bool hiddenUntilUpdate = false;
+    bool hasReceivedUpdate = false;
+
     // ---------------------------------------------------------------------
     // Authoritative transform (HOST-OWNED ENTITIES ONLY)
     //
@@ -82,6 +105,7 @@ public:
     // Pending transform (UPDATE-before-spawn)
     // ---------------------------------------------------------------------
     bool     hasPendingTransform = false;
+    bool     pendingTeleport = false;      // snap restarts the playout clock
     NiPoint3 pendingPos{ 0.f, 0.f, 0.f };
     NiPoint3 pendingRot{ 0.f, 0.f, 0.f };
     NiPoint3 pendingVel{ 0.f, 0.f, 0.f };
@@ -93,11 +117,32 @@ public:
     {
         NiPoint3 pos{ 0.f, 0.f, 0.f };
         NiPoint3 rot{ 0.f, 0.f, 0.f };
+        NiPoint3 vel{ 0.f, 0.f, 0.f };
         float    scale = 1.0f;
         double   hostTime = 0.0; // authoritative host timestamp
     };
 
-    std::deque<NetTransform> m_tfBuffer;
+    // Inline history; capacity per entity type (CoSyncInterpolation)
+    static constexpr size_t kMaxHistory = 32;
+    CoSyncRingBuffer<NetTransform, kMaxHistory> m_tfBuffer;
+
+    // Playout clock (adaptive delay from measured jitter)
+    CoSyncJitterBuffer m_jitter;
+
+    // ---------------------------------------------------------------------
+    // Extrapolation / error correction (players only)
+    //
+    // Past the newest sample we dead-reckon (bounded). When the next real
+    // sample lands, the jump is captured as an offset that decays to zero
+    // instead of snapping.
+    // ---------------------------------------------------------------------
+    NiPoint3 m_lastRenderedPos{ 0.f, 0.f, 0.f };
+    NiPoint3 m_correction{ 0.f, 0.f, 0.f };
+    double   m_lastSmoothTime = 0.0;
+    double   m_extrapolationSec = 0.0;
+    bool     m_hasRendered = false;
+    bool     m_extrapolating = false;
+    bool     m_correctionPending = false;
 
     // ---------------------------------------------------------------------
     // Timing
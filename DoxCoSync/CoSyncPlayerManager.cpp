@@ -1,4 +1,6 @@
-﻿#include "CoSyncPlayerManager.h"
+﻿#define COSYNC_LOG_CHANNEL PlayerMgr
+
+#include "CoSyncPlayerManager.h"
 
 #include "CoSyncTransport.h"
 #include "CoSyncPlayer.h"
@@ -10,9 +12,17 @@
 #include "CoSyncEntityTypes.h"
 #include "CoSyncNet.h"
 #include "CoSyncGameAPI.h"
+#include "CoSyncActorPool.h"
+#include "CoSyncFormCache.h"
+#include "CoSyncTransformWriter.h"
+#include "CoSyncTrace.h"
+#include "CoSyncMetrics.h"
+#include "CoSyncClockSync.h"
+#include "CoSyncEntitySnapshot.h"
+#include "CoSyncFrameScheduler.h"
+#include "CoSyncFrameGovernor.h"
+#include "CoSyncClock.h"
 
-#define WIN32_LEAN_AND_MEAN
-#include <Windows.h>
 #include <algorithm>
 #include <vector>
 
@@ -30,21 +40,20 @@ static constexpr uint32_t kLocalRemotePlayerBaseFormID = 0x01001ECC;
 static constexpr uint32_t kDebugNpcEntityID = 36865;
 //static constexpr uint32_t kDebugNpcBaseFormID = 0x01001ECC; // your new CK form
 
+// Remote entity idle timeout
+static constexpr double kEntityTimeoutSec = 15.0;
 
 // -----------------------------------------------------------------------------
-// Time helper (QPC)
+// Frame budget throttling
 // -----------------------------------------------------------------------------
-static double NowSeconds()
+// Over the frame budget, remote entities past this distance are smoothed
+// only every CoSyncFrameGovernor::kFarSmoothingStride frames (~58 m)
+static constexpr float kThrottleNearDistance = 4096.0f;
+
+
+static void CollectPlayerManagerMetrics(CoSyncMetrics& metrics)
 {
-    static double s_freq = [] {
-        LARGE_INTEGER f{};
-        QueryPerformanceFrequency(&f);
-        return double(f.QuadPart);
-        }();
-
-    LARGE_INTEGER c{};
-    QueryPerformanceCounter(&c);
-    return double(c.QuadPart) / s_freq;
+    g_CoSyncPlayerManager.PublishMetrics(metrics);
 }
 
 // -----------------------------------------------------------------------------
@@ -71,27 +80,26 @@ static EntityCreatePacket MakeHostDebugNpcCreate(uint32_t localEntityID)
 
 // Finds a single client player proxy to snap to (first remote Player proxy found).
 static CoSyncPlayer* FindAnyRemoteClientPlayerProxy(
-    std::unordered_map<uint32_t, std::unique_ptr<CoSyncPlayer>>& playersByEntityID,
-    std::unordered_map<uint32_t, CoSyncEntityState>& statesByEntityID,
+    CoSyncEntityTable& entities,
     uint32_t localEntityID)
 {
-    for (auto& kv : playersByEntityID)
+    for (size_t row = 0; row < entities.Size(); ++row)
     {
-        CoSyncPlayer& pl = *kv.second;
-        if (!pl.hasSpawned || !pl.actorRef)
+        const uint8_t flags = entities.FlagsAt(row);
+        if (!(flags & CoSyncEntityTable::kHot_Spawned))
             continue;
 
-        if (pl.entityID == 0 || pl.entityID == localEntityID)
+        if (!(flags & CoSyncEntityTable::kHot_HasCreate))
             continue;
 
-        auto it = statesByEntityID.find(pl.entityID);
-        if (it == statesByEntityID.end() || !it->second.hasCreate)
+        const uint32_t entityID = entities.EntityIDAt(row);
+        if (entityID == 0 || entityID == localEntityID)
             continue;
 
-        if (it->second.lastCreate.type != CoSyncEntityType::Player)
+        if (entities.StateAt(row).lastCreate.type != CoSyncEntityType::Player)
             continue;
 
-        return &pl;
+        return &entities.PlayerAt(row);
     }
 
     return nullptr;
@@ -118,6 +126,7 @@ void CoSyncPlayerManager::EnqueueEntityCreate(const EntityCreatePacket& p)
     InboxItem item{};
     item.type = InboxItem::Type::Create;
     item.create = p;
+    item.recvTime = CoSyncClock::Now();
 
     m_inbox.push_back(item);
     LOG_INFO("[PlayerMgr] Enqueued CREATE entity=%u", p.entityID);
@@ -136,6 +145,7 @@ void CoSyncPlayerManager::EnqueueEntityUpdate(const EntityUpdatePacket& p)
     InboxItem item{};
     item.type = InboxItem::Type::Update;
     item.update = p;
+    item.recvTime = CoSyncClock::Now();
 
     m_inbox.push_back(item);
 }
@@ -154,6 +164,7 @@ void CoSyncPlayerManager::EnqueueEntityDestroy(const EntityDestroyPacket& p)
     InboxItem item{};
     item.type = InboxItem::Type::Destroy;
     item.destroy = p;
+    item.recvTime = CoSyncClock::Now();
 
     m_inbox.push_back(item);
     LOG_INFO("[PlayerMgr] Enqueued DESTROY entity=%u", p.entityID);
@@ -161,15 +172,33 @@ void CoSyncPlayerManager::EnqueueEntityDestroy(const EntityDestroyPacket& p)
 
 // -----------------------------------------------------------------------------
 // Inbox processing (GAME THREAD ONLY)
+//
+// CREATE / DESTROY / teleport are always applied. Other UPDATEs stop at the
+// frame governor's budget (after kMinUpdatesPerFrame) and wait in one carry
+// slot per entity; a newer UPDATE replaces the carried one in place.
+// Carried UPDATEs are older than anything in the inbox, so they go first,
+// and an entity with a carried UPDATE never has a newer one applied ahead
+// of it.
 // -----------------------------------------------------------------------------
 void CoSyncPlayerManager::ProcessInbox()
 {
+    COSYNC_TRACE_SCOPE("PlayerMgr.ProcessInbox");
+
+    static CoSyncGauge& s_inboxDepth = g_CoSyncMetrics.Gauge("playermgr.inbox.depth");
+
+    uint32_t applied = DrainDeferredUpdates();
+
     std::deque<InboxItem> inbox;
 
     {
         std::lock_guard<std::mutex> lk(m_inboxMutex);
+        s_inboxDepth.Set(static_cast<int64_t>(m_inbox.size()));
+
         if (m_inbox.empty())
+        {
+            g_CoSyncFrameGovernor.SetCarriedUpdates(m_deferredIndex.size());
             return;
+        }
 
         inbox.swap(m_inbox);
     }
@@ -179,12 +208,43 @@ void CoSyncPlayerManager::ProcessInbox()
         switch (item.type)
         {
         case InboxItem::Type::Create:
-            ProcessEntityCreate(item.create);
+            ProcessEntityCreate(item.create, item.recvTime);
             break;
 
         case InboxItem::Type::Update:
-            ProcessEntityUpdate(item.update);
+        {
+            const bool teleport = (item.update.flags & EntityUpdatePacket::Teleport) != 0;
+            auto carried = m_deferredIndex.find(item.update.entityID);
+
+            if (carried != m_deferredIndex.end())
+            {
+                // Newer state supersedes the carried one
+                if (teleport)
+                {
+                    m_deferredUpdates[carried->second].packet.entityID = 0;
+                    m_deferredIndex.erase(carried);
+                }
+                else
+                {
+                    m_deferredUpdates[carried->second] = DeferredUpdate{ item.update, item.recvTime };
+                    g_CoSyncFrameGovernor.CountCoalescedUpdate();
+                    break;
+                }
+            }
+            else if (!teleport &&
+                applied >= CoSyncFrameGovernor::kMinUpdatesPerFrame &&
+                !g_CoSyncFrameGovernor.HasBudget())
+            {
+                m_deferredIndex[item.update.entityID] = static_cast<uint32_t>(m_deferredUpdates.size());
+                m_deferredUpdates.push_back(DeferredUpdate{ item.update, item.recvTime });
+                g_CoSyncFrameGovernor.CountDeferredUpdate();
+                break;
+            }
+
+            ProcessEntityUpdate(item.update, item.recvTime);
+            ++applied;
             break;
+        }
 
         case InboxItem::Type::Destroy:
             ProcessEntityDestroy(item.destroy);
@@ -194,6 +254,55 @@ void CoSyncPlayerManager::ProcessInbox()
             break;
         }
     }
+
+    g_CoSyncFrameGovernor.SetCarriedUpdates(m_deferredIndex.size());
+}
+
+uint32_t CoSyncPlayerManager::DrainDeferredUpdates()
+{
+    if (m_deferredUpdates.empty())
+        return 0;
+
+    COSYNC_TRACE_SCOPE("PlayerMgr.DrainDeferred");
+
+    uint32_t applied = 0;
+    size_t taken = 0;
+
+    while (taken < m_deferredUpdates.size())
+    {
+        if (applied >= CoSyncFrameGovernor::kMinUpdatesPerFrame && !g_CoSyncFrameGovernor.HasBudget())
+            break;
+
+        // entityID 0 = dropped (DESTROY / teleport arrived after it)
+        const DeferredUpdate& d = m_deferredUpdates[taken++];
+        if (d.packet.entityID == 0)
+            continue;
+
+        ProcessEntityUpdate(d.packet, d.recvTime);
+        ++applied;
+    }
+
+    m_deferredUpdates.erase(m_deferredUpdates.begin(), m_deferredUpdates.begin() + taken);
+
+    // Slots shifted; rebuild (carry holds at most one UPDATE per entity)
+    m_deferredIndex.clear();
+    for (size_t i = 0; i < m_deferredUpdates.size(); ++i)
+    {
+        if (m_deferredUpdates[i].packet.entityID != 0)
+            m_deferredIndex[m_deferredUpdates[i].packet.entityID] = static_cast<uint32_t>(i);
+    }
+
+    return applied;
+}
+
+void CoSyncPlayerManager::DropDeferredUpdate(uint32_t entityID)
+{
+    auto it = m_deferredIndex.find(entityID);
+    if (it == m_deferredIndex.end())
+        return;
+
+    m_deferredUpdates[it->second].packet.entityID = 0;
+    m_deferredIndex.erase(it);
 }
 
 // -----------------------------------------------------------------------------
@@ -201,16 +310,13 @@ void CoSyncPlayerManager::ProcessInbox()
 // -----------------------------------------------------------------------------
 CoSyncEntityState& CoSyncPlayerManager::GetOrCreateState(uint32_t entityID)
 {
-    auto it = m_statesByEntityID.find(entityID);
-    if (it != m_statesByEntityID.end())
-        return it->second;
+    bool inserted = false;
+    const CoSyncEntityHandle h = m_entities.FindOrInsert(entityID, &inserted);
 
-    CoSyncEntityState st{};
-    st.entityID = entityID;
+    if (inserted)
+        LOG_INFO("[PlayerMgr] Created entity row entity=%u", entityID);
 
-    // C++14-safe (no structured bindings)
-    auto result = m_statesByEntityID.emplace(entityID, std::move(st));
-    return result.first->second;
+    return m_entities.StateAt(m_entities.RowOf(h));
 }
 
 // -----------------------------------------------------------------------------
@@ -218,24 +324,42 @@ CoSyncEntityState& CoSyncPlayerManager::GetOrCreateState(uint32_t entityID)
 // -----------------------------------------------------------------------------
 CoSyncPlayer& CoSyncPlayerManager::GetOrCreateByEntityID(uint32_t entityID)
 {
-    auto it = m_playersByEntityID.find(entityID);
-    if (it != m_playersByEntityID.end())
-        return *it->second;
+    bool inserted = false;
+    const CoSyncEntityHandle h = m_entities.FindOrInsert(entityID, &inserted);
 
-    auto player = std::make_unique<CoSyncPlayer>("Remote");
-    player->entityID = entityID;
+    if (inserted)
+        LOG_INFO("[PlayerMgr] Created CoSyncPlayer entity=%u", entityID);
 
-    CoSyncPlayer& ref = *player;
-    m_playersByEntityID.emplace(entityID, std::move(player));
+    return m_entities.PlayerAt(m_entities.RowOf(h));
+}
 
-    LOG_INFO("[PlayerMgr] Created CoSyncPlayer entity=%u", entityID);
-    return ref;
+void CoSyncPlayerManager::OnProxySpawned(uint32_t entityID)
+{
+    const size_t row = m_entities.RowOf(m_entities.Find(entityID));
+    if (row >= m_entities.Size())
+        return;
+
+    m_entities.RefreshHotColumns(row);
+}
+
+void CoSyncPlayerManager::OnSpawnTaskFinished(uint32_t entityID, double costMicros, bool spawned)
+{
+    std::lock_guard<std::mutex> lk(m_spawnMutex);
+    m_spawnScheduler.OnSpawnFinished(entityID, costMicros, spawned, CoSyncClock::Now());
+}
+
+void CoSyncPlayerManager::SetSpawnBudgetMicros(double micros)
+{
+    std::lock_guard<std::mutex> lk(m_spawnMutex);
+    m_spawnScheduler.SetBudgetMicros(micros);
+
+    LOG_INFO("[PlayerMgr] Spawn budget set to %.0fus/frame", m_spawnScheduler.BudgetMicros());
 }
 
 // -----------------------------------------------------------------------------
 // CREATE handling (NO SPAWN HERE; only queues)
 // -----------------------------------------------------------------------------
-void CoSyncPlayerManager::ProcessEntityCreate(const EntityCreatePacket& p)
+void CoSyncPlayerManager::ProcessEntityCreate(const EntityCreatePacket& p, double recvTime)
 {
     if (p.entityID == 0 || p.entityID == m_localEntityID)
         return;
@@ -244,7 +368,10 @@ void CoSyncPlayerManager::ProcessEntityCreate(const EntityCreatePacket& p)
     if (p.entityID == kDebugNpcEntityID && !CoSyncNet::IsHost())
         return;
 
-    CoSyncEntityState& st = GetOrCreateState(p.entityID);
+    const CoSyncEntityHandle h = m_entities.FindOrInsert(p.entityID);
+    const size_t row = m_entities.RowOf(h);
+
+    CoSyncEntityState& st = m_entities.StateAt(row);
 
     // Local ownership means: "this entity is controlled by me"
     st.isLocallyOwned = (p.ownerEntityID != 0 && p.ownerEntityID == m_localEntityID);
@@ -252,7 +379,11 @@ void CoSyncPlayerManager::ProcessEntityCreate(const EntityCreatePacket& p)
     // Always remember last CREATE
     st.lastCreate = p;
     st.hasCreate = true;
-    st.lastUpdateLocalTime = NowSeconds(); // treat CREATE as “alive” signal
+    st.lastUpdateLocalTime = CoSyncClock::FrameTime(); // treat CREATE as “alive” signal
+
+    // CREATE with no UPDATE must still expire
+    if (!g_CoSyncTimers.IsPending(st.timeoutTimer))
+        ArmEntityTimeout(st, kEntityTimeoutSec);
 
     // NPC detection
     st.isNPC = (p.type == CoSyncEntityType::NPC);
@@ -261,7 +392,7 @@ void CoSyncPlayerManager::ProcessEntityCreate(const EntityCreatePacket& p)
     st.hostAuthoritative = st.isNPC && CoSyncNet::IsHost();
 
     // Seed proxy metadata + authoritative transform immediately
-    CoSyncPlayer& player = GetOrCreateByEntityID(p.entityID);
+    CoSyncPlayer& player = m_entities.PlayerAt(row);
     player.ownerEntityID = p.ownerEntityID;
     player.createType = p.type;
     player.isRemoteControlled =
@@ -274,12 +405,19 @@ void CoSyncPlayerManager::ProcessEntityCreate(const EntityCreatePacket& p)
     player.pendingRot = p.spawnRot;
     player.hasPendingTransform = true;
 
+    m_entities.RefreshHotColumns(row);
+
     // Queue spawn only once (avoid duplicates)
     if (!st.spawnQueued)
     {
         st.spawnQueued = true;
+        // Validate the base form now so the spawn slot does no lookup work
+        g_CoSyncFormCache.Prefetch(
+            CoSyncSpawnTasks::ResolveBaseFormID(p.baseFormID, p.type));
+
+        // Spawn latency counts from receipt, not from inbox processing
         std::lock_guard<std::mutex> lk(m_spawnMutex);
-        m_pendingCreates.push_back(p);
+        m_spawnScheduler.Push(p, recvTime);
 
         LOG_INFO("[PlayerMgr] Queued CREATE for spawn entity=%u base=0x%08X",
             p.entityID, p.baseFormID);
@@ -289,7 +427,7 @@ void CoSyncPlayerManager::ProcessEntityCreate(const EntityCreatePacket& p)
 // -----------------------------------------------------------------------------
 // UPDATE handling (NO SPAWN EVER)
 // -----------------------------------------------------------------------------
-void CoSyncPlayerManager::ProcessEntityUpdate(const EntityUpdatePacket& u)
+void CoSyncPlayerManager::ProcessEntityUpdate(const EntityUpdatePacket& u, double recvTime)
 {
     if (u.entityID == 0 || u.entityID == m_localEntityID)
         return;
@@ -298,12 +436,16 @@ void CoSyncPlayerManager::ProcessEntityUpdate(const EntityUpdatePacket& u)
     if (u.entityID == kDebugNpcEntityID && !CoSyncNet::IsHost())
         return;
 
-    CoSyncEntityState& st = GetOrCreateState(u.entityID);
+    const size_t row = m_entities.RowOf(m_entities.FindOrInsert(u.entityID));
+    CoSyncEntityState& st = m_entities.StateAt(row);
 
     // Update “alive” time even if create hasn’t arrived yet (good for re-ordering)
-    st.lastUpdateLocalTime = NowSeconds();
+    st.lastUpdateLocalTime = CoSyncClock::FrameTime();
     st.lastUpdate = u;
 
+    if (!g_CoSyncTimers.IsPending(st.timeoutTimer))
+        ArmEntityTimeout(st, kEntityTimeoutSec);
+
     if (!st.hasCreate)
         return; // keep state only until CREATE arrives
 
@@ -311,8 +453,7 @@ void CoSyncPlayerManager::ProcessEntityUpdate(const EntityUpdatePacket& u)
     if (st.isNPC && CoSyncNet::IsHost())
         return;
 
-    CoSyncPlayer& player = GetOrCreateByEntityID(u.entityID);
-    player.ApplyUpdate(u);
+    m_entities.PlayerAt(row).ApplyUpdate(u, recvTime);
 }
 
 // -----------------------------------------------------------------------------
@@ -337,37 +478,44 @@ void CoSyncPlayerManager::DespawnEntity(uint32_t entityID, const char* reason)
 
     {
         std::lock_guard<std::mutex> lk(m_spawnMutex);
-        m_pendingCreates.erase(
-            std::remove_if(
-                m_pendingCreates.begin(),
-                m_pendingCreates.end(),
-                [entityID](const EntityCreatePacket& p)
-                {
-                    return p.entityID == entityID;
-                }),
-            m_pendingCreates.end());
+        m_spawnScheduler.Remove(entityID);
     }
 
+    // A carried UPDATE must not resurrect the row next frame
+    DropDeferredUpdate(entityID);
+
     g_CoSyncEntities.Remove(entityID);
 
-    auto itPlayer = m_playersByEntityID.find(entityID);
-    if (itPlayer != m_playersByEntityID.end())
+    const CoSyncEntityHandle h = m_entities.Find(entityID);
+    if (!h.IsValid())
+        return;
+
+    const size_t row = m_entities.RowOf(h);
+    CoSyncPlayer& pl = m_entities.PlayerAt(row);
+
+    g_CoSyncTimers.Cancel(m_entities.StateAt(row).timeoutTimer);
+
+    LOG_INFO("[PlayerMgr] Despawn entity=%u actor=%p (%s)",
+        entityID, pl.actorRef, reason);
+
+    // Disable + recycle instead of leaking the persistent reference
+    if (pl.actorRef)
     {
-        LOG_INFO("[PlayerMgr] Despawn entity=%u actor=%p (%s)",
-            entityID, itPlayer->second ? itPlayer->second->actorRef : nullptr, reason);
-        m_playersByEntityID.erase(itPlayer);
+        g_CoSyncTransformWriter.Forget(pl.actorRef);
+        g_CoSyncActorPool.Release(pl.spawnBaseFormID, pl.actorRef);
     }
 
-    auto itState = m_statesByEntityID.find(entityID);
-    if (itState != m_statesByEntityID.end())
-        m_statesByEntityID.erase(itState);
+    m_entities.Erase(h);
 }
 
 // -----------------------------------------------------------------------------
-// Deferred spawning (≤ 1 per tick — F4MP RULE)
+// Deferred spawning (frame-budgeted; ≥ 1 per tick unless the frame governor
+// is over budget, and then for at most kMaxSpawnDeferFrames in a row)
 // -----------------------------------------------------------------------------
 void CoSyncPlayerManager::PumpDeferredSpawns()
 {
+    COSYNC_TRACE_SCOPE("PlayerMgr.PumpDeferredSpawns");
+
     static bool s_warned = false;
 
     if (!CoSyncWorld::IsWorldReady())
@@ -380,83 +528,142 @@ void CoSyncPlayerManager::PumpDeferredSpawns()
         return;
     }
 
-    EntityCreatePacket p{};
+    NiPoint3 localPos(0.f, 0.f, 0.f);
+    const bool hasLocalPos = CoSyncWorld::GetLocalPlayerPosition(localPos);
+
+    m_spawnBatch.clear();
     {
         std::lock_guard<std::mutex> lk(m_spawnMutex);
-        if (m_pendingCreates.empty())
+        if (m_spawnScheduler.Empty())
             return;
 
-        p = m_pendingCreates.front();
-        m_pendingCreates.pop_front();
-    }
+        double budgetCap = -1.0;
+        if (g_CoSyncFrameGovernor.IsEnabled())
+        {
+            const double remaining = g_CoSyncFrameGovernor.RemainingMicros();
+
+            if (remaining <= 0.0 && m_spawnDeferFrames < CoSyncFrameGovernor::kMaxSpawnDeferFrames)
+            {
+                ++m_spawnDeferFrames;
+                g_CoSyncFrameGovernor.CountDeferredSpawnFrame();
+                return;
+            }
 
-    LOG_INFO("[PlayerMgr] Spawning entity=%u base=0x%08X",
-        p.entityID, p.baseFormID);
+            budgetCap = (remaining > 0.0) ? remaining : 0.0;
+        }
+        m_spawnDeferFrames = 0;
 
-    CoSyncSpawnTasks::EnqueueSpawn(
-        p.entityID,
-        p.baseFormID,
-        p.type,
-        p.spawnFlags,
-        p.spawnPos,
-        p.spawnRot
-    );
+        m_spawnScheduler.SelectForFrame(
+            hasLocalPos ? &localPos : nullptr,
+            m_entities,
+            m_spawnBatch,
+            budgetCap);
 
-    // Maintain ownership on proxy immediately (metadata; spawn occurs in task)
-    CoSyncPlayer& player = GetOrCreateByEntityID(p.entityID);
-    player.ownerEntityID = p.ownerEntityID;
+        // Spawn tasks run later in the engine frame; pay their estimated cost now
+        g_CoSyncFrameGovernor.Charge(
+            static_cast<double>(m_spawnBatch.size()) * m_spawnScheduler.EstimatedCostMicros());
+    }
+
+    for (const EntityCreatePacket& p : m_spawnBatch)
+    {
+        LOG_INFO("[PlayerMgr] Spawning entity=%u base=0x%08X",
+            p.entityID, p.baseFormID);
+
+        CoSyncSpawnTasks::EnqueueSpawn(
+            p.entityID,
+            p.baseFormID,
+            p.type,
+            p.spawnFlags,
+            p.spawnPos,
+            p.spawnRot
+        );
+
+        // Maintain ownership on proxy immediately (metadata; spawn occurs in task)
+        CoSyncPlayer& player = GetOrCreateByEntityID(p.entityID);
+        player.ownerEntityID = p.ownerEntityID;
+    }
 }
 
 // -----------------------------------------------------------------------------
 // Host NPC replication sender (F4MP-aligned)
+//
+// 20 Hz pass; per NPC the replicator skips unchanged transforms and scales
+// the rate by distance to the nearest remote player (heartbeat when idle).
 // -----------------------------------------------------------------------------
 void CoSyncPlayerManager::HostSendNpcUpdates(double now)
 {
+    COSYNC_TRACE_SCOPE("PlayerMgr.HostSendNpcUpdates");
+
+    // 20 Hz fixed step (Send phase); no-op off-host
     if (!CoSyncNet::IsHost() || !CoSyncNet::IsConnected())
         return;
 
-    static double s_lastSend = 0.0;
-    if ((now - s_lastSend) < 0.05) // 20 Hz
-        return;
-    s_lastSend = now;
+    m_npcReplicator.BeginPass(now);
 
-    for (auto& kv : m_playersByEntityID)
+    // Interested clients = remote player proxies (distance tiers)
+    for (size_t row = 0; row < m_entities.Size(); ++row)
     {
-        CoSyncPlayer& npc = *kv.second;
+        constexpr uint8_t kProxy =
+            CoSyncEntityTable::kHot_Spawned | CoSyncEntityTable::kHot_HasCreate;
 
-        if (npc.entityID == kDebugNpcEntityID)
+        if ((m_entities.FlagsAt(row) & kProxy) != kProxy)
             continue;
 
-        if (!npc.hasSpawned || !npc.actorRef)
+        const uint32_t entityID = m_entities.EntityIDAt(row);
+        if (entityID == m_localEntityID ||
+            m_entities.StateAt(row).lastCreate.type != CoSyncEntityType::Player)
             continue;
 
-        auto it = m_statesByEntityID.find(npc.entityID);
-        if (it == m_statesByEntityID.end() || !it->second.hasCreate)
-            continue;
+        NiPoint3 pos(0.f, 0.f, 0.f);
+        NiPoint3 rot(0.f, 0.f, 0.f);
+
+        if (CoSyncGameAPI::GetActorWorldTransform(m_entities.ActorAt(row), pos, rot))
+            m_npcReplicator.AddObserver(pos);
+    }
 
-        const CoSyncEntityState& st = it->second;
+    // Hot-column filter: spawned + CREATE'd + host-authoritative NPC
+    constexpr uint8_t kWanted =
+        CoSyncEntityTable::kHot_Spawned |
+        CoSyncEntityTable::kHot_HasCreate |
+        CoSyncEntityTable::kHot_NPC |
+        CoSyncEntityTable::kHot_HostAuthoritative;
 
-        if (st.lastCreate.type != CoSyncEntityType::NPC)
+    for (size_t row = 0; row < m_entities.Size(); ++row)
+    {
+        if ((m_entities.FlagsAt(row) & kWanted) != kWanted)
             continue;
 
-        if (!st.hostAuthoritative)
+        const uint32_t entityID = m_entities.EntityIDAt(row);
+        if (entityID == kDebugNpcEntityID)
             continue;
 
+        CoSyncEntityState& st = m_entities.StateAt(row);
+
         if (!EntityCreatePacket::HasFlag(st.lastCreate.spawnFlags, EntityCreatePacket::RemoteControlled))
             continue;
 
         NiPoint3 pos(0.f, 0.f, 0.f);
         NiPoint3 rot(0.f, 0.f, 0.f);
 
-        if (!CoSyncGameAPI::GetActorWorldTransform(npc.actorRef, pos, rot))
+        if (!CoSyncGameAPI::GetActorWorldTransform(m_entities.ActorAt(row), pos, rot))
             continue;
 
+        // Unchanged / not yet due for its distance tier
+        if (!m_npcReplicator.ShouldSend(st.npcSend, pos, rot, now))
+        {
+            m_npcReplicator.MarkSkipped();
+            continue;
+        }
+
+        m_npcReplicator.MarkSent(st.npcSend, pos, rot, now);
+
         EntityUpdatePacket u{};
-        u.entityID = npc.entityID;
+        u.entityID = entityID;
         u.pos = pos;
         u.rot = rot;
         u.vel = NiPoint3(0.f, 0.f, 0.f);
-        u.timestamp = now;
+        u.timestamp = now;   // host clock == session timeline
+        u.flags |= EntityUpdatePacket::HostTime;
 
         CoSyncTransport::Send(SerializeEntityUpdate(u));
     }
@@ -466,24 +673,22 @@ void CoSyncPlayerManager::HostSendNpcUpdates(double now)
 // Host-only debug NPC hard snap (NO SMOOTHING, NO INTERP, NO VELOCITY)
 // -----------------------------------------------------------------------------
 static void HostDebugNpcHardSnap(
-    std::unordered_map<uint32_t, std::unique_ptr<CoSyncPlayer>>& playersByEntityID,
-    std::unordered_map<uint32_t, CoSyncEntityState>& statesByEntityID,
+    CoSyncEntityTable& entities,
     uint32_t localEntityID)
 {
     // Find a remote client player proxy to follow
     CoSyncPlayer* remotePlayer = FindAnyRemoteClientPlayerProxy(
-        playersByEntityID,
-        statesByEntityID,
+        entities,
         localEntityID);
 
     if (!remotePlayer || !remotePlayer->actorRef)
         return;
 
-    auto itNpc = playersByEntityID.find(kDebugNpcEntityID);
-    if (itNpc == playersByEntityID.end())
+    const size_t npcRow = entities.RowOf(entities.Find(kDebugNpcEntityID));
+    if (npcRow >= entities.Size())
         return;
 
-    CoSyncPlayer& npc = *itNpc->second;
+    CoSyncPlayer& npc = entities.PlayerAt(npcRow);
 
     // Absolute guards: debug NPC only, must be spawned, must have actor
     if (npc.entityID != kDebugNpcEntityID)
@@ -500,13 +705,13 @@ static void HostDebugNpcHardSnap(
     npc.authoritativePos = clientPos;
     npc.authoritativeRot = clientRot;
 
-    CoSyncGameAPI::PositionRemoteActor(npc.actorRef, clientPos, clientRot);
+    g_CoSyncTransformWriter.Write(npc.actorRef, clientPos, clientRot);
 }
 
 // -----------------------------------------------------------------------------
-// Per-frame tick (GAME THREAD)
+// Per-frame phases (GAME THREAD, driven by g_CoSyncFrameScheduler)
 // -----------------------------------------------------------------------------
-void CoSyncPlayerManager::Tick()
+void CoSyncPlayerManager::TickApply()
 {
     ProcessInbox();
 
@@ -522,79 +727,242 @@ void CoSyncPlayerManager::Tick()
             const EntityCreatePacket dbgCreate =
                 MakeHostDebugNpcCreate(m_localEntityID);
 
-            ProcessEntityCreate(dbgCreate); // queues spawn only
+            ProcessEntityCreate(dbgCreate, CoSyncClock::FrameTime()); // queues spawn only
         }
     }
+}
 
+void CoSyncPlayerManager::TickSpawn()
+{
     PumpDeferredSpawns();
 
-    const double now = NowSeconds();
-    HandleTimeouts(now);
+    // Keep a few disabled proxies warm while in a session (≤ 1 PlaceAtMe per tick)
+    if (CoSyncNet::IsConnected() && CoSyncWorld::IsWorldReady())
+        g_CoSyncActorPool.PumpPrewarm();
+    else if (!CoSyncNet::IsConnected() && g_CoSyncActorPool.PooledCount())
+        g_CoSyncActorPool.DeleteAll();   // session over; don't carry them into a save
+}
 
-    // Host-only: replicate real NPC transforms
-    HostSendNpcUpdates(now);
+void CoSyncPlayerManager::TickFlush(double now)
+{
+    if (!m_metricsRegistered)
+    {
+        m_metricsRegistered = true;
+        g_CoSyncMetrics.AddCollector(&CollectPlayerManagerMetrics);
+    }
 
-    // Host-only: once debug NPC is spawned, DISABLE AI on host 
-    if (CoSyncNet::IsHost() && CoSyncNet::IsConnected())
+    // Issue this frame's coalesced engine moves (capped, round-robin)
     {
-       
+        COSYNC_TRACE_SCOPE("TransformWriter.Flush");
+        g_CoSyncTransformWriter.Flush();
+    }
+
+    // Publish this tick's table for other threads (overlay, Papyrus)
+    if (CoSyncEntitySnapshot* snap = g_CoSyncEntitySnapshots.BeginWrite())
+    {
+        COSYNC_TRACE_SCOPE("PlayerMgr.PublishSnapshot");
+        snap->Build(m_entities, ++m_snapshotFrame, now);
+        g_CoSyncEntitySnapshots.Publish();
+    }
+
+    // 1 Hz snapshot + periodic dump (timer wheel)
+    g_CoSyncMetrics.Tick();
+}
+
+// -----------------------------------------------------------------------------
+// Metrics collector (snapshot timer, GAME THREAD)
+//
+// Existing Stats structs are published as gauges here rather than
+// instrumenting their owners; durations are in microseconds.
+// -----------------------------------------------------------------------------
+void CoSyncPlayerManager::PublishMetrics(CoSyncMetrics& metrics)
+{
+    metrics.Gauge("playermgr.entities").Set(static_cast<int64_t>(m_entities.Size()));
+    metrics.Gauge("playermgr.smoothing.batch").Set(static_cast<int64_t>(m_interpRows.size()));
+    metrics.Gauge("snapshot.skipped").Set(static_cast<int64_t>(g_CoSyncEntitySnapshots.SkippedCount()));
 
-        
+    // Spawn scheduler
+    {
+        std::lock_guard<std::mutex> lk(m_spawnMutex);
 
-        
+        const CoSyncHistogram& latency = m_spawnScheduler.LatencyHistogram();
+        const CoSyncHistogram& cost = m_spawnScheduler.CostHistogram();
+
+        metrics.Gauge("spawn.queue").Set(static_cast<int64_t>(m_spawnScheduler.PendingCount()));
+        metrics.Gauge("spawn.latency_p50_us").Set(static_cast<int64_t>(latency.Percentile(0.50)));
+        metrics.Gauge("spawn.latency_p99_us").Set(static_cast<int64_t>(latency.Percentile(0.99)));
+        metrics.Gauge("spawn.cost_p50_us").Set(static_cast<int64_t>(cost.Percentile(0.50)));
+        metrics.Gauge("spawn.cost_p99_us").Set(static_cast<int64_t>(cost.Percentile(0.99)));
     }
 
-    for (auto& kv : m_playersByEntityID)
+    // Host NPC replication
+    const CoSyncNpcReplicator::Stats& npc = m_npcReplicator.GetStats();
+    metrics.Gauge("npc.sent_per_sec").Set(npc.sentPerSec);
+    metrics.Gauge("npc.skipped_per_sec").Set(npc.skippedPerSec);
+
+    // Engine transform writes (last frame)
+    const CoSyncTransformWriter::Stats& xform = g_CoSyncTransformWriter.GetStats();
+    metrics.Gauge("xform.frame_issued").Set(xform.frameIssued);
+    metrics.Gauge("xform.frame_skipped").Set(xform.frameSkipped);
+    metrics.Gauge("xform.frame_deferred").Set(xform.frameDeferred);
+
+    // Actor pool / form cache (lifetime totals)
+    const CoSyncActorPool::Stats& pool = g_CoSyncActorPool.GetStats();
+    metrics.Gauge("pool.acquires").Set(static_cast<int64_t>(pool.acquires));
+    metrics.Gauge("pool.reuses").Set(static_cast<int64_t>(pool.reuses));
+    metrics.Gauge("pool.create_failures").Set(static_cast<int64_t>(pool.createFailures));
+
+    const CoSyncFormCache::Stats forms = g_CoSyncFormCache.GetStats();
+    metrics.Gauge("formcache.hits").Set(static_cast<int64_t>(forms.hits));
+    metrics.Gauge("formcache.misses").Set(static_cast<int64_t>(forms.misses));
+
+    // Host clock estimate
+    const CoSyncClockSync::Stats clock = CoSyncClockSync::GetStats();
+    metrics.Gauge("clock.synced").Set(clock.synced ? 1 : 0);
+    metrics.Gauge("clock.offset_us").Set(static_cast<int64_t>(clock.offsetSec * 1e6));
+    metrics.Gauge("clock.best_rtt_us").Set(static_cast<int64_t>(clock.bestRttSec * 1e6));
+    metrics.Gauge("clock.drift_ppm").Set(static_cast<int64_t>(clock.driftPpm));
+
+    // Playout buffers: worst remote player
+    double maxDelaySec = 0.0;
+    double maxJitterSec = 0.0;
+    int64_t underflows = 0;
+
+    for (size_t row = 0; row < m_entities.Size(); ++row)
     {
-        CoSyncPlayer& ent = *kv.second;
+        const uint8_t flags = m_entities.FlagsAt(row);
+        if (!(flags & CoSyncEntityTable::kHot_Spawned) || (flags & CoSyncEntityTable::kHot_NPC))
+            continue;
+
+        const CoSyncJitterBuffer::Stats& playout = m_entities.PlayerAt(row).GetPlayoutStats();
+        maxDelaySec = (std::max)(maxDelaySec, playout.delaySec);
+        maxJitterSec = (std::max)(maxJitterSec, playout.jitterSec);
+        underflows += playout.underflows;
+    }
+
+    metrics.Gauge("playout.delay_max_us").Set(static_cast<int64_t>(maxDelaySec * 1e6));
+    metrics.Gauge("playout.jitter_max_us").Set(static_cast<int64_t>(maxJitterSec * 1e6));
+    metrics.Gauge("playout.underflows").Set(underflows);
+}
 
-        if (!ent.hasSpawned)
+// -----------------------------------------------------------------------------
+// Remote smoothing (GAME THREAD)
+// -----------------------------------------------------------------------------
+void CoSyncPlayerManager::TickSmoothing(double now)
+{
+    COSYNC_TRACE_SCOPE("PlayerMgr.TickSmoothing");
+
+    // Single pass over the hot flag column; no per-entity hash lookups.
+    // Smoothing inputs are gathered here and blended in one batch below.
+    m_interpBatch.Clear();
+    m_interpRows.clear();
+
+    // Over the frame budget: far entities hold their pose on most frames
+    // (smoothing is time-based, so they catch up on the next pass)
+    NiPoint3 localPos(0.f, 0.f, 0.f);
+    const bool throttle =
+        !g_CoSyncFrameGovernor.HasBudget() &&
+        CoSyncWorld::GetLocalPlayerPosition(localPos);
+
+    const uint64_t frame = g_CoSyncFrameScheduler.FrameIndex();
+    uint32_t skipped = 0;
+
+    for (size_t row = 0; row < m_entities.Size(); ++row)
+    {
+        const uint8_t flags = m_entities.FlagsAt(row);
+        if (!(flags & CoSyncEntityTable::kHot_Spawned))
             continue;
 
+        // First-spawn / pending snaps are never deferred
+        CoSyncPlayer& ent = m_entities.PlayerAt(row);
         ent.ApplyPendingTransformIfAny();
 
         // NPCs must NEVER be smoothed/interpolated
-        auto it = m_statesByEntityID.find(ent.entityID);
-        if (it != m_statesByEntityID.end() && it->second.hasCreate)
+        if ((flags & CoSyncEntityTable::kHot_HasCreate) &&
+            (flags & CoSyncEntityTable::kHot_NPC))
+            continue;
+
+        if (throttle && (row + frame) % CoSyncFrameGovernor::kFarSmoothingStride != 0)
         {
-            if (it->second.lastCreate.type == CoSyncEntityType::NPC)
+            const float dx = ent.authoritativePos.x - localPos.x;
+            const float dy = ent.authoritativePos.y - localPos.y;
+            const float dz = ent.authoritativePos.z - localPos.z;
+
+            if (dx * dx + dy * dy + dz * dz > kThrottleNearDistance * kThrottleNearDistance)
+            {
+                ++skipped;
                 continue;
+            }
         }
 
-        ent.TickSmoothing(now);
+        CoSyncInterpJob job;
+        if (!ent.PrepareSmoothing(now, job))
+            continue;
+
+        m_interpBatch.Add(job);
+        m_interpRows.push_back(row);
     }
-}
 
-void CoSyncPlayerManager::HandleTimeouts(double now)
-{
-    constexpr double kEntityTimeoutSec = 15.0;
+    g_CoSyncFrameGovernor.CountSkippedSmoothing(skipped);
 
-    std::vector<uint32_t> expired;
-    expired.reserve(m_statesByEntityID.size());
+    m_interpBatch.Run();
 
-    for (const auto& kv : m_statesByEntityID)
+    // Only the engine writes stay per entity
+    for (size_t i = 0; i < m_interpRows.size(); ++i)
     {
-        const CoSyncEntityState& st = kv.second;
+        m_entities.PlayerAt(m_interpRows[i]).FinishSmoothing(
+            now, m_interpBatch.Position(i), m_interpBatch.Rotation(i));
+    }
+}
 
-        if (st.entityID == 0 || st.entityID == m_localEntityID)
-            continue;
+// -----------------------------------------------------------------------------
+// Entity idle timeouts (timer wheel)
+//
+// UPDATEs only refresh lastUpdateLocalTime. When the timer fires it checks
+// the real idle time and either despawns or re-arms for the remainder, so
+// per-tick cost is O(expired timers), not O(entities).
+// -----------------------------------------------------------------------------
+void CoSyncPlayerManager::EntityTimeoutThunk(void* ctx, uint64_t entityID, double now)
+{
+    static_cast<CoSyncPlayerManager*>(ctx)->OnEntityTimeout(static_cast<uint32_t>(entityID), now);
+}
 
-        if (st.entityID == kDebugNpcEntityID)
-            continue;
+void CoSyncPlayerManager::ArmEntityTimeout(CoSyncEntityState& st, double delaySec)
+{
+    st.timeoutTimer = g_CoSyncTimers.ScheduleIn(delaySec, &EntityTimeoutThunk, this, st.entityID);
+}
 
-        if (!st.isLocallyOwned)
-            continue;
+void CoSyncPlayerManager::OnEntityTimeout(uint32_t entityID, double now)
+{
+    COSYNC_TRACE_SCOPE("PlayerMgr.HandleTimeout");
 
-        if (st.isNPC && CoSyncNet::IsHost())
-            continue;
+    const size_t row = m_entities.RowOf(m_entities.Find(entityID));
+    if (row >= m_entities.Size())
+        return;
 
-        if (st.lastUpdateLocalTime <= 0.0)
-            continue;
+    CoSyncEntityState& st = m_entities.StateAt(row);
+
+    const bool eligible =
+        st.entityID != 0 &&
+        st.entityID != m_localEntityID &&
+        st.entityID != kDebugNpcEntityID &&
+        st.isLocallyOwned &&
+        !(st.isNPC && CoSyncNet::IsHost()) &&
+        st.lastUpdateLocalTime > 0.0;
 
-        if ((now - st.lastUpdateLocalTime) > kEntityTimeoutSec)
-            expired.push_back(st.entityID);
+    // Ownership / role can change later; check again after a full period
+    if (!eligible)
+    {
+        ArmEntityTimeout(st, kEntityTimeoutSec);
+        return;
     }
 
-    for (uint32_t entityID : expired)
+    const double idle = now - st.lastUpdateLocalTime;
+    if (idle > kEntityTimeoutSec)
+    {
         DespawnEntity(entityID, "timeout");
+        return;
+    }
+
+    ArmEntityTimeout(st, kEntityTimeoutSec - idle);
 }
@@ -1,15 +1,19 @@
 ﻿#pragma once
 
 #include <cstdint>
-#include <unordered_map>
 #include <deque>
 #include <mutex>
-#include <memory>
+#include <vector>
 
 #include "Packets_EntityDestroy.h"
 #include "Packets_EntityCreate.h"
 #include "Packets_EntityUpdate.h"
 #include "CoSyncEntityState.h"
+#include "CoSyncEntityTable.h"
+#include "CoSyncSpawnScheduler.h"
+#include "CoSyncNpcReplication.h"
+#include "CoSyncBatchInterp.h"
+#include "CoSyncFlatMap.h"
 
 // -----------------------------------------------------------------------------
 // InboxItem
@@ -29,9 +33,11 @@ struct InboxItem
     EntityCreatePacket  create{};
     EntityUpdatePacket  update{};
     EntityDestroyPacket destroy{};
-};
 
-class CoSyncPlayer;
+    // CoSyncClock::Now() when the packet was enqueued (network thread);
+    // receipt time for jitter and latency, however late it is applied
+    double recvTime = 0.0;
+};
 
 // -----------------------------------------------------------------------------
 // CoSyncPlayerManager
@@ -40,9 +46,13 @@ class CoSyncPlayer;
 //
 //   ✔ Owns ALL remote entity proxies (CoSyncPlayer)
 //   ✔ Owns ALL remote entity state (CoSyncEntityState)
+//     (both stored row-aligned in one CoSyncEntityTable)
 //   ✔ Buffers CREATE / UPDATE / DESTROY packets from networking
 //   ✔ Applies everything on the GAME THREAD only
-//   ✔ Spawns ≤ 1 entity per tick (CRITICAL F4MP RULE)
+//   ✔ Spawns within a per-frame time budget, ≥ 1 per tick
+//     (players first, then nearest, then oldest)
+//   ✔ Defers UPDATEs, far smoothing and spawns past the frame governor's
+//     budget; never CREATE, DESTROY or teleport
 //
 // HARD RULES (DO NOT BREAK):
 //   - UPDATE packets NEVER cause spawning
@@ -50,6 +60,8 @@ class CoSyncPlayer;
 //   - Local player entity is NEVER proxied
 //   - NPC authority is HOST-ONLY
 // -----------------------------------------------------------------------------
+class CoSyncMetrics;
+
 class CoSyncPlayerManager
 {
 public:
@@ -60,14 +72,27 @@ public:
     void EnqueueEntityUpdate(const EntityUpdatePacket& p);
     void EnqueueEntityDestroy(const EntityDestroyPacket& p);
 
-    // Host-only NPC authority path (debug + future AI)
+    // Host-only NPC authority path (debug + future AI);
+    // one replication pass per call (scheduler Send phase, fixed 20 Hz)
     void HostSendNpcUpdates(double now);
 
+    static constexpr double kNpcSendIntervalSec = 0.05;
+
+    // Sent/skipped NPC update counters (host)
+    const CoSyncNpcReplicator::Stats& GetNpcReplicationStats() const { return m_npcReplicator.GetStats(); }
+
     // ---------------------------------------------------------------------
-    // Game-thread processing
+    // Game-thread processing (one call per scheduler phase per frame)
     // ---------------------------------------------------------------------
     void ProcessInbox();
-    void Tick();
+
+    void TickApply();                 // Apply: inbox -> entity state
+    void TickSpawn();                 // Spawn: budgeted spawns, pool prewarm
+    void TickSimulate(double now) { TickSmoothing(now); }  // Simulate
+    void TickFlush(double now);       // Flush: engine writes, snapshot, metrics
+
+    // Metrics collector: publishes subsystem Stats as gauges (snapshot only)
+    void PublishMetrics(CoSyncMetrics& metrics);
 
     // ---------------------------------------------------------------------
     // Identity
@@ -77,32 +102,62 @@ public:
 
     // ---------------------------------------------------------------------
     // Proxy (world) registry
+    //
+    // NOTE: returned references are only valid until the next entity is
+    // created or despawned (table rows are packed). Hold handles instead.
     // ---------------------------------------------------------------------
     CoSyncPlayer& GetOrCreateByEntityID(uint32_t entityID);
 
+    // Called by the spawn task once the proxy has a live actor
+    void OnProxySpawned(uint32_t entityID);
+
+    // Called by the spawn task when it finishes (success or failure)
+    void OnSpawnTaskFinished(uint32_t entityID, double costMicros, bool spawned);
+
+    // ---------------------------------------------------------------------
+    // Spawn scheduling
+    // ---------------------------------------------------------------------
+    void SetSpawnBudgetMicros(double micros);
+    const CoSyncSpawnScheduler& GetSpawnScheduler() const { return m_spawnScheduler; }
+
     // ---------------------------------------------------------------------
     // State registry (network-only)
     // ---------------------------------------------------------------------
     CoSyncEntityState& GetOrCreateState(uint32_t entityID);
 
-    // Optional: readonly accessors (overlay / debug / tooling)
-    const std::unordered_map<uint32_t, CoSyncEntityState>&
-        GetStates() const { return m_statesByEntityID; }
+    // Stable handle for an entity (invalid handle if unknown)
+    CoSyncEntityHandle GetHandle(uint32_t entityID) const { return m_entities.Find(entityID); }
+
+    // Live table: GAME THREAD ONLY. Other threads (overlay, Papyrus)
+    // read g_CoSyncEntitySnapshots, published by TickFlush() every frame.
+    const CoSyncEntityTable& GetEntities() const { return m_entities; }
 
 private:
     // ---------------------------------------------------------------------
     // Internal processing (GAME THREAD ONLY)
     // ---------------------------------------------------------------------
-    void ProcessEntityCreate(const EntityCreatePacket& p);
-    void ProcessEntityUpdate(const EntityUpdatePacket& u);
+    void ProcessEntityCreate(const EntityCreatePacket& p, double recvTime);
+    void ProcessEntityUpdate(const EntityUpdatePacket& u, double recvTime);
     void ProcessEntityDestroy(const EntityDestroyPacket& d);
 
     void DespawnEntity(uint32_t entityID, const char* reason);
-    void HandleTimeouts(double now);
 
-    // Deferred spawn pump (≤ 1 per tick)
+    // Idle timeouts (timer wheel; UPDATEs never touch the wheel)
+    void ArmEntityTimeout(CoSyncEntityState& st, double delaySec);
+    void OnEntityTimeout(uint32_t entityID, double now);
+
+    static void EntityTimeoutThunk(void* ctx, uint64_t entityID, double now);
+
+    // Deferred spawn pump (frame-budgeted, ≥ 1 per tick within the governor)
     void PumpDeferredSpawns();
 
+    // Governor carry-over for UPDATEs (returns UPDATEs applied)
+    uint32_t DrainDeferredUpdates();
+    void DropDeferredUpdate(uint32_t entityID);
+
+    // Gather -> batch blend -> per-entity submit for remote proxies
+    void TickSmoothing(double now);
+
 private:
     // ---------------------------------------------------------------------
     // Network inbox (THREAD-SAFE)
@@ -114,22 +169,46 @@ private:
     // Deferred CREATE queue (spawn-only, GAME THREAD)
     // ---------------------------------------------------------------------
     std::mutex m_spawnMutex;
-    std::deque<EntityCreatePacket> m_pendingCreates;
+    CoSyncSpawnScheduler m_spawnScheduler;
+    std::vector<EntityCreatePacket> m_spawnBatch; // reused per frame
+    uint32_t m_spawnDeferFrames = 0;              // consecutive governor deferrals
 
     // ---------------------------------------------------------------------
-    // Remote entity registry (world proxies)
+    // UPDATEs carried past the frame budget (GAME THREAD)
+    // Oldest first, one per entity; entityID 0 marks a dropped slot.
     // ---------------------------------------------------------------------
-    std::unordered_map<uint32_t, std::unique_ptr<CoSyncPlayer>> m_playersByEntityID;
+    struct DeferredUpdate
+    {
+        EntityUpdatePacket packet{};
+        double recvTime = 0.0;
+    };
+
+    std::vector<DeferredUpdate>       m_deferredUpdates;
+    CoSyncFlatMap<uint32_t, uint32_t> m_deferredIndex;  // entityID -> slot
+
+    // Change detection + distance-scaled rates per NPC
+    CoSyncNpcReplicator m_npcReplicator;
+
+    // ---------------------------------------------------------------------
+    // Batched smoothing (SoA columns + table rows, reused per frame)
+    // ---------------------------------------------------------------------
+    CoSyncBatchInterp   m_interpBatch;
+    std::vector<size_t> m_interpRows;
 
     // ---------------------------------------------------------------------
-    // Remote state registry (network-only)
+    // Remote entity registry (world proxies + network state, row-aligned)
     // ---------------------------------------------------------------------
-    std::unordered_map<uint32_t, CoSyncEntityState> m_statesByEntityID;
+    CoSyncEntityTable m_entities;
 
     // ---------------------------------------------------------------------
     // Local authoritative entity ID
     // ---------------------------------------------------------------------
     uint32_t m_localEntityID = 0;
+
+    bool m_metricsRegistered = false;
+
+    // Frame number of the last published entity snapshot
+    uint64_t m_snapshotFrame = 0;
 };
 
 // Global singleton
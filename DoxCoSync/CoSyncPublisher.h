@@ -0,0 +1,165 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// -----------------------------------------------------------------------------
+// CoSyncPublisher<T, Buffers>
+//
+// RCU-style publication of a value built by ONE writer thread and read by
+// any number of threads without locks.
+//
+//   Writer (game thread):
+//     T* next = pub.BeginWrite();   // nullptr if every spare buffer is held
+//     if (next) { fill *next; pub.Publish(); }
+//
+//   Reader (any thread):
+//     auto snap = pub.Acquire();    // pins the current buffer
+//     if (snap) use(*snap);         // stays consistent until snap dies
+//
+// Buffers are reference counted. The writer only reuses a buffer that is
+// neither published nor pinned, so readers never see a partial write and
+// the writer never waits (a frame is skipped if all spares are pinned).
+// Acquire() retries only when a publish lands between its two loads.
+//
+// Buffers keep their allocations between frames (reused, not rebuilt).
+// -----------------------------------------------------------------------------
+template <class T, size_t Buffers = 4>
+class CoSyncPublisher
+{
+    static_assert(Buffers >= 3, "CoSyncPublisher needs at least three buffers");
+
+public:
+    static constexpr uint32_t kNone = 0xFFFFFFFFu;
+
+    class ReadHandle
+    {
+    public:
+        ReadHandle() = default;
+
+        ReadHandle(ReadHandle&& other)
+            : m_owner(other.m_owner)
+            , m_index(other.m_index)
+        {
+            other.m_owner = nullptr;
+        }
+
+        ReadHandle& operator=(ReadHandle&& other)
+        {
+            if (this != &other)
+            {
+                Release();
+                m_owner = other.m_owner;
+                m_index = other.m_index;
+                other.m_owner = nullptr;
+            }
+            return *this;
+        }
+
+        ~ReadHandle() { Release(); }
+
+        ReadHandle(const ReadHandle&) = delete;
+        ReadHandle& operator=(const ReadHandle&) = delete;
+
+        explicit operator bool() const { return m_owner != nullptr; }
+
+        const T& operator*() const { return m_owner->m_buffers[m_index].value; }
+        const T* operator->() const { return &m_owner->m_buffers[m_index].value; }
+
+    private:
+        friend class CoSyncPublisher;
+
+        ReadHandle(const CoSyncPublisher* owner, uint32_t index)
+            : m_owner(owner)
+            , m_index(index)
+        {
+        }
+
+        void Release()
+        {
+            if (m_owner)
+            {
+                m_owner->m_buffers[m_index].refs.fetch_sub(1, std::memory_order_release);
+                m_owner = nullptr;
+            }
+        }
+
+        const CoSyncPublisher* m_owner = nullptr;
+        uint32_t m_index = 0;
+    };
+
+    // ---------------------------------------------------------------------
+    // Writer (single thread)
+    // ---------------------------------------------------------------------
+    T* BeginWrite()
+    {
+        const uint32_t published = m_published.load(std::memory_order_relaxed);
+
+        for (uint32_t n = 1; n <= Buffers; ++n)
+        {
+            const uint32_t i = (m_lastWritten + n) % Buffers;
+            if (i == published)
+                continue;
+
+            if (m_buffers[i].refs.load(std::memory_order_seq_cst) == 0)
+            {
+                m_writing = i;
+                return &m_buffers[i].value;
+            }
+        }
+
+        m_writing = kNone;
+        ++m_skipped;
+        return nullptr;
+    }
+
+    void Publish()
+    {
+        if (m_writing == kNone)
+            return;
+
+        m_lastWritten = m_writing;
+        m_writing = kNone;
+        m_published.store(m_lastWritten, std::memory_order_seq_cst);
+    }
+
+    // Frames skipped because every spare buffer was pinned (diagnostics)
+    uint64_t SkippedCount() const { return m_skipped; }
+
+    // ---------------------------------------------------------------------
+    // Readers (any thread)
+    // ---------------------------------------------------------------------
+    ReadHandle Acquire() const
+    {
+        for (;;)
+        {
+            const uint32_t i = m_published.load(std::memory_order_seq_cst);
+            if (i == kNone)
+                return ReadHandle();
+
+            m_buffers[i].refs.fetch_add(1, std::memory_order_seq_cst);
+
+            // Still current: the writer cannot pick it until we release
+            if (m_published.load(std::memory_order_seq_cst) == i)
+                return ReadHandle(this, i);
+
+            m_buffers[i].refs.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+private:
+    struct Buffer
+    {
+        mutable std::atomic<uint32_t> refs{ 0 };
+        T value{};
+    };
+
+    Buffer m_buffers[Buffers];
+    std::atomic<uint32_t> m_published{ kNone };
+
+    // Writer-only
+    uint32_t m_writing = kNone;
+    uint32_t m_lastWritten = 0;
+    uint64_t m_skipped = 0;
+};
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// -----------------------------------------------------------------------------
+// CoSyncRingBuffer<T, MaxCapacity>
+//
+// Fixed-capacity, inline (no heap) ring of time-ordered samples.
+//
+//   - MaxCapacity is a compile-time power of two (storage size)
+//   - SetCapacity() picks a smaller power of two at runtime (per entity
+//     type); pushing past capacity overwrites the oldest sample
+//   - Index 0 = oldest, Size()-1 = newest
+//   - FindBracket() binary-searches by timestamp (T::hostTime by default,
+//     or any accessor), returning references, never copies
+//
+// Used for remote transform history (interpolation) and reusable for
+// host-side lag-compensation history. NOT thread-safe.
+// -----------------------------------------------------------------------------
+template <class T, size_t MaxCapacity>
+class CoSyncRingBuffer
+{
+    static_assert(MaxCapacity >= 2 && (MaxCapacity & (MaxCapacity - 1)) == 0,
+        "CoSyncRingBuffer capacity must be a power of two");
+
+public:
+    // Rounded up to a power of two, clamped to [2, MaxCapacity]. Clears.
+    void SetCapacity(size_t capacity)
+    {
+        size_t c = 2;
+        while (c < capacity && c < MaxCapacity)
+            c <<= 1;
+
+        m_mask = c - 1;
+        Clear();
+    }
+
+    size_t Capacity() const { return m_mask + 1; }
+    size_t Size() const { return m_size; }
+    bool   Empty() const { return m_size == 0; }
+
+    void Clear()
+    {
+        m_head = 0;
+        m_size = 0;
+    }
+
+    // Overwrites the oldest sample when full
+    T& PushBack(const T& v)
+    {
+        const size_t slot = (m_head + m_size) & m_mask;
+        m_items[slot] = v;
+
+        if (m_size <= m_mask)
+            ++m_size;
+        else
+            m_head = (m_head + 1) & m_mask;
+
+        return m_items[slot];
+    }
+
+    void PopFront()
+    {
+        if (m_size == 0)
+            return;
+
+        m_head = (m_head + 1) & m_mask;
+        --m_size;
+    }
+
+    T&       operator[](size_t i) { return m_items[(m_head + i) & m_mask]; }
+    const T& operator[](size_t i) const { return m_items[(m_head + i) & m_mask]; }
+
+    T&       Front() { return (*this)[0]; }
+    const T& Front() const { return (*this)[0]; }
+    T&       Back() { return (*this)[m_size - 1]; }
+    const T& Back() const { return (*this)[m_size - 1]; }
+
+    // -------------------------------------------------------------------------
+    // Timestamp search (samples must be pushed in time order)
+    // -------------------------------------------------------------------------
+
+    // First index whose time is >= t (Size() if none)
+    template <class GetTime>
+    size_t LowerBound(double t, GetTime getTime) const
+    {
+        size_t lo = 0;
+        size_t hi = m_size;
+
+        while (lo < hi)
+        {
+            const size_t mid = (lo + hi) >> 1;
+            if (getTime((*this)[mid]) < t)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        return lo;
+    }
+
+    // Samples around t: outA.time <= t <= outB.time when t is inside the
+    // history; clamps to the two oldest / two newest otherwise.
+    // Requires Size() >= 2.
+    template <class GetTime>
+    void FindBracket(double t, GetTime getTime, const T*& outA, const T*& outB) const
+    {
+        size_t i = LowerBound(t, getTime);
+
+        if (i == 0)
+            i = 1;
+        else if (i >= m_size)
+            i = m_size - 1;
+
+        outA = &(*this)[i - 1];
+        outB = &(*this)[i];
+    }
+
+    void FindBracket(double t, const T*& outA, const T*& outB) const
+    {
+        FindBracket(t, [](const T& v) { return v.hostTime; }, outA, outB);
+    }
+
+private:
+    T      m_items[MaxCapacity];
+    size_t m_mask = MaxCapacity - 1;
+    size_t m_head = 0;
+    size_t m_size = 0;
+};
@@ -6,42 +6,71 @@
 #include "CoSyncPlayerManager.h"
 #include "CoSyncNet.h"
 #include "CoSyncLocalPlayer.h"
+#include "CoSyncFrameScheduler.h"
+#include "CoSyncTrace.h"
+#include "GNS_Session.h"
+#include "CoSyncClock.h"
 
-#define WIN32_LEAN_AND_MEAN
-#include <Windows.h>
-
-static double NowSeconds()
+// -----------------------------------------------------------------------------
+// Frame tasks (registered once, in phase order)
+// -----------------------------------------------------------------------------
+namespace
 {
-    static double s_freq = [] {
-        LARGE_INTEGER f{};
-        QueryPerformanceFrequency(&f);
-        return double(f.QuadPart);
-        }();
-
-    LARGE_INTEGER c{};
-    QueryPerformanceCounter(&c);
-    return double(c.QuadPart) / s_freq;
-}
+    void ReceiveTransport(double now)
+    {
+        // Pump GNS and drain the transport inbox on the game thread (F4MP rule);
+        // before transport init, still pump GNS so connect callbacks run
+        if (CoSyncTransport::IsInitialized())
+            CoSyncTransport::Tick(now);
+        else
+            GNS_Session::Get().Tick();
+    }
 
-void CoSyncRuntime_TickGameThread()
-{
-    const double now = NowSeconds();
+    void ReceiveSession(double now)
+    {
+        // Ensure init happens once world is ready
+        if (!CoSyncNet::IsInitialized())
+            CoSyncNet::PerformPendingInit();
 
-    // Ensure init happens once world is ready
-    if (!CoSyncNet::IsInitialized())
-        CoSyncNet::PerformPendingInit();
+        // Clock sync, host CREATE publish
+        CoSyncNet::Tick(now);
+    }
 
-    // Drain transport inbox on game thread (F4MP rule)
-    if (CoSyncTransport::IsInitialized())
-        CoSyncTransport::Tick(now);
+    void ApplyInbox(double)          { g_CoSyncPlayerManager.TickApply(); }
+    void PumpSpawns(double)          { g_CoSyncPlayerManager.TickSpawn(); }
+    void SimulateRemotes(double now) { g_CoSyncPlayerManager.TickSimulate(now); }
+    void HostNpcSend(double now)     { g_CoSyncPlayerManager.HostSendNpcUpdates(now); }
+    void FlushFrame(double now)      { g_CoSyncPlayerManager.TickFlush(now); }
 
-    // Apply CREATE/UPDATE -> queue spawns -> run spawn tasks (game thread)
-    g_CoSyncPlayerManager.Tick();
+    void RegisterFrameTasks()
+    {
+        CoSyncFrameScheduler& s = g_CoSyncFrameScheduler;
 
-    // Host-side publish + NPC scheduler etc.
-    if (CoSyncNet::IsInitialized())
-        CoSyncNet::Tick(now);
+        s.AddTask(CoSyncTickPhase::Receive, "Net.Receive", &ReceiveTransport);
+        s.AddTask(CoSyncTickPhase::Receive, "Net.Session", &ReceiveSession);
+
+        s.AddTask(CoSyncTickPhase::Apply, "PlayerMgr.Apply", &ApplyInbox);
+        s.AddTask(CoSyncTickPhase::Spawn, "PlayerMgr.Spawn", &PumpSpawns);
+        s.AddTask(CoSyncTickPhase::Simulate, "PlayerMgr.Simulate", &SimulateRemotes);
+
+        s.AddTask(CoSyncTickPhase::SampleLocal, "LocalPlayer.Sample", &CoSyncLocalPlayer::Sample);
 
-    // Send local player position updates (clients and host)
-    CoSyncLocalPlayer::Tick(now);
-}
\ No newline at end of file
+        s.AddFixedStep(CoSyncTickPhase::Send, CoSyncLocalPlayer::kSendStepName,
+            CoSyncLocalPlayer::GetSendIntervalSec(), &CoSyncLocalPlayer::Send);
+        s.AddFixedStep(CoSyncTickPhase::Send, "PlayerMgr.NpcSend",
+            CoSyncPlayerManager::kNpcSendIntervalSec, &HostNpcSend);
+
+        s.AddTask(CoSyncTickPhase::Flush, "PlayerMgr.Flush", &FlushFrame);
+    }
+}
+
+void CoSyncRuntime_TickGameThread()
+{
+    CoSyncTrace::SetThreadName("Game");
+
+    if (!g_CoSyncFrameScheduler.HasTasks())
+        RegisterFrameTasks();
+
+    // Caches CoSyncClock::FrameTime() for this frame's bulk work
+    g_CoSyncFrameScheduler.RunFrame(CoSyncClock::BeginFrame());
+}
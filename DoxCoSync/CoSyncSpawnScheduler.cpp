@@ -0,0 +1,172 @@
+#include "CoSyncSpawnScheduler.h"
+
+#include "CoSyncEntityTable.h"
+#include "ConsoleLogger.h"
+
+#include <algorithm>
+
+// Weight of the newest sample in the spawn cost EMA
+static constexpr double kCostEmaAlpha = 0.2;
+
+// -----------------------------------------------------------------------------
+// Construction
+// -----------------------------------------------------------------------------
+CoSyncSpawnScheduler::CoSyncSpawnScheduler()
+{
+    m_pending.reserve(64);
+    m_inFlight.reserve(64);
+}
+
+// -----------------------------------------------------------------------------
+// Queue
+// -----------------------------------------------------------------------------
+void CoSyncSpawnScheduler::Push(const EntityCreatePacket& p, double receivedAt)
+{
+    Pending e{};
+    e.create = p;
+    e.receivedAt = receivedAt;
+    e.isPlayer = (p.type == CoSyncEntityType::Player);
+
+    m_pending.push_back(e);
+}
+
+bool CoSyncSpawnScheduler::Remove(uint32_t entityID)
+{
+    const size_t before = m_pending.size();
+
+    m_pending.erase(
+        std::remove_if(
+            m_pending.begin(),
+            m_pending.end(),
+            [entityID](const Pending& e)
+            {
+                return e.create.entityID == entityID;
+            }),
+        m_pending.end());
+
+    const bool removedInFlight = m_inFlight.erase(entityID) != 0;
+
+    return removedInFlight || m_pending.size() != before;
+}
+
+void CoSyncSpawnScheduler::Clear()
+{
+    m_pending.clear();
+    m_inFlight.clear();
+}
+
+// -----------------------------------------------------------------------------
+// Priority
+// -----------------------------------------------------------------------------
+bool CoSyncSpawnScheduler::HigherPriority(const Pending& a, const Pending& b)
+{
+    if (a.isPlayer != b.isPlayer)
+        return a.isPlayer;
+
+    if (a.distSq != b.distSq)
+        return a.distSq < b.distSq;
+
+    return a.receivedAt < b.receivedAt;
+}
+
+// -----------------------------------------------------------------------------
+// Per-frame selection
+// -----------------------------------------------------------------------------
+void CoSyncSpawnScheduler::SelectForFrame(
+    const NiPoint3* origin,
+    const CoSyncEntityTable& entities,
+    std::vector<EntityCreatePacket>& out,
+    double budgetCapMicros)
+{
+    if (m_pending.empty())
+        return;
+
+    // Refresh distances (latest UPDATE may have moved the entity since CREATE)
+    for (Pending& e : m_pending)
+    {
+        if (!origin)
+        {
+            e.distSq = 0.0f;
+            continue;
+        }
+
+        NiPoint3 pos = e.create.spawnPos;
+
+        const size_t row = entities.RowOf(entities.Find(e.create.entityID));
+        if (row != static_cast<size_t>(-1))
+            pos = entities.PlayerAt(row).authoritativePos;
+
+        const float dx = pos.x - origin->x;
+        const float dy = pos.y - origin->y;
+        const float dz = pos.z - origin->z;
+        e.distSq = dx * dx + dy * dy + dz * dz;
+    }
+
+    std::stable_sort(m_pending.begin(), m_pending.end(), &CoSyncSpawnScheduler::HigherPriority);
+
+    // Spend the frame budget; the first spawn is always allowed
+    const double budget = (budgetCapMicros >= 0.0 && budgetCapMicros < m_budgetMicros)
+        ? budgetCapMicros
+        : m_budgetMicros;
+
+    size_t taken = 0;
+    double spent = 0.0;
+
+    while (taken < m_pending.size())
+    {
+        if (taken > 0 && spent + m_costEstimateMicros > budget)
+            break;
+
+        const Pending& e = m_pending[taken];
+        out.push_back(e.create);
+        m_inFlight[e.create.entityID] = e.receivedAt;
+
+        spent += m_costEstimateMicros;
+        ++taken;
+    }
+
+    m_pending.erase(m_pending.begin(), m_pending.begin() + taken);
+}
+
+// -----------------------------------------------------------------------------
+// Feedback
+// -----------------------------------------------------------------------------
+void CoSyncSpawnScheduler::OnSpawnFinished(
+    uint32_t entityID,
+    double costMicros,
+    bool spawned,
+    double now)
+{
+    if (costMicros >= 0.0)
+    {
+        m_cost.Record(costMicros);
+        m_costEstimateMicros += kCostEmaAlpha * (costMicros - m_costEstimateMicros);
+    }
+
+    auto it = m_inFlight.find(entityID);
+    if (it == m_inFlight.end())
+        return;
+
+    if (spawned)
+        m_latency.Record((now - it->second) * 1000000.0);
+
+    m_inFlight.erase(it);
+
+    if (m_pending.empty() && m_inFlight.empty())
+        LogBurstSummary();
+}
+
+void CoSyncSpawnScheduler::LogBurstSummary()
+{
+    if (m_latency.Count() == 0)
+        return;
+
+    LOG_INFO(
+        "[SpawnSched] Queue drained: spawned=%llu latency p50=%.1fms p95=%.1fms max=%.1fms cost~%.0fus budget=%.0fus",
+        static_cast<unsigned long long>(m_latency.Count()),
+        m_latency.Percentile(0.50) / 1000.0,
+        m_latency.Percentile(0.95) / 1000.0,
+        m_latency.Max() / 1000.0,
+        m_costEstimateMicros,
+        m_budgetMicros);
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "NiTypes.h"
+#include "Packets_EntityCreate.h"
+#include "CoSyncFlatMap.h"
+#include "CoSyncHistogram.h"
+
+class CoSyncEntityTable;
+
+// -----------------------------------------------------------------------------
+// CoSyncSpawnScheduler
+//
+// Orders deferred CREATEs and decides how many to dispatch per frame.
+//
+// Priority (highest first):
+//   1) Players before NPCs
+//   2) Closest to the local player
+//   3) Oldest CREATE first
+//
+// Budget:
+//   - Each frame may spend up to BudgetMicros() of estimated spawn cost
+//   - Spawn cost is an EMA of the measured SpawnTask run time
+//   - At least ONE spawn is always dispatched per frame (no starvation)
+//
+// Metrics:
+//   - Latency histogram: CREATE receipt -> proxy has a live actor
+//   - Spawn cost histogram: measured SpawnTask run time
+//
+// NOT thread-safe; owned by CoSyncPlayerManager under its spawn mutex.
+// -----------------------------------------------------------------------------
+class CoSyncSpawnScheduler
+{
+public:
+    static constexpr double kDefaultBudgetMicros = 2000.0;
+    static constexpr double kInitialCostMicros = 1000.0;
+
+    CoSyncSpawnScheduler();
+
+    // ---------------------------------------------------------------------
+    // Queue
+    // ---------------------------------------------------------------------
+    void   Push(const EntityCreatePacket& p, double receivedAt);   // CREATE receipt time
+    bool   Remove(uint32_t entityID);
+    void   Clear();
+
+    size_t PendingCount() const { return m_pending.size(); }
+    bool   Empty() const { return m_pending.empty(); }
+
+    // ---------------------------------------------------------------------
+    // Per-frame selection
+    //
+    // Refreshes distances from `origin` using the latest known transform
+    // in `entities`, then moves the highest-priority CREATEs that fit in
+    // the frame budget into `out` (appended, in dispatch order).
+    // budgetCapMicros >= 0 lowers this frame's budget (frame governor).
+    // ---------------------------------------------------------------------
+    void SelectForFrame(
+        const NiPoint3* origin,
+        const CoSyncEntityTable& entities,
+        std::vector<EntityCreatePacket>& out,
+        double budgetCapMicros = -1.0);
+
+    // ---------------------------------------------------------------------
+    // Feedback
+    // ---------------------------------------------------------------------
+    // Called once per dispatched CREATE when its SpawnTask has run.
+    // costMicros = measured task time; spawned = proxy has a live actor.
+    void OnSpawnFinished(uint32_t entityID, double costMicros, bool spawned, double now);
+
+    // ---------------------------------------------------------------------
+    // Config / metrics
+    // ---------------------------------------------------------------------
+    void   SetBudgetMicros(double micros) { m_budgetMicros = (micros > 0.0) ? micros : 0.0; }
+    double BudgetMicros() const { return m_budgetMicros; }
+    double EstimatedCostMicros() const { return m_costEstimateMicros; }
+
+    const CoSyncHistogram& LatencyHistogram() const { return m_latency; }
+    const CoSyncHistogram& CostHistogram() const { return m_cost; }
+
+private:
+    struct Pending
+    {
+        EntityCreatePacket create{};
+        double receivedAt = 0.0;
+        float  distSq = 0.0f;
+        bool   isPlayer = false;
+    };
+
+    static bool HigherPriority(const Pending& a, const Pending& b);
+
+    void LogBurstSummary();
+
+private:
+    std::vector<Pending> m_pending;
+
+    // entityID -> CREATE receipt time, for dispatched-but-not-spawned entities
+    CoSyncFlatMap<uint32_t, double> m_inFlight;
+
+    double m_budgetMicros = kDefaultBudgetMicros;
+    double m_costEstimateMicros = kInitialCostMicros;
+
+    CoSyncHistogram m_latency;
+    CoSyncHistogram m_cost;
+};
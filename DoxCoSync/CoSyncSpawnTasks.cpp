@@ -1,4 +1,6 @@
-﻿#include "CoSyncSpawnTasks.h"
+﻿#define COSYNC_LOG_CHANNEL Spawn
+
+#include "CoSyncSpawnTasks.h"
 
 #include "PluginAPI.h"
 #include "Tasks.h"
@@ -7,14 +9,17 @@
 #include "CoSyncPlayerManager.h"
 #include "CoSyncPlayer.h"
 #include "CoSyncGameAPI.h"
+#include "CoSyncActorPool.h"
+#include "CoSyncFormCache.h"
+#include "CoSyncTransformWriter.h"
 #include "CoSyncNet.h"
+#include "Packets_EntityCreate.h"
 
 #include "GameReferences.h"
 #include "GameForms.h"
 #include "GameObjects.h"
 
-#define WIN32_LEAN_AND_MEAN
-#include <Windows.h>
+#include "CoSyncClock.h"
 
 // Provided by F4SE
 extern RelocPtr<PlayerCharacter*> g_player;
@@ -34,6 +39,9 @@ static const F4SETaskInterface* s_taskIFace = nullptr;
 // -----------------------------------------------------------------------------
 static constexpr uint32_t kLocalRemotePlayerBaseFormID = 0x01003599; // your known scaffold
 
+// Disabled remote-player actors kept warm in the actor pool
+static constexpr size_t kPrewarmRemotePlayers = 2;
+
 // -----------------------------------------------------------------------------
 // Helpers
 // -----------------------------------------------------------------------------
@@ -43,34 +51,17 @@ static TESObjectREFR* GetAnchor()
     return pc ? static_cast<TESObjectREFR*>(pc) : nullptr;
 }
 
-static TESNPC* ResolveNPC(UInt32 baseFormID)
-{
-    TESForm* f = LookupFormByID(baseFormID);
-    if (!f)
-        return nullptr;
-
-    if (f->formType != TESNPC::kTypeID)
-        return nullptr;
-
-    return static_cast<TESNPC*>(f);
-}
-
 static uint32_t ResolveBaseForSpawn(uint32_t baseFormID, CoSyncEntityType createType, uint32_t entityID)
 {
-    // Player base is *never* transmitted. If it is 0, resolve locally.
-    if (createType == CoSyncEntityType::Player)
+    const uint32_t resolved = CoSyncSpawnTasks::ResolveBaseFormID(baseFormID, createType);
+
+    if (resolved != baseFormID)
     {
-        if (baseFormID == 0)
-        {
-           LOG_INFO("[SpawnTask] Player entity=%u baseFormID=0 -> resolved locally to 0x%08X",
-                entityID, kLocalRemotePlayerBaseFormID);
-            return kLocalRemotePlayerBaseFormID;
-        }
-        return baseFormID;
+        LOG_INFO("[SpawnTask] Player entity=%u baseFormID=0 -> resolved locally to 0x%08X",
+            entityID, resolved);
     }
 
-    // NPCs must always have a real baseForm in CREATE.
-    return baseFormID;
+    return resolved;
 }
 
 // -----------------------------------------------------------------------------
@@ -96,6 +87,19 @@ public:
     }
 
     void Run() override
+    {
+        const int64_t start = CoSyncClock::Ticks();
+        const bool spawned = Execute();
+
+        // Feed measured cost + latency back to the spawn scheduler
+        g_CoSyncPlayerManager.OnSpawnTaskFinished(
+            m_entityID,
+            CoSyncClock::MicrosSince(start),
+            spawned);
+    }
+
+private:
+    bool Execute()
     {
         LOG_DEBUG(
             "[SpawnTask] Run entity=%u base=0x%08X type=%u flags=0x%08X",
@@ -109,13 +113,13 @@ public:
 
         // Safety: never double-spawn
         if (pl.hasSpawned && pl.actorRef)
-            return;
+            return true;
 
         TESObjectREFR* anchor = GetAnchor();
         if (!anchor)
         {
             LOG_WARN("[SpawnTask] Anchor missing (player not ready?) entity=%u", m_entityID);
-            return;
+            return false;
         }
 
         // Resolve base form ID (players may be 0 and must be resolved locally)
@@ -125,11 +129,11 @@ public:
         {
             LOG_ERROR("[SpawnTask] Resolved baseFormID is 0 (entity=%u type=%u) - cannot spawn",
                 m_entityID, (uint32_t)m_createType);
-            return;
+            return false;
         }
 
-        // Resolve TESNPC base
-        TESNPC* npcBase = ResolveNPC(resolvedBase);
+        // Resolve TESNPC base (cached; usually prefetched when CREATE was queued)
+        TESNPC* npcBase = g_CoSyncFormCache.ResolveNPC(resolvedBase);
         if (!npcBase)
         {
             LOG_ERROR(
@@ -138,18 +142,27 @@ public:
                 m_entityID,
                 static_cast<uint32_t>(m_createType)
             );
-            return;
+            return false;
         }
 
-        // Spawn actor
-        if (!pl.SpawnInWorld(anchor, npcBase))
+        // HiddenOnSpawn is only honoured when UPDATEs will actually arrive
+        // (host never receives UPDATEs for its own NPCs)
+        const bool hostNpc = CoSyncNet::IsHost() && m_createType == CoSyncEntityType::NPC;
+        const bool startHidden = !hostNpc &&
+            EntityCreatePacket::HasFlag(m_spawnFlags, EntityCreatePacket::HiddenOnSpawn);
+
+        // Spawn actor (recycled from the actor pool when possible)
+        if (!pl.SpawnInWorld(anchor, npcBase, startHidden))
         {
             LOG_ERROR("[SpawnTask] SpawnInWorld FAILED entity=%u", m_entityID);
-            return;
+            return false;
         }
 
+        // Publish actor + spawned flag into the manager's hot columns
+        g_CoSyncPlayerManager.OnProxySpawned(m_entityID);
+
         // Initial CREATE placement (single snap)
-        CoSyncGameAPI::PositionRemoteActor(pl.actorRef, m_spawnPos, m_spawnRot);
+        g_CoSyncTransformWriter.Write(pl.actorRef, m_spawnPos, m_spawnRot, true);
 
         // AI CONTROL — F4MP rules
         //   Players: AI untouched
@@ -167,12 +180,16 @@ public:
         else if (CoSyncNet::IsHost() && m_createType == CoSyncEntityType::NPC)
         {
             LOG_INFO("[SpawnTask] Host NPC entity=%u (AI remains enabled)", m_entityID);
+
+            // Recycled actor may have been a client replica (AI disabled)
+            if (pl.spawnedFromPool)
+                CoSyncGameAPI::EnableActorAI(pl.actorRef);
         }
 
         LOG_INFO("[SpawnTask] Spawn DONE entity=%u actor=%p", m_entityID, pl.actorRef);
+        return true;
     }
 
-private:
     uint32_t m_entityID;
     uint32_t m_baseFormID;
     CoSyncEntityType m_createType;
@@ -188,6 +205,25 @@ void CoSyncSpawnTasks::Init(const F4SETaskInterface* taskInterface)
 {
     s_taskIFace = taskInterface;
     LOG_INFO("[CoSyncSpawnTasks] Init taskIFace=%p", taskInterface);
+
+    // Spawns go through the actor pool (PlaceAtMe only on a pool miss)
+    g_CoSyncActorPool.SetEngine(&CoSyncGameAPI::GetActorEngine());
+    g_CoSyncActorPool.SetPrewarmTarget(kLocalRemotePlayerBaseFormID, kPrewarmRemotePlayers);
+}
+
+uint32_t CoSyncSpawnTasks::GetRemotePlayerBaseFormID()
+{
+    return kLocalRemotePlayerBaseFormID;
+}
+
+uint32_t CoSyncSpawnTasks::ResolveBaseFormID(uint32_t baseFormID, CoSyncEntityType createType)
+{
+    // Player base is *never* transmitted. If it is 0, resolve locally.
+    if (createType == CoSyncEntityType::Player && baseFormID == 0)
+        return kLocalRemotePlayerBaseFormID;
+
+    // NPCs must always have a real baseForm in CREATE.
+    return baseFormID;
 }
 
 void CoSyncSpawnTasks::EnqueueSpawn(
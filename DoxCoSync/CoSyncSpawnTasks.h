@@ -11,11 +11,17 @@ namespace CoSyncSpawnTasks
 {
     void Init(const F4SETaskInterface* taskInterface);
 
+    // Locally resolved base for remote Player proxies (never networked)
+    uint32_t GetRemotePlayerBaseFormID();
+
+    // Base form a CREATE will actually spawn (Player base 0 -> local base)
+    uint32_t ResolveBaseFormID(uint32_t baseFormID, CoSyncEntityType createType);
+
     void EnqueueSpawn(
         uint32_t entityID,
         uint32_t baseFormID,
         CoSyncEntityType createType,
-        uint32_t spawnFlags,          // kept for signature compatibility
+        uint32_t spawnFlags,          // EntityCreatePacket::SpawnFlags (HiddenOnSpawn)
         const NiPoint3& spawnPos,
         const NiPoint3& spawnRot
     );
@@ -0,0 +1,338 @@
+#include "CoSyncTimerWheel.h"
+
+#include <cmath>
+
+CoSyncTimerWheel g_CoSyncTimers;
+
+// Longest representable delay (in ticks); longer delays are clamped
+static constexpr uint64_t kMaxDeltaTicks = (uint64_t(1) << (6 * 4)) - 1;
+
+// Rounding slack so whole-tick times (0.05 / 0.01 = 5.0000000001) don't
+// land a tick late
+static constexpr double kTickRoundSlack = 1e-6;
+
+// -----------------------------------------------------------------------------
+// Construction
+// -----------------------------------------------------------------------------
+CoSyncTimerWheel::CoSyncTimerWheel()
+{
+    for (uint32_t i = 0; i < kLevels * kSlots; ++i)
+        m_heads[i] = kNil;
+
+    m_nodes.reserve(256);
+}
+
+// -----------------------------------------------------------------------------
+// Node storage
+// -----------------------------------------------------------------------------
+uint32_t CoSyncTimerWheel::AllocNode()
+{
+    uint32_t idx;
+
+    if (m_freeHead != kNil)
+    {
+        idx = m_freeHead;
+        m_freeHead = m_nodes[idx].next;
+    }
+    else
+    {
+        m_nodes.push_back(Node{});
+        idx = static_cast<uint32_t>(m_nodes.size() - 1);
+    }
+
+    Node& n = m_nodes[idx];
+    n.prev = kNil;
+    n.next = kNil;
+    n.slot = kNoSlot;
+    n.inUse = true;
+    n.firing = false;
+    n.cancelled = false;
+
+    ++m_active;
+    return idx;
+}
+
+void CoSyncTimerWheel::FreeNode(uint32_t idx)
+{
+    Node& n = m_nodes[idx];
+
+    n.inUse = false;
+    n.firing = false;
+    n.cancelled = false;
+    n.cb = nullptr;
+    n.ctx = nullptr;
+    n.slot = kNoSlot;
+    ++n.generation;
+
+    n.prev = kNil;
+    n.next = m_freeHead;
+    m_freeHead = idx;
+
+    --m_active;
+}
+
+bool CoSyncTimerWheel::Resolve(CoSyncTimerHandle h, uint32_t& outIdx) const
+{
+    if (!h.IsValid() || h.index >= m_nodes.size())
+        return false;
+
+    const Node& n = m_nodes[h.index];
+    if (!n.inUse || n.generation != h.generation)
+        return false;
+
+    outIdx = h.index;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Slot lists
+// -----------------------------------------------------------------------------
+void CoSyncTimerWheel::Insert(uint32_t idx)
+{
+    Node& n = m_nodes[idx];
+
+    if (n.expireTick <= m_currentTick)
+        n.expireTick = m_currentTick + 1;
+
+    uint64_t delta = n.expireTick - m_currentTick;
+    if (delta > kMaxDeltaTicks)
+    {
+        delta = kMaxDeltaTicks;
+        n.expireTick = m_currentTick + delta;
+    }
+
+    uint32_t level = 0;
+    while (level + 1 < kLevels && delta >= (uint64_t(1) << (kSlotBits * (level + 1))))
+        ++level;
+
+    const uint32_t index =
+        static_cast<uint32_t>(n.expireTick >> (kSlotBits * level)) & kSlotMask;
+    const uint32_t slot = level * kSlots + index;
+
+    n.slot = static_cast<uint16_t>(slot);
+    n.prev = kNil;
+    n.next = m_heads[slot];
+
+    if (n.next != kNil)
+        m_nodes[n.next].prev = idx;
+
+    m_heads[slot] = idx;
+}
+
+void CoSyncTimerWheel::Unlink(uint32_t idx)
+{
+    Node& n = m_nodes[idx];
+    if (n.slot == kNoSlot)
+        return;
+
+    if (n.prev != kNil)
+        m_nodes[n.prev].next = n.next;
+    else
+        m_heads[n.slot] = n.next;
+
+    if (n.next != kNil)
+        m_nodes[n.next].prev = n.prev;
+
+    n.prev = kNil;
+    n.next = kNil;
+    n.slot = kNoSlot;
+}
+
+// -----------------------------------------------------------------------------
+// Scheduling
+// -----------------------------------------------------------------------------
+CoSyncTimerHandle CoSyncTimerWheel::ScheduleIn(
+    double delaySec,
+    Callback cb,
+    void* ctx,
+    uint64_t userData,
+    double periodSec)
+{
+    CoSyncTimerHandle h{};
+    if (!cb)
+        return h;
+
+    const double delayTicks = std::ceil(((delaySec > 0.0) ? delaySec : 0.0) / kTickSeconds - kTickRoundSlack);
+
+    const uint32_t idx = AllocNode();
+    Node& n = m_nodes[idx];
+
+    n.expireTick = m_currentTick +
+        ((delayTicks < double(kMaxDeltaTicks)) ? static_cast<uint64_t>(delayTicks) : kMaxDeltaTicks);
+    n.periodTicks = 0;
+
+    if (periodSec > 0.0)
+    {
+        const double periodTicks = std::floor(periodSec / kTickSeconds + 0.5);
+        n.periodTicks = (periodTicks >= 1.0) ? static_cast<uint64_t>(periodTicks) : 1;
+    }
+
+    n.cb = cb;
+    n.ctx = ctx;
+    n.userData = userData;
+
+    Insert(idx);
+
+    h.index = idx;
+    h.generation = n.generation;
+    return h;
+}
+
+bool CoSyncTimerWheel::Cancel(CoSyncTimerHandle h)
+{
+    uint32_t idx;
+    if (!Resolve(h, idx))
+        return false;
+
+    Node& n = m_nodes[idx];
+
+    // Currently inside its own callback: freed once the callback returns
+    if (n.firing)
+    {
+        const bool wasPending = !n.cancelled;
+        n.cancelled = true;
+        return wasPending;
+    }
+
+    Unlink(idx);
+    FreeNode(idx);
+    return true;
+}
+
+bool CoSyncTimerWheel::IsPending(CoSyncTimerHandle h) const
+{
+    uint32_t idx;
+    if (!Resolve(h, idx))
+        return false;
+
+    const Node& n = m_nodes[idx];
+    if (n.cancelled)
+        return false;
+
+    // A one-shot timer inside its own callback is already spent
+    return !(n.firing && n.periodTicks == 0);
+}
+
+// -----------------------------------------------------------------------------
+// Advance
+// -----------------------------------------------------------------------------
+void CoSyncTimerWheel::Cascade(uint32_t level)
+{
+    const uint32_t index =
+        static_cast<uint32_t>(m_currentTick >> (kSlotBits * level)) & kSlotMask;
+    const uint32_t slot = level * kSlots + index;
+
+    uint32_t idx = m_heads[slot];
+    m_heads[slot] = kNil;
+
+    while (idx != kNil)
+    {
+        const uint32_t next = m_nodes[idx].next;
+
+        m_nodes[idx].slot = kNoSlot;
+        Insert(idx);
+
+        idx = next;
+    }
+}
+
+size_t CoSyncTimerWheel::FireSlot(uint32_t slot)
+{
+    size_t fired = 0;
+
+    while (m_heads[slot] != kNil)
+    {
+        const uint32_t idx = m_heads[slot];
+        Unlink(idx);
+
+        Node& n = m_nodes[idx];
+        n.firing = true;
+
+        const Callback cb = n.cb;
+        void* const ctx = n.ctx;
+        const uint64_t userData = n.userData;
+
+        cb(ctx, userData, m_nowSec);
+        ++fired;
+
+        // Callback may have grown m_nodes; re-fetch
+        Node& after = m_nodes[idx];
+        after.firing = false;
+
+        if (after.cancelled || after.periodTicks == 0)
+        {
+            FreeNode(idx);
+            continue;
+        }
+
+        // Re-arm from the previous deadline; skip periods missed in a stall
+        after.expireTick += after.periodTicks;
+        if (after.expireTick <= m_targetTick)
+        {
+            const uint64_t behind = m_targetTick - after.expireTick;
+            after.expireTick += (behind / after.periodTicks + 1) * after.periodTicks;
+        }
+
+        Insert(idx);
+    }
+
+    return fired;
+}
+
+size_t CoSyncTimerWheel::Advance(double now)
+{
+    if (!m_started)
+    {
+        m_started = true;
+        m_originSec = now;
+        m_nowSec = now;
+        return 0;
+    }
+
+    if (now < m_nowSec)
+        return 0;
+
+    m_nowSec = now;
+
+    m_targetTick = static_cast<uint64_t>((now - m_originSec) / kTickSeconds + kTickRoundSlack);
+    size_t fired = 0;
+
+    while (m_currentTick < m_targetTick)
+    {
+        ++m_currentTick;
+
+        // Pull the next block of higher-level timers down when a level wraps
+        for (uint32_t level = 1; level < kLevels; ++level)
+        {
+            const uint64_t lowMask = (uint64_t(1) << (kSlotBits * level)) - 1;
+            if ((m_currentTick & lowMask) != 0)
+                break;
+
+            Cascade(level);
+        }
+
+        const uint32_t slot = static_cast<uint32_t>(m_currentTick) & kSlotMask;
+        if (m_heads[slot] != kNil)
+            fired += FireSlot(slot);
+    }
+
+    return fired;
+}
+
+// -----------------------------------------------------------------------------
+// Housekeeping
+// -----------------------------------------------------------------------------
+void CoSyncTimerWheel::Clear()
+{
+    for (uint32_t i = 0; i < kLevels * kSlots; ++i)
+        m_heads[i] = kNil;
+
+    // Free (not drop) nodes so generations keep invalidating old handles
+    for (uint32_t i = 0; i < m_nodes.size(); ++i)
+    {
+        if (m_nodes[i].inUse && !m_nodes[i].firing)
+            FreeNode(i);
+        else if (m_nodes[i].firing)
+            m_nodes[i].cancelled = true;
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// CoSyncTimerHandle
+// Generation-checked reference to a scheduled timer (stale handles are inert).
+// -----------------------------------------------------------------------------
+struct CoSyncTimerHandle
+{
+    static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+    uint32_t index = kInvalidIndex;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != kInvalidIndex; }
+};
+
+// -----------------------------------------------------------------------------
+// CoSyncTimerWheel
+//
+// Hierarchical timer wheel for deadlines (timeouts, heartbeats, periodic
+// sends, retries). GAME THREAD ONLY.
+//
+// Layout:
+//   - 10 ms ticks, 4 levels x 64 slots (~46 h range; longer delays clamp)
+//   - Level 0 slots hold timers due within 64 ticks; higher levels cascade
+//     down as time advances
+//
+// Cost:
+//   - Schedule / Cancel : O(1)
+//   - Advance           : O(elapsed ticks + expired timers)
+//
+// Callbacks are plain function pointers (no allocation per timer). They
+// run inside Advance() and MAY schedule or cancel timers, including their
+// own. Repeating timers re-arm from their previous deadline (no drift).
+// -----------------------------------------------------------------------------
+class CoSyncTimerWheel
+{
+public:
+    using Callback = void(*)(void* ctx, uint64_t userData, double now);
+
+    static constexpr double kTickSeconds = 0.01;
+
+    CoSyncTimerWheel();
+
+    // ---------------------------------------------------------------------
+    // Scheduling (relative to Now())
+    // ---------------------------------------------------------------------
+    CoSyncTimerHandle ScheduleIn(
+        double delaySec,
+        Callback cb,
+        void* ctx,
+        uint64_t userData = 0,
+        double periodSec = 0.0);   // > 0 = repeating
+
+    bool Cancel(CoSyncTimerHandle h);
+    bool IsPending(CoSyncTimerHandle h) const;
+
+    // ---------------------------------------------------------------------
+    // Time
+    // ---------------------------------------------------------------------
+    // Fire everything due at or before `now`. The first call anchors the
+    // wheel; timers scheduled before it count from that moment.
+    size_t Advance(double now);
+
+    double Now() const { return m_nowSec; }
+
+    // ---------------------------------------------------------------------
+    // Housekeeping
+    // ---------------------------------------------------------------------
+    size_t ActiveCount() const { return m_active; }
+    void   Clear();
+
+private:
+    static constexpr uint32_t kLevels = 4;
+    static constexpr uint32_t kSlotBits = 6;
+    static constexpr uint32_t kSlots = 1u << kSlotBits;
+    static constexpr uint32_t kSlotMask = kSlots - 1;
+    static constexpr uint32_t kNil = 0xFFFFFFFFu;
+    static constexpr uint16_t kNoSlot = 0xFFFF;
+
+    struct Node
+    {
+        uint64_t expireTick = 0;
+        uint64_t periodTicks = 0;
+
+        Callback cb = nullptr;
+        void*    ctx = nullptr;
+        uint64_t userData = 0;
+
+        uint32_t prev = kNil;
+        uint32_t next = kNil;     // slot list, or free list when unused
+        uint32_t generation = 0;
+        uint16_t slot = kNoSlot;  // level * kSlots + index
+
+        bool inUse = false;
+        bool firing = false;
+        bool cancelled = false;
+    };
+
+    uint32_t AllocNode();
+    void     FreeNode(uint32_t idx);
+
+    void Insert(uint32_t idx);
+    void Unlink(uint32_t idx);
+
+    void Cascade(uint32_t level);
+    size_t FireSlot(uint32_t slot);
+
+    bool Resolve(CoSyncTimerHandle h, uint32_t& outIdx) const;
+
+private:
+    std::vector<Node> m_nodes;
+    uint32_t m_freeHead = kNil;
+
+    uint32_t m_heads[kLevels * kSlots];
+
+    uint64_t m_currentTick = 0;
+    uint64_t m_targetTick = 0;     // tick Advance() is catching up to
+    double   m_originSec = 0.0;
+    double   m_nowSec = 0.0;
+    bool     m_started = false;
+
+    size_t m_active = 0;
+};
+
+// Shared wheel, advanced once per frame by the game-thread entry points
+extern CoSyncTimerWheel g_CoSyncTimers;
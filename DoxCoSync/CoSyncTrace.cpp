@@ -0,0 +1,242 @@
+#include "CoSyncTrace.h"
+
+#include "ConsoleLogger.h"
+#include "CoSyncFileSystem.h"
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> CoSyncTrace::Detail::g_enabled{ false };
+
+namespace
+{
+    // 16k x 24 B = 384 KB per tracing thread
+    constexpr uint32_t kRingEvents = 16384;
+    constexpr uint32_t kRingMask = kRingEvents - 1;
+    static_assert((kRingEvents & kRingMask) == 0, "ring size must be a power of two");
+
+    struct Event
+    {
+        const char* name;
+        int64_t     begin;
+        int64_t     end;
+    };
+
+    // Single writer (owning thread); DumpJson reads it concurrently and
+    // discards anything that may have been overwritten mid-copy
+    struct ThreadRing
+    {
+        std::atomic<uint64_t> written{ 0 };
+        uint32_t    tid = 0;
+        const char* name = nullptr;
+        Event       events[kRingEvents];
+    };
+
+    thread_local ThreadRing* t_ring = nullptr;
+    thread_local const char* t_name = nullptr;
+
+    std::mutex s_registryMutex;
+    std::vector<ThreadRing*> s_rings;     // leaked with their threads
+    uint32_t s_nextTid = 1;
+
+    std::atomic<int64_t> s_startTicks{ 0 };
+    std::atomic<uint32_t> s_dumpIndex{ 0 };
+
+    ThreadRing* GetRing()
+    {
+        if (t_ring)
+            return t_ring;
+
+        ThreadRing* ring = new ThreadRing();
+        ring->name = t_name;
+
+        std::lock_guard<std::mutex> lk(s_registryMutex);
+        ring->tid = s_nextTid++;
+        s_rings.push_back(ring);
+
+        t_ring = ring;
+        return ring;
+    }
+
+    double TicksToMicros(int64_t ticks)
+    {
+        using Period = std::chrono::steady_clock::period;
+        return double(ticks) * 1e6 * double(Period::num) / double(Period::den);
+    }
+
+    void WriteJsonString(FILE* f, const char* s)
+    {
+        fputc('"', f);
+        for (; s && *s; ++s)
+        {
+            if (*s == '"' || *s == '\\')
+                fputc('\\', f);
+
+            if (static_cast<unsigned char>(*s) >= 0x20)
+                fputc(*s, f);
+        }
+        fputc('"', f);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Recording
+// -----------------------------------------------------------------------------
+int64_t CoSyncTrace::Detail::Now()
+{
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+void CoSyncTrace::Detail::Record(const char* name, int64_t begin, int64_t end)
+{
+    ThreadRing* ring = GetRing();
+
+    const uint64_t n = ring->written.load(std::memory_order_relaxed);
+    Event& e = ring->events[n & kRingMask];
+    e.name = name;
+    e.begin = begin;
+    e.end = end;
+
+    ring->written.store(n + 1, std::memory_order_release);
+}
+
+void CoSyncTrace::Start()
+{
+    s_startTicks.store(Detail::Now(), std::memory_order_relaxed);
+    Detail::g_enabled.store(true, std::memory_order_relaxed);
+
+    LOG_INFO("[Trace] Recording started");
+}
+
+void CoSyncTrace::Stop()
+{
+    Detail::g_enabled.store(false, std::memory_order_relaxed);
+
+    LOG_INFO("[Trace] Recording stopped");
+}
+
+void CoSyncTrace::SetThreadName(const char* name)
+{
+    // Ring itself is only allocated once this thread records something
+    t_name = name;
+
+    if (t_ring)
+        t_ring->name = name;
+}
+
+// -----------------------------------------------------------------------------
+// Dump
+// -----------------------------------------------------------------------------
+bool CoSyncTrace::DumpJson(const std::string& path)
+{
+    struct ThreadCopy
+    {
+        uint32_t tid;
+        const char* name;
+        std::vector<Event> events;
+    };
+
+    std::vector<ThreadRing*> rings;
+    {
+        std::lock_guard<std::mutex> lk(s_registryMutex);
+        rings = s_rings;
+    }
+
+    const int64_t startTicks = s_startTicks.load(std::memory_order_relaxed);
+    int64_t originTicks = INT64_MAX;
+
+    std::vector<ThreadCopy> copies;
+    copies.reserve(rings.size());
+
+    for (ThreadRing* ring : rings)
+    {
+        ThreadCopy copy;
+        copy.tid = ring->tid;
+        copy.name = ring->name;
+
+        const uint64_t end = ring->written.load(std::memory_order_acquire);
+        const uint64_t begin = (end > kRingEvents) ? end - kRingEvents : 0;
+
+        copy.events.reserve(size_t(end - begin));
+        for (uint64_t i = begin; i < end; ++i)
+            copy.events.push_back(ring->events[i & kRingMask]);
+
+        // Slots the writer lapped while we copied are torn; drop them
+        const uint64_t after = ring->written.load(std::memory_order_acquire);
+        const uint64_t firstValid = (after > kRingEvents) ? after - kRingEvents : 0;
+        if (firstValid > begin)
+        {
+            const size_t torn = size_t((firstValid - begin < end - begin) ? firstValid - begin : end - begin);
+            copy.events.erase(copy.events.begin(), copy.events.begin() + torn);
+        }
+
+        for (const Event& e : copy.events)
+        {
+            if (e.begin >= startTicks && e.begin < originTicks)
+                originTicks = e.begin;
+        }
+
+        copies.push_back(std::move(copy));
+    }
+
+    FILE* f = CoSyncFileSystem::OpenFile(path, "wb");
+    if (!f)
+    {
+        LOG_ERROR("[Trace] Cannot write %s", path.c_str());
+        return false;
+    }
+
+    if (originTicks == INT64_MAX)
+        originTicks = startTicks;
+
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", f);
+
+    bool first = true;
+    size_t count = 0;
+
+    for (const ThreadCopy& copy : copies)
+    {
+        if (copy.name)
+        {
+            fprintf(f, "%s{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+                first ? "" : ",\n", copy.tid);
+            WriteJsonString(f, copy.name);
+            fputs("}}", f);
+            first = false;
+        }
+
+        for (const Event& e : copy.events)
+        {
+            if (e.begin < startTicks)
+                continue;
+
+            fputs(first ? "{\"ph\":\"X\",\"name\":" : ",\n{\"ph\":\"X\",\"name\":", f);
+            WriteJsonString(f, e.name);
+            fprintf(f, ",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                copy.tid,
+                TicksToMicros(e.begin - originTicks),
+                TicksToMicros(e.end - e.begin));
+
+            first = false;
+            ++count;
+        }
+    }
+
+    fputs("\n]}\n", f);
+    fclose(f);
+
+    LOG_INFO("[Trace] Wrote %zu events to %s", count, path.c_str());
+    return true;
+}
+
+std::string CoSyncTrace::DumpToLogDirectory()
+{
+    char name[64];
+    snprintf(name, sizeof(name), "CoSyncTrace_%u.json",
+        s_dumpIndex.fetch_add(1, std::memory_order_relaxed));
+
+    const std::string path = CoSyncFileSystem::JoinPath(CoSyncFileSystem::GetLogDirectory(), name);
+    return DumpJson(path) ? path : std::string();
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// CoSyncTrace
+//
+// Scoped begin/end markers for frame phases, dumped as Chrome trace-event
+// JSON (chrome://tracing, ui.perfetto.dev).
+//
+//   COSYNC_TRACE_SCOPE("PlayerMgr.ProcessInbox");
+//
+// Recording:
+//   - Off by default; a disabled scope is one relaxed load + branch
+//   - Each thread writes complete events into its own ring (flight
+//     recorder: newest ~16k events per thread, oldest overwritten)
+//   - Names MUST be string literals (the pointer is stored)
+//
+// Define COSYNC_TRACE_DISABLE to compile all scopes out.
+// -----------------------------------------------------------------------------
+namespace CoSyncTrace
+{
+    namespace Detail
+    {
+        extern std::atomic<bool> g_enabled;
+
+        int64_t Now();
+        void    Record(const char* name, int64_t begin, int64_t end);
+    }
+
+    inline bool IsEnabled()
+    {
+        return Detail::g_enabled.load(std::memory_order_relaxed);
+    }
+
+    // Start drops everything recorded before it from later dumps
+    void Start();
+    void Stop();
+
+    // Label for the calling thread in the dump ("Game", "Render", ...);
+    // literal only. Cheap, may be called every frame.
+    void SetThreadName(const char* name);
+
+    // Writes the current contents; safe while recording
+    bool DumpJson(const std::string& path);
+
+    // <log dir>\CoSyncTrace_<n>.json; returns the path ("" on failure)
+    std::string DumpToLogDirectory();
+
+    class Scope
+    {
+    public:
+        explicit Scope(const char* name)
+            : m_name(IsEnabled() ? name : nullptr)
+            , m_begin(m_name ? Detail::Now() : 0)
+        {
+        }
+
+        ~Scope()
+        {
+            if (m_name)
+                Detail::Record(m_name, m_begin, Detail::Now());
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* m_name;
+        int64_t     m_begin;
+    };
+}
+
+#define COSYNC_TRACE_CONCAT_INNER(a, b) a##b
+#define COSYNC_TRACE_CONCAT(a, b) COSYNC_TRACE_CONCAT_INNER(a, b)
+
+#ifdef COSYNC_TRACE_DISABLE
+#define COSYNC_TRACE_SCOPE(name) ((void)0)
+#else
+#define COSYNC_TRACE_SCOPE(name) \
+    ::CoSyncTrace::Scope COSYNC_TRACE_CONCAT(s_cosyncTraceScope_, __LINE__)(name)
+#endif
@@ -0,0 +1,199 @@
+#define COSYNC_LOG_CHANNEL PlayerMgr
+
+#include "CoSyncTransformWriter.h"
+
+#include "CoSyncGameAPI.h"
+#include "ConsoleLogger.h"
+#include "IniReader.h"
+
+#include <algorithm>
+#include <cmath>
+
+CoSyncTransformWriter g_CoSyncTransformWriter;
+
+// -----------------------------------------------------------------------------
+// Helpers
+// -----------------------------------------------------------------------------
+static float AngleDelta(float a, float b)
+{
+    return std::fabs(std::remainder(a - b, 6.28318530718f));
+}
+
+bool CoSyncTransformWriter::WithinEpsilon(const Entry& e, const NiPoint3& pos, const NiPoint3& rot) const
+{
+    if (!e.hasApplied)
+        return false;
+
+    const float dx = pos.x - e.appliedPos.x;
+    const float dy = pos.y - e.appliedPos.y;
+    const float dz = pos.z - e.appliedPos.z;
+
+    if (dx * dx + dy * dy + dz * dz > m_posEpsilon * m_posEpsilon)
+        return false;
+
+    return AngleDelta(rot.x, e.appliedRot.x) <= m_rotEpsilon &&
+        AngleDelta(rot.y, e.appliedRot.y) <= m_rotEpsilon &&
+        AngleDelta(rot.z, e.appliedRot.z) <= m_rotEpsilon;
+}
+
+void CoSyncTransformWriter::Apply(Actor* actor, Entry& e, const NiPoint3& pos, const NiPoint3& rot)
+{
+    CoSyncGameAPI::PositionRemoteActor(actor, pos, rot);
+
+    e.appliedPos = pos;
+    e.appliedRot = rot;
+    e.hasApplied = true;
+
+    ++m_frameIssued;
+    ++m_stats.totalIssued;
+}
+
+// -----------------------------------------------------------------------------
+// Config
+// -----------------------------------------------------------------------------
+void CoSyncTransformWriter::SetMaxMovesPerFrame(uint32_t maxMoves)
+{
+    m_maxMovesPerFrame.store(maxMoves, std::memory_order_relaxed);
+
+    if (maxMoves)
+        LOG_INFO("[TransformWriter] Max moves set to %u/frame", maxMoves);
+    else
+        LOG_INFO("[TransformWriter] Move cap disabled");
+}
+
+void CoSyncTransformWriter::SetEpsilon(float posEpsilon, float rotEpsilon)
+{
+    m_posEpsilon = (posEpsilon > 0.0f) ? posEpsilon : 0.0f;
+    m_rotEpsilon = (rotEpsilon > 0.0f) ? rotEpsilon : 0.0f;
+}
+
+bool CoSyncTransformWriter::LoadConfig(const char* iniPath)
+{
+    IniReader ini;
+    if (!iniPath || !ini.Load(iniPath))
+        return false;
+
+    const int maxMoves = ini.GetInt("MaxMovesPerFrame", static_cast<int>(MaxMovesPerFrame()));
+    SetMaxMovesPerFrame(maxMoves > 0 ? static_cast<uint32_t>(maxMoves) : 0);
+
+    SetEpsilon(
+        ini.GetFloat("MovePosEpsilon", m_posEpsilon),
+        ini.GetFloat("MoveRotEpsilon", m_rotEpsilon));
+
+    LOG_INFO("[TransformWriter] Epsilon pos=%.3f rot=%.4f", m_posEpsilon, m_rotEpsilon);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Immediate writes
+// -----------------------------------------------------------------------------
+bool CoSyncTransformWriter::Write(Actor* actor, const NiPoint3& pos, const NiPoint3& rot, bool force)
+{
+    if (!actor)
+        return false;
+
+    Entry& e = m_entries[actor];
+
+    if (!force && WithinEpsilon(e, pos, rot))
+    {
+        ++m_frameSkipped;
+        ++m_stats.totalSkipped;
+        return false;
+    }
+
+    Apply(actor, e, pos, rot);
+
+    // Supersedes any queued smoothing target
+    e.targetPos = pos;
+    e.targetRot = rot;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Budgeted writes
+// -----------------------------------------------------------------------------
+void CoSyncTransformWriter::Submit(Actor* actor, const NiPoint3& pos, const NiPoint3& rot)
+{
+    if (!actor)
+        return;
+
+    Entry& e = m_entries[actor];
+
+    if (WithinEpsilon(e, pos, rot))
+    {
+        // Settled back onto what the engine already has
+        e.targetPos = pos;
+        e.targetRot = rot;
+
+        ++m_frameSkipped;
+        ++m_stats.totalSkipped;
+        return;
+    }
+
+    e.targetPos = pos;
+    e.targetRot = rot;
+
+    if (!e.queued)
+    {
+        e.queued = true;
+        m_queue.push_back(actor);
+    }
+}
+
+void CoSyncTransformWriter::Flush()
+{
+    size_t budget = m_queue.size();
+
+    const uint32_t maxMoves = MaxMovesPerFrame();
+    if (maxMoves != 0 && maxMoves < budget)
+        budget = maxMoves;
+
+    // Oldest queued first; unserved actors stay at the front for next frame
+    for (size_t n = 0; n < budget; ++n)
+    {
+        Actor* actor = m_queue[n];
+
+        auto it = m_entries.find(actor);
+        if (it == m_entries.end())
+            continue;
+
+        Entry& e = it->second;
+        e.queued = false;
+
+        if (WithinEpsilon(e, e.targetPos, e.targetRot))
+            continue;   // an immediate Write() already covered it
+
+        Apply(actor, e, e.targetPos, e.targetRot);
+    }
+
+    m_queue.erase(m_queue.begin(), m_queue.begin() + budget);
+    m_stats.totalDeferred += m_queue.size();
+
+    m_stats.frameIssued = m_frameIssued;
+    m_stats.frameSkipped = m_frameSkipped;
+    m_stats.frameDeferred = static_cast<uint32_t>(m_queue.size());
+
+    m_frameIssued = 0;
+    m_frameSkipped = 0;
+}
+
+// -----------------------------------------------------------------------------
+// Lifetime
+// -----------------------------------------------------------------------------
+void CoSyncTransformWriter::Forget(Actor* actor)
+{
+    auto it = m_entries.find(actor);
+    if (it == m_entries.end())
+        return;
+
+    if (it->second.queued)
+        m_queue.erase(std::remove(m_queue.begin(), m_queue.end(), actor), m_queue.end());
+
+    m_entries.erase(it);
+}
+
+void CoSyncTransformWriter::Reset()
+{
+    m_entries.clear();
+    m_queue.clear();
+}
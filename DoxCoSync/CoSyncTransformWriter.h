@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "NiTypes.h"   // NiPoint3
+#include "CoSyncFlatMap.h"
+
+class Actor;
+
+// -----------------------------------------------------------------------------
+// CoSyncTransformWriter
+//
+// Coalescing front-end for CoSyncGameAPI::PositionRemoteActor
+// (MoveRefrToPosition is a heavy engine call).
+//
+//   - Remembers the last transform APPLIED per actor; writes within
+//     pos/rot epsilon of it are skipped
+//   - Write()  : immediate (snaps, NPC updates); force bypasses epsilon
+//   - Submit() : per-frame smoothing; queued and applied by Flush(),
+//                at most N engine moves per frame, round-robin so a cap
+//                never starves the same actors (latest target wins)
+//   - Forget() when an actor leaves our control (despawn / pool release)
+//
+// GAME THREAD ONLY, except SetMaxMovesPerFrame / MaxMovesPerFrame (any
+// thread; overlay slider).
+// -----------------------------------------------------------------------------
+class CoSyncTransformWriter
+{
+public:
+    // Smoothed moves per frame; sessions up to this many proxies never wait
+    static constexpr uint32_t kDefaultMaxMovesPerFrame = 32;
+    static constexpr float    kDefaultPosEpsilon = 0.1f;     // game units
+    static constexpr float    kDefaultRotEpsilon = 0.001f;   // radians
+
+    struct Stats
+    {
+        // Last completed frame (Flush)
+        uint32_t frameIssued = 0;
+        uint32_t frameSkipped = 0;
+        uint32_t frameDeferred = 0;
+
+        uint64_t totalIssued = 0;
+        uint64_t totalSkipped = 0;     // below epsilon
+        uint64_t totalDeferred = 0;    // over the per-frame cap (retried)
+    };
+
+    bool Write(Actor* actor, const NiPoint3& pos, const NiPoint3& rot, bool force = false);
+    void Submit(Actor* actor, const NiPoint3& pos, const NiPoint3& rot);
+
+    // Apply queued submits (once per frame, after smoothing)
+    void Flush();
+
+    void Forget(Actor* actor);
+    void Reset();
+
+    // 0 = unlimited
+    void     SetMaxMovesPerFrame(uint32_t maxMoves);
+    uint32_t MaxMovesPerFrame() const { return m_maxMovesPerFrame.load(std::memory_order_relaxed); }
+
+    void SetEpsilon(float posEpsilon, float rotEpsilon);
+
+    // Reads MaxMovesPerFrame, MovePosEpsilon and MoveRotEpsilon. Missing
+    // file = no change.
+    bool LoadConfig(const char* iniPath);
+
+    const Stats& GetStats() const { return m_stats; }
+
+private:
+    struct Entry
+    {
+        NiPoint3 appliedPos{ 0.f, 0.f, 0.f };
+        NiPoint3 appliedRot{ 0.f, 0.f, 0.f };
+        NiPoint3 targetPos{ 0.f, 0.f, 0.f };
+        NiPoint3 targetRot{ 0.f, 0.f, 0.f };
+
+        bool hasApplied = false;
+        bool queued = false;
+    };
+
+    bool WithinEpsilon(const Entry& e, const NiPoint3& pos, const NiPoint3& rot) const;
+    void Apply(Actor* actor, Entry& e, const NiPoint3& pos, const NiPoint3& rot);
+
+private:
+    CoSyncFlatMap<Actor*, Entry> m_entries;
+    std::vector<Actor*> m_queue;       // queued submits, oldest first (round-robin under a cap)
+
+    std::atomic<uint32_t> m_maxMovesPerFrame{ kDefaultMaxMovesPerFrame };
+    float m_posEpsilon = kDefaultPosEpsilon;
+    float m_rotEpsilon = kDefaultRotEpsilon;
+
+    uint32_t m_frameIssued = 0;
+    uint32_t m_frameSkipped = 0;
+
+    Stats m_stats;
+};
+
+extern CoSyncTransformWriter g_CoSyncTransformWriter;
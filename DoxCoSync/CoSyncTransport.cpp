@@ -1,8 +1,13 @@
-﻿#include "CoSyncTransport.h"
+﻿#define COSYNC_LOG_CHANNEL Transport
+
+#include "CoSyncTransport.h"
 
 #include "Logger.h"
 #include "ConsoleLogger.h"
 #include "GNS_Session.h"
+#include "CoSyncTimerWheel.h"
+#include "CoSyncTrace.h"
+#include "CoSyncMetrics.h"
 
 #include <utility>
 
@@ -18,8 +23,17 @@ namespace
     std::mutex s_inboxMutex;
     std::deque<CoSyncTransport::InboxMessage> s_inbox;
 
-    // Throttle spam
-    double s_lastTickLog = 0.0;
+    // Throttle spam (1 Hz tick log on the shared timer wheel)
+    constexpr double kTickLogIntervalSec = 1.0;
+    CoSyncTimerHandle s_tickLogTimer{};
+    size_t s_lastDrained = 0;
+    bool   s_lastConnected = false;
+
+    void OnTickLogTimer(void*, uint64_t, double)
+    {
+        LOG_DEBUG("[CoSyncTransport] Tick (drained=%zu connected=%d)",
+            s_lastDrained, s_lastConnected ? 1 : 0);
+    }
 
     // Hard safety cap to prevent runaway memory usage if something floods.
     constexpr size_t kInboxHardCap = 4096;
@@ -107,9 +121,22 @@ void CoSyncTransport::Send(const std::string& msg)
     }
 
     GNS_Session::Get().SendText(msg);
+    CoSyncWireMetrics::CountSent(msg);
     LOG_DEBUG("[CoSyncTransport] SEND %zu bytes", msg.size());
 }
 
+void CoSyncTransport::SendTo(HSteamNetConnection conn, const std::string& msg)
+{
+    if (!s_initialized)
+    {
+        LOG_WARN("[Transport] SendTo called while not initialized");
+        return;
+    }
+
+    GNS_Session::Get().SendTextTo(conn, msg);
+    CoSyncWireMetrics::CountSent(msg);
+}
+
 // -----------------------------------------------------------------------------
 // Incoming: called from GNS receive path (may be non-game-thread)
 // -----------------------------------------------------------------------------
@@ -118,15 +145,22 @@ void CoSyncTransport::ForwardMessage(const std::string& msg, HSteamNetConnection
     if (!s_initialized)
         return;
 
-    LOG_INFO("[Transport] ForwardMessage %zu bytes (conn=%u): %.80s",
+    LOG_DEBUG("[Transport] ForwardMessage %zu bytes (conn=%u): %.80s",
         msg.size(), conn, msg.c_str());
 
+    static CoSyncCounter& s_droppedAtCap = g_CoSyncMetrics.Counter("transport.inbox.dropped");
+    static CoSyncGauge& s_inboxDepth = g_CoSyncMetrics.Gauge("transport.inbox.depth");
+
     std::lock_guard<std::mutex> lk(s_inboxMutex);
 
     if (s_inbox.size() >= kInboxHardCap)
+    {
         s_inbox.pop_front();
+        s_droppedAtCap.Add();
+    }
 
     s_inbox.push_back({ msg, conn });
+    s_inboxDepth.Set(static_cast<int64_t>(s_inbox.size()));
 }
 
 // -----------------------------------------------------------------------------
@@ -167,6 +201,8 @@ void CoSyncTransport::Tick(double now)
     if (!s_initialized)
         return;
 
+    COSYNC_TRACE_SCOPE("Transport.Tick");
+
     GNS_Session::Get().Tick();
 
     // Edge-triggered connection notification:
@@ -188,9 +224,15 @@ void CoSyncTransport::Tick(double now)
         LOG_INFO("[Transport] Connection lost (edge)");
     }
 
+    static CoSyncCounter& s_drainedTotal = g_CoSyncMetrics.Counter("transport.inbox.drained");
+    static CoSyncGauge& s_inboxDepth = g_CoSyncMetrics.Gauge("transport.inbox.depth");
+
     std::deque<InboxMessage> drained;
     const size_t count = DrainInbox(drained);
 
+    s_drainedTotal.Add(count);
+    s_inboxDepth.Set(0);
+
     if (count > 0)
     {
         LOG_DEBUG("[Transport] Drained %zu inbound messages", count);
@@ -206,10 +248,13 @@ void CoSyncTransport::Tick(double now)
         }
     }
 
-    if (now - s_lastTickLog > 1.0)
+    s_lastDrained = count;
+    s_lastConnected = connectedNow;
+
+    if (!g_CoSyncTimers.IsPending(s_tickLogTimer))
     {
-        s_lastTickLog = now;
-        LOG_DEBUG("[CoSyncTransport] Tick (drained=%zu connected=%d)", count, connectedNow ? 1 : 0);
+        s_tickLogTimer = g_CoSyncTimers.ScheduleIn(
+            kTickLogIntervalSec, &OnTickLogTimer, nullptr, 0, kTickLogIntervalSec);
     }
 }
 
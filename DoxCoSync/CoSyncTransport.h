@@ -33,6 +33,9 @@ namespace CoSyncTransport
     // -------------------------------------------------------------------------
     void Send(const std::string& msg);
 
+    // Reply to a single peer (host) / send to host (client)
+    void SendTo(HSteamNetConnection conn, const std::string& msg);
+
     // -------------------------------------------------------------------------
     // Incoming (network thread → transport)
     // Thread-safe. MUST NOT touch game systems.
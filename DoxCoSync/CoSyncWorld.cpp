@@ -34,4 +34,14 @@ namespace CoSyncWorld
 
         return true;
     }
+
+    bool GetLocalPlayerPosition(NiPoint3& outPos)
+    {
+        PlayerCharacter* pc = *g_player;
+        if (!pc)
+            return false;
+
+        outPos = NiPoint3(pc->pos.x, pc->pos.y, pc->pos.z);
+        return true;
+    }
 }
@@ -17,6 +17,9 @@ namespace CoSyncWorld
 {
     bool IsWorldReady();
 
+    // Local player world position (false if the player is not available)
+    bool GetLocalPlayerPosition(NiPoint3& outPos);
+
 
 }
 
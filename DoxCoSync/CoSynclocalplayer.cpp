@@ -4,11 +4,12 @@
 #include "ConsoleLogger.h"
 #include "CoSyncNet.h"
 #include "CoSyncGameAPI.h"
+#include "CoSyncDeadReckoning.h"
+#include "CoSyncTrace.h"
+#include "CoSyncFrameScheduler.h"
 #include "GameReferences.h"
 #include "GameObjects.h"
 
-#define WIN32_LEAN_AND_MEAN
-#include <Windows.h>
 #include <cmath>
 
 // External reference to the local player
@@ -30,31 +31,20 @@ namespace
     double   s_prevTime = 0.0;
     bool     s_hasPrevious = false;
 
+    // This frame's sample (SampleLocal phase -> Send phase)
+    NiPoint3 s_curPos{ 0.f, 0.f, 0.f };
+    NiPoint3 s_curRot{ 0.f, 0.f, 0.f };
+    NiPoint3 s_curVel{ 0.f, 0.f, 0.f };
+    bool     s_hasSample = false;
+    bool     s_forceSend = false;
+
     // Configuration
-    float s_updateRate = 20.0f;              // 20 Hz default
-    float s_movementThreshold = 0.01f;       // 1cm movement threshold
+    float s_updateRate = 20.0f;              // 20 Hz max send rate
+    float s_movementThreshold = 4.0f;        // ~6cm dead-reckoning error tolerance
     float s_rotationThreshold = 0.01f;       // ~0.57 degrees rotation threshold
-
-    // Timing helper
-    double NowSeconds()
-    {
-        static double s_freq = [] {
-            LARGE_INTEGER f{};
-            QueryPerformanceFrequency(&f);
-            return double(f.QuadPart);
-            }();
-
-        LARGE_INTEGER c{};
-        QueryPerformanceCounter(&c);
-        return double(c.QuadPart) / s_freq;
-    }
+    float s_maxSendInterval = 1.0f;          // heartbeat when prediction holds
 
     // Vector helpers
-    float VectorLength(const NiPoint3& v)
-    {
-        return sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
-    }
-
     NiPoint3 VectorSubtract(const NiPoint3& a, const NiPoint3& b)
     {
         return NiPoint3{ a.x - b.x, a.y - b.y, a.z - b.z };
@@ -77,12 +67,14 @@ namespace
         return VectorScale(delta, scale);
     }
 
-    // Check if position has changed significantly
-    bool HasMovedSignificantly(const NiPoint3& current, const NiPoint3& previous)
+    // Check if receivers' dead-reckoned position (last sent pos + vel * dt)
+    // has drifted too far from where we actually are
+    bool HasDivergedFromPrediction(const NiPoint3& current, double sinceSent)
     {
-        NiPoint3 delta = VectorSubtract(current, previous);
-        float distance = VectorLength(delta);
-        return distance > s_movementThreshold;
+        const float errSq = CoSyncDeadReckoning::PredictionErrorSq(
+            s_lastSentPos, s_lastSentVel, sinceSent, current);
+
+        return errSq > s_movementThreshold * s_movementThreshold;
     }
 
     // Check if rotation has changed significantly
@@ -113,6 +105,7 @@ void CoSyncLocalPlayer::Init()
     // Reset state
     s_lastSendTime = 0.0;
     s_hasPrevious = false;
+    s_hasSample = false;
 
     LOG_INFO("[LocalPlayer] Initialized (updateRate=%.1f Hz)", s_updateRate);
 }
@@ -124,6 +117,7 @@ void CoSyncLocalPlayer::Shutdown()
 
     s_initialized = false;
     s_hasPrevious = false;
+    s_hasSample = false;
 
     LOG_INFO("[LocalPlayer] Shutdown");
 }
@@ -147,8 +141,8 @@ void CoSyncLocalPlayer::ForceUpdate()
     if (!s_initialized)
         return;
 
-    // Reset last send time to force an update on next tick
-    s_lastSendTime = 0.0;
+    // Next send step goes out regardless of dead reckoning
+    s_forceSend = true;
 
     LOG_INFO("[LocalPlayer] Force update requested");
 }
@@ -162,9 +156,16 @@ void CoSyncLocalPlayer::SetUpdateRate(float updatesPerSecond)
 
     s_updateRate = updatesPerSecond;
 
+    g_CoSyncFrameScheduler.SetFixedStep(kSendStepName, GetSendIntervalSec());
+
     LOG_INFO("[LocalPlayer] Update rate set to %.1f Hz", s_updateRate);
 }
 
+double CoSyncLocalPlayer::GetSendIntervalSec()
+{
+    return 1.0 / static_cast<double>(s_updateRate);
+}
+
 void CoSyncLocalPlayer::SetMovementThreshold(float distance)
 {
     if (distance < 0.0f)
@@ -175,6 +176,16 @@ void CoSyncLocalPlayer::SetMovementThreshold(float distance)
     LOG_INFO("[LocalPlayer] Movement threshold set to %.3f", distance);
 }
 
+void CoSyncLocalPlayer::SetMaxSendInterval(float seconds)
+{
+    if (seconds < 0.05f)
+        seconds = 0.05f;
+
+    s_maxSendInterval = seconds;
+
+    LOG_INFO("[LocalPlayer] Max send interval set to %.2f s", seconds);
+}
+
 void CoSyncLocalPlayer::SetRotationThreshold(float radians)
 {
     if (radians < 0.0f)
@@ -185,8 +196,10 @@ void CoSyncLocalPlayer::SetRotationThreshold(float radians)
     LOG_INFO("[LocalPlayer] Rotation threshold set to %.3f rad", radians);
 }
 
-void CoSyncLocalPlayer::Tick(double now)
+void CoSyncLocalPlayer::Sample(double now)
 {
+    s_hasSample = false;
+
     // Must be initialized and connected
     if (!s_initialized)
         return;
@@ -200,59 +213,61 @@ void CoSyncLocalPlayer::Tick(double now)
         return;
 
     // Get current transform
-    NiPoint3 currentPos{ 0.f, 0.f, 0.f };
-    NiPoint3 currentRot{ 0.f, 0.f, 0.f };
-
-    if (!CoSyncGameAPI::GetActorWorldTransform(player, currentPos, currentRot))
+    if (!CoSyncGameAPI::GetActorWorldTransform(player, s_curPos, s_curRot))
         return;
 
     // Calculate velocity
-    NiPoint3 velocity{ 0.f, 0.f, 0.f };
+    s_curVel = NiPoint3{ 0.f, 0.f, 0.f };
     if (s_hasPrevious && s_prevTime > 0.0)
     {
         double deltaTime = now - s_prevTime;
-        velocity = CalculateVelocity(currentPos, s_prevPos, deltaTime);
+        s_curVel = CalculateVelocity(s_curPos, s_prevPos, deltaTime);
     }
 
     // Update previous state
-    s_prevPos = currentPos;
+    s_prevPos = s_curPos;
     s_prevTime = now;
     s_hasPrevious = true;
+    s_hasSample = true;
+}
 
-    // Check if enough time has passed
-    const double updateInterval = 1.0 / static_cast<double>(s_updateRate);
-    const double timeSinceLastSend = now - s_lastSendTime;
-
-    if (timeSinceLastSend < updateInterval)
+void CoSyncLocalPlayer::Send(double now)
+{
+    // Rate is the scheduler's fixed step; nothing to do without a sample
+    if (!s_hasSample)
         return;
 
-    // Check if we've moved or rotated enough to warrant an update
-    const bool hasMoved = HasMovedSignificantly(currentPos, s_lastSentPos);
-    const bool hasRotated = HasRotatedSignificantly(currentRot, s_lastSentRot);
+    const double timeSinceLastSend = now - s_lastSendTime;
 
-    if (!hasMoved && !hasRotated)
+    // Dead reckoning: skip while receivers' prediction is still good enough
+    // (straight-line running sends only when velocity changes)
+    const bool hasMoved = HasDivergedFromPrediction(s_curPos, timeSinceLastSend);
+    const bool hasRotated = HasRotatedSignificantly(s_curRot, s_lastSentRot);
+
+    if (!hasMoved && !hasRotated && !s_forceSend)
     {
-        // Still send periodic updates even if not moving (heartbeat)
-        // But reduce frequency when stationary
-        if (timeSinceLastSend < (updateInterval * 3.0))
+        // Heartbeat so receivers never time out on a perfect prediction
+        if (timeSinceLastSend < static_cast<double>(s_maxSendInterval))
             return;
     }
 
+    s_forceSend = false;
+
     // Send the update
     const uint32_t myEntityID = CoSyncNet::GetMyEntityID();
 
     CoSyncNet::SendMyEntityUpdate(
         myEntityID,
-        currentPos,
-        currentRot,
-        velocity,
+        s_curPos,
+        s_curRot,
+        s_curVel,
         now
     );
 
     // Update last sent state
-    s_lastSentPos = currentPos;
-    s_lastSentRot = currentRot;
-    s_lastSentVel = velocity;
+    s_lastSentPos = s_curPos;
+    s_lastSentRot = s_curRot;
+    s_lastSentVel = s_curVel;
     s_lastSendTime = now;
 
     // Debug logging (only when actually moving)
@@ -260,7 +275,7 @@ void CoSyncLocalPlayer::Tick(double now)
     {
         LOG_DEBUG("[LocalPlayer] Sent UPDATE entity=%u pos=(%.2f,%.2f,%.2f) vel=(%.2f,%.2f,%.2f)",
             myEntityID,
-            currentPos.x, currentPos.y, currentPos.z,
-            velocity.x, velocity.y, velocity.z);
+            s_curPos.x, s_curPos.y, s_curPos.z,
+            s_curVel.x, s_curVel.y, s_curVel.z);
     }
-}
\ No newline at end of file
+}
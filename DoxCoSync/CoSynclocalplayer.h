@@ -14,9 +14,14 @@ namespace CoSyncLocalPlayer
     // Shutdown the local player tracking system
     void Shutdown();
 
-    // Per-frame update (sends position updates to network)
-    // Should be called from CoSyncRuntime tick
-    void Tick(double now);
+    // Scheduler name of the Send-phase fixed step (period = 1 / update rate)
+    constexpr const char* kSendStepName = "LocalPlayer.Send";
+
+    // SampleLocal phase: read transform, derive velocity (every frame)
+    void Sample(double now);
+
+    // Send phase fixed step: dead-reckoning / heartbeat check, then send
+    void Send(double now);
 
     // Get the local player actor
     Actor* GetLocalPlayerActor();
@@ -28,7 +33,11 @@ namespace CoSyncLocalPlayer
     bool GetLocalTransform(NiPoint3& outPos, NiPoint3& outRot);
 
     // Configuration
-    void SetUpdateRate(float updatesPerSecond);  // Default: 20 Hz
-    void SetMovementThreshold(float distance);    // Default: 0.01 units
+    void SetUpdateRate(float updatesPerSecond);  // Default: 20 Hz (max send rate)
+    void SetMovementThreshold(float distance);    // Default: 4 units of dead-reckoning error
     void SetRotationThreshold(float radians);     // Default: 0.01 radians
+    void SetMaxSendInterval(float seconds);       // Default: 1 s (heartbeat)
+
+    // Current send step period (1 / update rate)
+    double GetSendIntervalSec();
 }
@@ -3,10 +3,14 @@
 
 
 
+#ifdef _WIN32
 #include <windows.h>
+#endif
 #include <cstdio>
 #include <cstdarg>
 
+#include "CoSyncLog.h"
+
 enum class LogColor
 {
     WHITE = 7,
@@ -16,6 +20,7 @@ enum class LogColor
     CYAN = 11
 };
 
+#ifdef _WIN32
 // ======================================================
 // FORCE CONSOLE FOR FALLOUT 4 NG
 // ======================================================
@@ -42,7 +47,8 @@ inline void EnsureConsole()
 }
 
 // ======================================================
-// Thread-safe colored printer
+// Thread-safe colored printer (synchronous; the LOG_*
+// macros go through CoSyncLog instead)
 // ======================================================
 inline void ConsoleLogColor(LogColor color, const char* fmt, ...)
 {
@@ -75,11 +81,64 @@ inline void ConsoleLogColor(LogColor color, const char* fmt, ...)
 
     LeaveCriticalSection(&cs);
 }
+#endif // _WIN32
 
 // ======================================================
 // Logging macros
+// Asynchronous: the caller only packs a record into its
+// thread's ring; the CoSyncLog thread formats + prints.
+// fmt must be a string literal.
+//
+// Filtering (per channel, see CoSyncLog.h):
+//   - below the compile-time minimum: compiled out
+//   - below the runtime level (INI): one branch, args
+//     not evaluated
 // ======================================================
-#define LOG_INFO(fmt, ...)   ConsoleLogColor(LogColor::GREEN,  "[INFO] " fmt, ##__VA_ARGS__)
-#define LOG_WARN(fmt, ...)   ConsoleLogColor(LogColor::YELLOW, "[WARN] " fmt, ##__VA_ARGS__)
-#define LOG_ERROR(fmt, ...)  ConsoleLogColor(LogColor::RED,    "[ERROR] " fmt, ##__VA_ARGS__)
-#define LOG_DEBUG(fmt, ...)  ConsoleLogColor(LogColor::CYAN,   "[DEBUG] " fmt, ##__VA_ARGS__)
+#ifndef COSYNC_LOG_CHANNEL
+#define COSYNC_LOG_CHANNEL General
+#endif
+
+#define COSYNC_LOG_PREFIX_Debug "[DEBUG] "
+#define COSYNC_LOG_PREFIX_Info  "[INFO] "
+#define COSYNC_LOG_PREFIX_Warn  "[WARN] "
+#define COSYNC_LOG_PREFIX_Error "[ERROR] "
+
+#define COSYNC_LOG_ENABLED(level) \
+    (CoSyncLog::CompiledIn(CoSyncLog::Channel::COSYNC_LOG_CHANNEL, CoSyncLog::Level::level) && \
+     CoSyncLog::IsEnabled(CoSyncLog::Channel::COSYNC_LOG_CHANNEL, CoSyncLog::Level::level))
+
+#define COSYNC_LOG_WRITE(level, fmt, ...) \
+    CoSyncLog::Write(CoSyncLog::Level::level, COSYNC_LOG_PREFIX_##level fmt, ##__VA_ARGS__)
+
+#define COSYNC_LOG(level, fmt, ...) \
+    do { if (COSYNC_LOG_ENABLED(level)) COSYNC_LOG_WRITE(level, fmt, ##__VA_ARGS__); } while (0)
+
+#define LOG_INFO(fmt, ...)   COSYNC_LOG(Info,  fmt, ##__VA_ARGS__)
+#define LOG_WARN(fmt, ...)   COSYNC_LOG(Warn,  fmt, ##__VA_ARGS__)
+#define LOG_ERROR(fmt, ...)  COSYNC_LOG(Error, fmt, ##__VA_ARGS__)
+#define LOG_DEBUG(fmt, ...)  COSYNC_LOG(Debug, fmt, ##__VA_ARGS__)
+
+// ------------------------------------------------------
+// Rate-limited variants for hot paths (per call site)
+//   LOG_EVERY_N(Debug, 60, "...")     1st, 61st, 121st, ...
+//   LOG_EVERY_SEC(Warn, 1.0, "...")   at most once per 1 s
+// ------------------------------------------------------
+#define LOG_EVERY_N(level, n, fmt, ...) \
+    do { \
+        if (COSYNC_LOG_ENABLED(level)) \
+        { \
+            static std::atomic<uint32_t> s_cosyncLogHits{ 0 }; \
+            if (s_cosyncLogHits.fetch_add(1, std::memory_order_relaxed) % (n) == 0) \
+                COSYNC_LOG_WRITE(level, fmt, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+#define LOG_EVERY_SEC(level, seconds, fmt, ...) \
+    do { \
+        if (COSYNC_LOG_ENABLED(level)) \
+        { \
+            static std::atomic<int64_t> s_cosyncLogNext{ 0 }; \
+            if (CoSyncLog::RateLimit(s_cosyncLogNext, (seconds))) \
+                COSYNC_LOG_WRITE(level, fmt, ##__VA_ARGS__); \
+        } \
+    } while (0)
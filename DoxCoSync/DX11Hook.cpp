@@ -12,8 +12,6 @@
 #include "imgui_impl_win32.h"
 #include "CoSyncRuntime.h"
 
-#include "GNS_Session.h"  // <<< NEW: so we can tick networking every frame
-
 #pragma comment(lib, "d3d11.lib")
 #pragma comment(lib, "dxgi.lib")
 #pragma comment(lib, "d3dcompiler.lib")
@@ -186,9 +184,8 @@ static HRESULT __stdcall HookedPresent(IDXGISwapChain* pSwapChain, UINT SyncInte
         ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
     }
 
+    // One CoSync frame (GNS pump included in the Receive phase)
     CoSyncRuntime_TickGameThread();
-
-    GNS_Session::Get().Tick();
     
     // Always call original Present at the end
     return g_originalPresent
@@ -11,6 +11,7 @@
 #include "Packets_EntityUpdate.h"
 #include "Packets_EntityDestroy.h"
 #include "CoSyncMessageHelpers.h"
+#include "CoSyncTrace.h"
 
 // ============================================================================
 // ENTITY CREATE
@@ -26,6 +27,8 @@
 
 inline std::string SerializeEntityCreate(const EntityCreatePacket& p)
 {
+    COSYNC_TRACE_SCOPE("Serialize.EntityCreate");
+
     std::ostringstream ss;
     ss << std::fixed << std::setprecision(3);
 
@@ -43,6 +46,8 @@ inline std::string SerializeEntityCreate(const EntityCreatePacket& p)
 
 inline bool DeserializeEntityCreate(const std::string& msg, EntityCreatePacket& out)
 {
+    COSYNC_TRACE_SCOPE("Deserialize.EntityCreate");
+
     if (!IsEntityCreate(msg))
         return false;
 
@@ -105,11 +110,14 @@ inline bool DeserializeEntityCreate(const std::string& msg, EntityCreatePacket&
 //  • UPDATE NEVER spawns
 //  • UPDATE may arrive before CREATE
 //  • timestamp is ALWAYS host-time
-//    (client timestamps are ignored by host)
+//    (clock-synced senders set HostTime; the host keeps those as-is and
+//     stamps its receive time only on unsynced ones)
 // ============================================================================
 
 inline std::string SerializeEntityUpdate(const EntityUpdatePacket& p)
 {
+    COSYNC_TRACE_SCOPE("Serialize.EntityUpdate");
+
     std::ostringstream ss;
     ss << std::fixed << std::setprecision(3);
 
@@ -126,6 +134,8 @@ inline std::string SerializeEntityUpdate(const EntityUpdatePacket& p)
 
 inline bool DeserializeEntityUpdate(const std::string& msg, EntityUpdatePacket& out)
 {
+    COSYNC_TRACE_SCOPE("Deserialize.EntityUpdate");
+
     if (!IsEntityUpdate(msg))
         return false;
 
@@ -180,6 +190,8 @@ inline bool DeserializeEntityUpdate(const std::string& msg, EntityUpdatePacket&
 
 inline std::string SerializeEntityDestroy(const EntityDestroyPacket& p)
 {
+    COSYNC_TRACE_SCOPE("Serialize.EntityDestroy");
+
     std::ostringstream ss;
     ss << "ED|"
         << p.entityID << "|"
@@ -189,6 +201,8 @@ inline std::string SerializeEntityDestroy(const EntityDestroyPacket& p)
 
 inline bool DeserializeEntityDestroy(const std::string& msg, EntityDestroyPacket& out)
 {
+    COSYNC_TRACE_SCOPE("Deserialize.EntityDestroy");
+
     if (!IsEntityDestroy(msg))
         return false;
 
@@ -117,18 +117,6 @@ namespace f4mp
         LOG_INFO("[MAIN] Client connected OK");
     }
 
-    // ------------------------------------------------------------
-    // PER-FRAME TICK (GLOBAL)
-    // ------------------------------------------------------------
-    void F4MP_Main::Tick(double now)
-    {
-        if (!initialized.load())
-            return;
-
-        
-        CoSyncNet::Tick(now);
-    }
-
     // ------------------------------------------------------------
     // Shutdown — clean networking
     // ------------------------------------------------------------
@@ -23,10 +23,6 @@ namespace f4mp
         // Join a host using "IP:PORT"
         void StartJoining(const std::string& connectStr);
 
-        // Global per-frame tick (GAME THREAD ONLY)
-        // This is the ONLY place CoSyncNet::Tick is driven.
-        void Tick(double now);
-
         // Shutdown all networking (called on plugin unload)
         void Shutdown();
 
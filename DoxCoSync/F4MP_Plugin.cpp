@@ -15,6 +15,11 @@
 #include "CoSyncSteamManager.h"
 #include "CoSyncPlayerManager.h"
 #include "CoSyncSpawnTasks.h"
+#include "CoSyncActorPool.h"
+#include "CoSyncFormCache.h"
+#include "CoSyncInterpolation.h"
+#include "CoSyncTransformWriter.h"
+#include "CoSyncPerfStats.h"
 
 
 
@@ -43,6 +48,13 @@ extern "C"
 }
 
 static PluginHandle g_pluginHandle = kPluginHandle_Invalid;
+
+// Optional; LogLevel / LogLevel_<Channel> (see CoSyncLog.h),
+// InterpPosition_<Type> / InterpRotation_<Type> / InterpHistory_<Type>
+// (see CoSyncInterpolation.h), ActorPoolMaxPerBase / ActorPoolMaxTotal
+// (see CoSyncActorPool.h), MaxMovesPerFrame / MovePosEpsilon /
+// MoveRotEpsilon (see CoSyncTransformWriter.h)
+static const char* kCoSyncIniPath = "Data\\F4SE\\Plugins\\DoxCoSync.ini";
 static F4SEMessagingInterface* g_messaging = nullptr;
 
 void OnF4SEMessage(F4SEMessagingInterface::Message* msg)
@@ -59,6 +71,9 @@ void OnF4SEMessage(F4SEMessagingInterface::Message* msg)
 
         f4mp::F4MP_Main::Get().Init();
 
+        // Performance panel model (built from each 1 Hz metrics snapshot)
+        CoSyncPerfStats::Install();
+
 
         LOG_INFO("CoSync: Installing TickHook...");
         InstallTickHook();
@@ -81,6 +96,23 @@ void OnF4SEMessage(F4SEMessagingInterface::Message* msg)
 
         break;
 
+    case F4SEMessagingInterface::kMessage_PreSaveGame:
+        // Pooled proxies are persistent references; keep them out of the save
+        g_CoSyncActorPool.DeleteAll();
+        break;
+
+    case F4SEMessagingInterface::kMessage_PreLoadGame:
+    case F4SEMessagingInterface::kMessage_NewGame:
+        // Pooled actor references and cached form pointers do not survive a load
+        g_CoSyncActorPool.Reset();
+        g_CoSyncFormCache.Invalidate();
+        g_CoSyncTransformWriter.Reset();
+        break;
+
+    case F4SEMessagingInterface::kMessage_PostLoadGame:
+        g_CoSyncFormCache.Invalidate();
+        break;
+
         
     }
 }
@@ -95,6 +127,21 @@ extern "C"
 __declspec(dllexport)
 bool F4SEPlugin_Load(const F4SEInterface* f4se)
 {
+    // Buffered log lines reach F4MP.log even if the game crashes
+    CoSyncLog::InstallCrashFlush();
+
+    if (CoSyncLog::LoadLevels(kCoSyncIniPath))
+        LOG_INFO("[MAIN] Log levels loaded from %s", kCoSyncIniPath);
+
+    if (CoSyncInterpolation::LoadConfig(kCoSyncIniPath))
+        LOG_INFO("[MAIN] Interpolation config loaded from %s", kCoSyncIniPath);
+
+    if (g_CoSyncActorPool.LoadConfig(kCoSyncIniPath))
+        LOG_INFO("[MAIN] Actor pool config loaded from %s", kCoSyncIniPath);
+
+    if (g_CoSyncTransformWriter.LoadConfig(kCoSyncIniPath))
+        LOG_INFO("[MAIN] Transform writer config loaded from %s", kCoSyncIniPath);
+
     LOG_INFO("CoSync - F4SEPlugin_Load");
 
     // ------------------------------------------------------------
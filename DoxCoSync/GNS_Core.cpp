@@ -1,3 +1,5 @@
+#define COSYNC_LOG_CHANNEL GNS
+
 #include "GNS_Core.h"
 #include "ConsoleLogger.h"
 
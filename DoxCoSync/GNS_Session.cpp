@@ -1,4 +1,6 @@
 ﻿// GNS_Session.cpp
+#define COSYNC_LOG_CHANNEL GNS
+
 #include "GNS_Session.h"
 
 #include "ConsoleLogger.h"
@@ -6,6 +8,8 @@
 #include "CoSyncNet.h"
 #include "CoSyncMessageHelpers.h"
 #include "EntitySerialization.h"
+#include "CoSyncTrace.h"
+#include "CoSyncMetrics.h"
 
 #include "steam/steamnetworkingsockets.h"
 #include "steam/isteamnetworkingutils.h"
@@ -311,11 +315,48 @@ void GNS_Session::Host_RemoveAny(HSteamNetConnection conn)
         m_clientConns.size(), m_pendingClientConns.size());
 }
 
+// -----------------------------
+// Metrics
+// -----------------------------
+namespace
+{
+    struct GnsMetrics
+    {
+        CoSyncCounter& rxMsgs = g_CoSyncMetrics.Counter("gns.rx.msgs");
+        CoSyncCounter& rxBytes = g_CoSyncMetrics.Counter("gns.rx.bytes");
+        CoSyncCounter& txMsgs = g_CoSyncMetrics.Counter("gns.tx.msgs");
+        CoSyncCounter& txBytes = g_CoSyncMetrics.Counter("gns.tx.bytes");
+        CoSyncCounter& txFailures = g_CoSyncMetrics.Counter("gns.tx.fail");
+    };
+
+    GnsMetrics& Metrics()
+    {
+        static GnsMetrics s_metrics;
+        return s_metrics;
+    }
+
+    void CountSend(EResult result, uint32 bytes)
+    {
+        GnsMetrics& m = Metrics();
+
+        if (result != k_EResultOK)
+        {
+            m.txFailures.Add();
+            return;
+        }
+
+        m.txMsgs.Add();
+        m.txBytes.Add(bytes);
+    }
+}
+
 // -----------------------------
 // Receive processing
 // -----------------------------
 void GNS_Session::ProcessMessagesOnConnection(HSteamNetConnection conn)
 {
+    COSYNC_TRACE_SCOPE("GNS.Receive");
+
     auto* sock = gSockets();
     if (!sock)
         return;
@@ -325,6 +366,9 @@ void GNS_Session::ProcessMessagesOnConnection(HSteamNetConnection conn)
     if (count <= 0)
         return;
 
+    GnsMetrics& metrics = Metrics();
+    metrics.rxMsgs.Add(static_cast<uint64_t>(count));
+
     for (int i = 0; i < count; i++)
     {
         std::string text(
@@ -332,6 +376,8 @@ void GNS_Session::ProcessMessagesOnConnection(HSteamNetConnection conn)
             static_cast<size_t>(msgs[i]->m_cbSize)
         );
 
+        metrics.rxBytes.Add(text.size());
+
         msgs[i]->Release();
 
         uint64_t sid = 0;
@@ -345,6 +391,8 @@ void GNS_Session::ProcessMessagesOnConnection(HSteamNetConnection conn)
 
 void GNS_Session::ProcessMessagesOnPollGroup()
 {
+    COSYNC_TRACE_SCOPE("GNS.ReceivePollGroup");
+
     auto* sock = gSockets();
     if (!sock || m_pollGroup == k_HSteamNetPollGroup_Invalid)
         return;
@@ -354,12 +402,17 @@ void GNS_Session::ProcessMessagesOnPollGroup()
     if (count <= 0)
         return;
 
+    GnsMetrics& metrics = Metrics();
+    metrics.rxMsgs.Add(static_cast<uint64_t>(count));
+
     for (int i = 0; i < count; i++)
     {
         ISteamNetworkingMessage* m = msgs[i];
         if (!m)
             continue;
 
+        metrics.rxBytes.Add(static_cast<uint64_t>(m->m_cbSize));
+
         const HSteamNetConnection conn = m->m_conn;
 
         std::string text(
@@ -463,6 +516,8 @@ void GNS_Session::HandleConnectionStatusChanged(const SteamNetConnectionStatusCh
 
 void GNS_Session::Tick()
 {
+    COSYNC_TRACE_SCOPE("GNS.Tick");
+
     auto* sock = gSockets();
     if (!sock)
         return;
@@ -489,6 +544,53 @@ void GNS_Session::Tick()
 }
 
 
+// -----------------------------
+// Diagnostics
+// -----------------------------
+size_t GNS_Session::GetConnectionStats(std::vector<GNSConnectionStats>& out) const
+{
+    out.clear();
+
+    auto* sock = gSockets();
+    if (!sock)
+        return 0;
+
+    auto addRow = [&](HSteamNetConnection conn)
+    {
+        SteamNetConnectionRealTimeStatus_t status{};
+        if (sock->GetConnectionRealTimeStatus(conn, &status, 0, nullptr) != k_EResultOK)
+            return;
+
+        GNSConnectionStats row;
+        row.conn = conn;
+        row.pingMs = status.m_nPing;
+        row.qualityLocal = status.m_flConnectionQualityLocal;
+        row.qualityRemote = status.m_flConnectionQualityRemote;
+        row.inBytesPerSec = status.m_flInBytesPerSec;
+        row.outBytesPerSec = status.m_flOutBytesPerSec;
+        row.pendingReliableBytes = status.m_cbPendingReliable;
+
+        auto it = m_peerSteamIDs.find(conn);
+        if (it != m_peerSteamIDs.end())
+            row.steamID = it->second;
+
+        out.push_back(row);
+    };
+
+    if (m_role == GNSRole::Client)
+    {
+        if (m_serverConn != k_HSteamNetConnection_Invalid)
+            addRow(m_serverConn);
+    }
+    else if (m_role == GNSRole::Host)
+    {
+        for (auto conn : m_clientConns)
+            addRow(conn);
+    }
+
+    return out.size();
+}
+
 void GNS_Session::SendText(const std::string& text)
 {
     auto* sock = gSockets();
@@ -503,27 +605,51 @@ void GNS_Session::SendText(const std::string& text)
         if (m_serverConn == k_HSteamNetConnection_Invalid)
             return;
 
-        sock->SendMessageToConnection(
+        CountSend(sock->SendMessageToConnection(
             m_serverConn,
             data,
             cb,
             k_nSteamNetworkingSend_Reliable,
             nullptr
-        );
+        ), cb);
         return;
     }
 
     // Host: broadcast to all fully connected clients only
     for (auto conn : m_clientConns)
     {
-        sock->SendMessageToConnection(
+        CountSend(sock->SendMessageToConnection(
             conn,
             data,
             cb,
             k_nSteamNetworkingSend_Reliable,
             nullptr
-        );
+        ), cb);
+    }
+}
+
+void GNS_Session::SendTextTo(HSteamNetConnection conn, const std::string& text)
+{
+    if (m_role == GNSRole::Client)
+    {
+        SendText(text);
+        return;
     }
+
+    auto* sock = gSockets();
+    if (!sock || !m_connected)
+        return;
+
+    if (m_clientConns.find(conn) == m_clientConns.end())
+        return;
+
+    CountSend(sock->SendMessageToConnection(
+        conn,
+        text.data(),
+        static_cast<uint32>(text.size()),
+        k_nSteamNetworkingSend_Reliable,
+        nullptr
+    ), static_cast<uint32>(text.size()));
 }
 
 std::string GNS_Session::GetHostConnectString() const
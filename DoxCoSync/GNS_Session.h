@@ -2,11 +2,11 @@
 #pragma once
 
 #include <string>
-#include <unordered_set>
-#include <unordered_map>
 #include <cstdint>
+#include <vector>
 
 #include "steam/steamnetworkingsockets.h"
+#include "CoSyncFlatMap.h"
 
 enum class GNSRole
 {
@@ -15,6 +15,20 @@ enum class GNSRole
     Client
 };
 
+// Per-connection link quality (GetConnectionRealTimeStatus)
+struct GNSConnectionStats
+{
+    HSteamNetConnection conn = k_HSteamNetConnection_Invalid;
+    uint64_t steamID = 0;          // 0 until HELLO (host) / always 0 (client)
+
+    int   pingMs = 0;
+    float qualityLocal = 0.f;      // 0..1 delivered in order (1 - loss)
+    float qualityRemote = 0.f;
+    float inBytesPerSec = 0.f;
+    float outBytesPerSec = 0.f;
+    int   pendingReliableBytes = 0;
+};
+
 class GNS_Session
 {
 public:
@@ -35,6 +49,10 @@ public:
     // Client: sends to host connection
     void SendText(const std::string& text);
 
+    // Send text packet to ONE connection (host: a connected client;
+    // client: conn is ignored, goes to the host)
+    void SendTextTo(HSteamNetConnection conn, const std::string& text);
+
     // Host overlay connection string (“25.x.x.x:48000”)
     std::string GetHostConnectString() const;
 
@@ -42,6 +60,9 @@ public:
     GNSRole GetRole() const { return m_role; }
     bool IsConnected() const { return m_connected; }
 
+    // Fills `out` with one row per connected peer (host: clients, client: host)
+    size_t GetConnectionStats(std::vector<GNSConnectionStats>& out) const;
+
 private:
     GNS_Session();
 
@@ -74,8 +95,8 @@ private:
     // Host mode:
     // - pending: accepted but not yet Connected
     // - connected: fully established clients we can treat as "in-session"
-    std::unordered_set<HSteamNetConnection> m_pendingClientConns;
-    std::unordered_set<HSteamNetConnection> m_clientConns;
+    CoSyncFlatSet<HSteamNetConnection> m_pendingClientConns;
+    CoSyncFlatSet<HSteamNetConnection> m_clientConns;
     // Connection -> peer SteamID (tracked on HELLO)
-    std::unordered_map<HSteamNetConnection, uint64_t> m_peerSteamIDs;
+    CoSyncFlatMap<HSteamNetConnection, uint64_t> m_peerSteamIDs;
 };
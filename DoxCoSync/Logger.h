@@ -1,64 +1,44 @@
 #pragma once
 #include <windows.h>
-#include <shlobj.h>
 #include <cstdio>
-#include <cstdarg>
 #include <string>
 
-// ---------- Create full log path ----------
+#include "CoSyncFileSystem.h"
+#include "CoSyncLog.h"
+#include "ConsoleLogger.h"   // COSYNC_LOG_ENABLED
+
+// ---------- Full log path (resolved once) ----------
 inline std::string GetLogPath()
 {
-    char docPath[MAX_PATH]{};
-
-    if (SUCCEEDED(SHGetFolderPathA(NULL, CSIDL_PERSONAL, NULL, SHGFP_TYPE_CURRENT, docPath)))
-    {
-        std::string folder = std::string(docPath) + "\\My Games\\Fallout4\\F4SE";
-        CreateDirectoryA((std::string(docPath) + "\\My Games\\Fallout4").c_str(), NULL);
-        CreateDirectoryA(folder.c_str(), NULL);
+    static const std::string s_path =
+        CoSyncFileSystem::JoinPath(CoSyncFileSystem::GetLogDirectory(), "F4MP.log");
 
-        return folder + "\\F4MP.log";
-    }
-
-    // Fallback: write next to Fallout4.exe
-    return "F4MP.log";
+    return s_path;
 }
 
-// ---------- Thread-safe internal logger ----------
-inline void F4MP_LogInternal(const char* fmt, ...)
+// ---------- Internal logger ----------
+// The file line goes through the CoSyncLog thread (persistent, buffered
+// F4MP.log sink). fmt is the macro's string literal, so the args are
+// packed into the record as-is rather than pre-formatted into one string
+// argument. Debugger output is formatted synchronously, and only when a
+// debugger is attached.
+template <class... Args>
+inline void F4MP_LogInternal(const char* fmt, Args... args)
 {
-    static CRITICAL_SECTION cs;
-    static bool cs_init = false;
-
-    if (!cs_init) {
-        InitializeCriticalSection(&cs);
-        cs_init = true;
-    }
-
-    EnterCriticalSection(&cs);
-
-    char buffer[4096];
-
-    va_list args;
-    va_start(args, fmt);
-    vsnprintf(buffer, sizeof(buffer), fmt, args);
-    va_end(args);
-
-    // Output to debugger
-    OutputDebugStringA(buffer);
-    OutputDebugStringA("\n");
-
-    // Output to log file
-    std::string path = GetLogPath();
-    FILE* f = nullptr;
-    if (fopen_s(&f, path.c_str(), "a") == 0 && f)
+    if (IsDebuggerPresent())
     {
-        fprintf(f, "%s\n", buffer);
-        fclose(f);
+        char buffer[4096];
+        snprintf(buffer, sizeof(buffer), fmt, args...);
+
+        OutputDebugStringA(buffer);
+        OutputDebugStringA("\n");
     }
 
-    LeaveCriticalSection(&cs);
+    CoSyncLog::Write(CoSyncLog::Level::Info, fmt, args...);
 }
 
 // ---------- Macro wrapper ----------
+// Filtered like LOG_INFO (compile-time + runtime level of the caller's
+// COSYNC_LOG_CHANNEL); a disabled call costs one load and compare
 #define F4MP_LOG(fmt, ...) \
-    F4MP_LogInternal("[F4MP] " fmt, ##__VA_ARGS__)
+    do { if (COSYNC_LOG_ENABLED(Info)) F4MP_LogInternal("[F4MP] " fmt, ##__VA_ARGS__); } while (0)
@@ -32,6 +32,7 @@ struct EntityUpdatePacket
         Teleport = 1 << 0, // snap immediately (no smoothing)
         NoRotation = 1 << 1, // ignore rot
         NoVelocity = 1 << 2, // vel not meaningful
+        HostTime = 1 << 3, // timestamp is on the host timeline (clock-synced sender)
     };
 
     uint32_t flags = None;
@@ -48,7 +49,9 @@ struct EntityUpdatePacket
     // Timing
     // -----------------------------------------------------------------
 
-    // Sender-local monotonic timestamp (seconds)
+    // Sample time on the HOST timeline (seconds, see CoSyncClockSync).
+    // Senders stamp HostNow(); unsynced senders leave HostTime unset and
+    // the host stamps its receive time on relay.
     // Used ONLY for interpolation ordering, never authority
     double timestamp = 0.0;
 
@@ -3,6 +3,8 @@
 //   Scriptname CoSync Native Hidden
 // Do NOT change the PSC. This file matches it 1:1.
 
+#define COSYNC_LOG_CHANNEL Papyrus
+
 #include "Papyrus_CoSync.h"
 
 
@@ -17,6 +19,7 @@
 #include "CoSyncNet.h"            // CoSyncNet()
 #include "GNS_Session.h"
 #include "CoSyncLocalPlayer.h"
+#include "CoSyncEntitySnapshot.h"
 
 #include <cmath>                  // atan2f
 
@@ -114,22 +117,34 @@ static void CoSync_SetEntityRef(StaticFunctionTag*, SInt32 entityID, TESObjectRE
     Console_Print("[CoSync] SetEntityRef(id=%d ref=%p) (stub)", entityID, ref);
 }
 
+// Entity queries read the published per-tick snapshot (VM threads never
+// touch the live entity table)
 static bool CoSync_IsEntityValid(StaticFunctionTag*, SInt32 entityID)
 {
-    const bool ok = (entityID >= 0);
-    Console_Print("[CoSync] IsEntityValid(%d) -> %s (stub)", entityID, ok ? "true" : "false");
+    auto snap = g_CoSyncEntitySnapshots.Acquire();
+    const bool ok = snap && snap->Find(static_cast<uint32_t>(entityID)) != nullptr;
+
+    LOG_DEBUG("[Papy-CoSync] IsEntityValid(%d) -> %s", entityID, ok ? "true" : "false");
     return ok;
 }
 
 static VMArray<float> CoSync_GetEntityPosition(StaticFunctionTag*, SInt32 entityID)
 {
-    Console_Print("[CoSync] GetEntityPosition(%d) -> [0,0,0] (stub)", entityID);
+    NiPoint3 pos(0.f, 0.f, 0.f);
+
+    {
+        auto snap = g_CoSyncEntitySnapshots.Acquire();
+        const CoSyncEntityView* view = snap ? snap->Find(static_cast<uint32_t>(entityID)) : nullptr;
+        if (view)
+            pos = view->pos;
+    }
+
+    LOG_DEBUG("[Papy-CoSync] GetEntityPosition(%d) -> [%.1f,%.1f,%.1f]", entityID, pos.x, pos.y, pos.z);
 
     VMArray<float> arr;
-    float z = 0.0f;
-    arr.Push(&z);
-    arr.Push(&z);
-    arr.Push(&z);
+    arr.Push(&pos.x);
+    arr.Push(&pos.y);
+    arr.Push(&pos.z);
     return arr;
 }
 
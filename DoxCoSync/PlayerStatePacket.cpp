@@ -5,16 +5,7 @@
 #include <vector>
 #include <cstdlib>
 
-#define WIN32_LEAN_AND_MEAN
-#include <Windows.h>
-
-static double GetNowSeconds()
-{
-    LARGE_INTEGER f{}, c{};
-    QueryPerformanceFrequency(&f);
-    QueryPerformanceCounter(&c);
-    return double(c.QuadPart) / double(f.QuadPart);
-}
+#include "CoSyncClock.h"
 
 static bool Split(const std::string& s, char delim, std::vector<std::string>& out)
 {
@@ -77,7 +68,7 @@ bool SerializePlayerStateToString(const LocalPlayerState& st, std::string& out)
     ss.setf(std::ios::fixed);
     ss.precision(2);
 
-    const double ts = (st.timestamp > 0.0) ? st.timestamp : GetNowSeconds();
+    const double ts = (st.timestamp > 0.0) ? st.timestamp : CoSyncClock::Now();
 
     ss << "STATE:"
         << st.position.x << "," << st.position.y << "," << st.position.z << "|"
@@ -125,6 +116,6 @@ bool DeserializePlayerStateFromString(const std::string& msg, LocalPlayerState&
     if (!Parse4f(parts[5], out.health, out.maxHealth, out.ap, out.maxActionPoints))
         return false;
 
-    out.timestamp = (parts.size() >= 7) ? std::atof(parts[6].c_str()) : GetNowSeconds();
+    out.timestamp = (parts.size() >= 7) ? std::atof(parts[6].c_str()) : CoSyncClock::Now();
     return true;
 }
@@ -0,0 +1,263 @@
+#include "CoSyncTest.h"
+
+#include "CoSyncActorPool.h"
+
+#include <cstdio>
+#include <set>
+
+// -----------------------------------------------------------------------------
+// CoSyncActorPool against a fake ICoSyncActorEngine
+//
+// Actor* is an opaque handle here: the fake engine hands out addresses
+// inside a static array and tracks which ones are alive and enabled.
+// -----------------------------------------------------------------------------
+namespace
+{
+    constexpr uint32_t kBaseA = 0x0001D16A;
+    constexpr uint32_t kBaseB = 0x0001D16B;
+
+    class FakeActorEngine final : public ICoSyncActorEngine
+    {
+    public:
+        Actor* CreateActor(uint32_t baseFormID, bool initiallyDisabled) override
+        {
+            ++creates;
+            if (failCreates || baseFormID == 0 || m_next >= sizeof(m_storage))
+                return nullptr;
+
+            Actor* actor = reinterpret_cast<Actor*>(&m_storage[m_next++]);
+            alive.insert(actor);
+            if (!initiallyDisabled)
+                enabled.insert(actor);
+            return actor;
+        }
+
+        void EnableActor(Actor* actor) override { enabled.insert(actor); }
+        void DisableActor(Actor* actor) override { enabled.erase(actor); }
+
+        void DeleteActor(Actor* actor) override
+        {
+            ++deletes;
+            enabled.erase(actor);
+            alive.erase(actor);
+        }
+
+        void MoveActorToPlayer(Actor*) override { ++moves; }
+
+        std::set<Actor*> alive;
+        std::set<Actor*> enabled;
+
+        int creates = 0;
+        int deletes = 0;
+        int moves = 0;
+        bool failCreates = false;
+
+    private:
+        char   m_storage[256] = {};
+        size_t m_next = 0;
+    };
+
+    struct Fixture
+    {
+        Fixture() { pool.SetEngine(&engine); }
+
+        FakeActorEngine engine;
+        CoSyncActorPool pool;
+    };
+}
+
+// -----------------------------------------------------------------------------
+// Acquire / Release
+// -----------------------------------------------------------------------------
+COSYNC_TEST(AcquireCreatesThenReusesReleasedActor)
+{
+    Fixture f;
+
+    bool reused = true;
+    Actor* first = f.pool.Acquire(kBaseA, false, &reused);
+    COSYNC_REQUIRE(first != nullptr);
+    COSYNC_CHECK(!reused);
+    COSYNC_CHECK(f.engine.creates == 1);
+    COSYNC_CHECK(f.engine.enabled.count(first) == 1);
+
+    f.pool.Release(kBaseA, first);
+    COSYNC_CHECK(f.engine.enabled.count(first) == 0);
+    COSYNC_CHECK(f.engine.alive.count(first) == 1);
+    COSYNC_CHECK(f.pool.PooledCount(kBaseA) == 1);
+
+    Actor* second = f.pool.Acquire(kBaseA, true, &reused);
+    COSYNC_CHECK(second == first);
+    COSYNC_CHECK(reused);
+    COSYNC_CHECK(f.engine.creates == 1);
+    COSYNC_CHECK(f.engine.moves == 1);
+    COSYNC_CHECK(f.engine.enabled.count(second) == 0);   // startHidden
+    COSYNC_CHECK(f.pool.PooledCount() == 0);
+
+    const CoSyncActorPool::Stats& s = f.pool.GetStats();
+    COSYNC_CHECK(s.acquires == 2 && s.reuses == 1 && s.creates == 1);
+    COSYNC_CHECK(s.ReuseRate() == 0.5);
+}
+
+COSYNC_TEST(PoolIsKeyedByBaseForm)
+{
+    Fixture f;
+
+    Actor* a = f.pool.Acquire(kBaseA, false);
+    f.pool.Release(kBaseA, a);
+
+    bool reused = true;
+    Actor* b = f.pool.Acquire(kBaseB, false, &reused);
+    COSYNC_CHECK(b != a);
+    COSYNC_CHECK(!reused);
+    COSYNC_CHECK(f.pool.PooledCount(kBaseA) == 1);
+}
+
+COSYNC_TEST(ReleaseOverLimitsDeletes)
+{
+    Fixture f;
+    f.pool.SetLimits(1, 2);
+
+    Actor* a[4];
+    for (Actor*& actor : a)
+        actor = f.pool.Acquire(kBaseA, false);
+    Actor* b = f.pool.Acquire(kBaseB, false);
+    Actor* c = f.pool.Acquire(kBaseB, false);
+
+    // Per-base cap: one kept, the rest deleted
+    for (Actor* actor : a)
+        f.pool.Release(kBaseA, actor);
+    COSYNC_CHECK(f.pool.PooledCount(kBaseA) == 1);
+    COSYNC_CHECK(f.engine.deletes == 3);
+
+    // Total cap: the second base fills the last slot
+    f.pool.Release(kBaseB, b);
+    f.pool.Release(kBaseB, c);
+    COSYNC_CHECK(f.pool.PooledCount() == 2);
+    COSYNC_CHECK(f.engine.deletes == 4);
+    COSYNC_CHECK(f.engine.alive.size() == 2);
+    COSYNC_CHECK(f.engine.enabled.empty());
+}
+
+COSYNC_TEST(CreateFailureIsCounted)
+{
+    Fixture f;
+    f.engine.failCreates = true;
+
+    COSYNC_CHECK(f.pool.Acquire(kBaseA, false) == nullptr);
+    COSYNC_CHECK(f.pool.GetStats().createFailures == 1);
+}
+
+// -----------------------------------------------------------------------------
+// Pre-warming
+// -----------------------------------------------------------------------------
+COSYNC_TEST(PrewarmCreatesOneActorPerPump)
+{
+    Fixture f;
+    f.pool.SetPrewarmTarget(kBaseA, 3);
+
+    f.pool.PumpPrewarm();
+    COSYNC_CHECK(f.engine.creates == 1);
+
+    for (int i = 0; i < 10; ++i)
+        f.pool.PumpPrewarm();
+
+    COSYNC_CHECK(f.engine.creates == 3);
+    COSYNC_CHECK(f.pool.PooledCount(kBaseA) == 3);
+    COSYNC_CHECK(f.engine.enabled.empty());
+    COSYNC_CHECK(f.pool.GetStats().prewarmed == 3);
+
+    // Warm actors are handed out without a create
+    bool reused = false;
+    f.pool.Acquire(kBaseA, false, &reused);
+    COSYNC_CHECK(reused);
+    COSYNC_CHECK(f.engine.creates == 3);
+}
+
+COSYNC_TEST(PrewarmTargetIsDroppedOnFailure)
+{
+    Fixture f;
+    f.pool.SetPrewarmTarget(kBaseA, 2);
+    f.engine.failCreates = true;
+
+    f.pool.PumpPrewarm();
+    f.pool.PumpPrewarm();
+    COSYNC_CHECK(f.engine.creates == 1);
+}
+
+// -----------------------------------------------------------------------------
+// Teardown
+// -----------------------------------------------------------------------------
+COSYNC_TEST(DeleteAllRemovesPooledActorsFromTheEngine)
+{
+    Fixture f;
+    f.pool.SetPrewarmTarget(kBaseA, 2);
+    f.pool.PumpPrewarm();
+    f.pool.PumpPrewarm();
+
+    Actor* inUse = f.pool.Acquire(kBaseB, false);
+    Actor* released = f.pool.Acquire(kBaseB, false);
+    f.pool.Release(kBaseB, released);
+    COSYNC_REQUIRE(f.pool.PooledCount() == 3);
+
+    f.pool.DeleteAll();
+
+    // Only the actor still owned by a proxy survives
+    COSYNC_CHECK(f.pool.PooledCount() == 0);
+    COSYNC_CHECK(f.engine.alive.size() == 1);
+    COSYNC_CHECK(f.engine.alive.count(inUse) == 1);
+
+    // Prewarm targets survive teardown and refill
+    f.pool.PumpPrewarm();
+    COSYNC_CHECK(f.pool.PooledCount(kBaseA) == 1);
+}
+
+COSYNC_TEST(ResetForgetsWithoutEngineCalls)
+{
+    Fixture f;
+    f.pool.Release(kBaseA, f.pool.Acquire(kBaseA, false));
+    COSYNC_REQUIRE(f.pool.PooledCount() == 1);
+
+    const int deletesBefore = f.engine.deletes;
+    f.pool.Reset();
+
+    COSYNC_CHECK(f.pool.PooledCount() == 0);
+    COSYNC_CHECK(f.engine.deletes == deletesBefore);
+
+    bool reused = true;
+    f.pool.Acquire(kBaseA, false, &reused);
+    COSYNC_CHECK(!reused);
+}
+
+// -----------------------------------------------------------------------------
+// Config
+// -----------------------------------------------------------------------------
+COSYNC_TEST(LoadConfigAppliesLimits)
+{
+    const char* path = "actorpool_test.ini";
+
+    FILE* file = std::fopen(path, "w");
+    COSYNC_REQUIRE(file != nullptr);
+    std::fputs("ActorPoolMaxPerBase = 2\n"
+        "ActorPoolMaxTotal = 3\n", file);
+    std::fclose(file);
+
+    Fixture f;
+    COSYNC_CHECK(f.pool.LoadConfig(path));
+    COSYNC_CHECK(!f.pool.LoadConfig("actorpool_test_missing.ini"));
+
+    Actor* a[3];
+    for (Actor*& actor : a)
+        actor = f.pool.Acquire(kBaseA, false);
+    for (Actor* actor : a)
+        f.pool.Release(kBaseA, actor);
+
+    COSYNC_CHECK(f.pool.PooledCount(kBaseA) == 2);
+    COSYNC_CHECK(f.engine.deletes == 1);
+
+    std::remove(path);
+}
+
+int main()
+{
+    return CoSyncTest::RunAll();
+}
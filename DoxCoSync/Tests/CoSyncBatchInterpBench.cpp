@@ -0,0 +1,119 @@
+#include "CoSyncBatchInterp.h"
+#include "CoSyncClock.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// CoSyncBatchInterp cost per frame
+//
+// One smoothing pass (Clear + Add + Run, as CoSyncPlayerManager does each
+// frame) at 32 / 128 / 512 entities, SSE2 kernel vs ForceScalar fallback.
+// Both paths must produce identical output; a mismatch fails the run.
+// Results go to stdout.
+//
+//   CoSyncBatchInterpBench [frames]
+// -----------------------------------------------------------------------------
+namespace
+{
+    constexpr size_t kEntityCounts[] = { 32, 128, 512 };
+    constexpr int    kDefaultFrames = 5000;
+
+    float Rand(float lo, float hi)
+    {
+        return lo + (hi - lo) * (static_cast<float>(std::rand()) / RAND_MAX);
+    }
+
+    std::vector<CoSyncInterpJob> MakeJobs(size_t count)
+    {
+        std::vector<CoSyncInterpJob> jobs(count);
+        for (CoSyncInterpJob& j : jobs)
+        {
+            j.p0 = NiPoint3(Rand(-4e4f, 4e4f), Rand(-4e4f, 4e4f), Rand(0.f, 2e3f));
+            j.p1 = j.p0 + NiPoint3(Rand(-40.f, 40.f), Rand(-40.f, 40.f), Rand(-5.f, 5.f));
+            j.v0 = NiPoint3(Rand(-400.f, 400.f), Rand(-400.f, 400.f), 0.f);
+            j.v1 = NiPoint3(Rand(-400.f, 400.f), Rand(-400.f, 400.f), 0.f);
+            j.r0 = NiPoint3(0.f, 0.f, Rand(-3.14f, 3.14f));
+            j.r1 = NiPoint3(0.f, 0.f, Rand(-3.14f, 3.14f));
+            j.span = Rand(0.03f, 0.1f);
+            j.elapsed = Rand(0.f, j.span);
+            j.hermite = (std::rand() & 1) != 0;
+            j.shortestArc = (std::rand() & 3) != 0;
+        }
+        return jobs;
+    }
+
+    volatile float s_sink = 0.f;
+
+    // Average microseconds per frame for one full smoothing pass
+    double TimeFrames(CoSyncBatchInterp& batch, const std::vector<CoSyncInterpJob>& jobs, int frames)
+    {
+        float acc = 0.f;
+
+        const int64_t start = CoSyncClock::Ticks();
+        for (int f = 0; f < frames; ++f)
+        {
+            batch.Clear();
+            for (const CoSyncInterpJob& j : jobs)
+                batch.Add(j);
+            batch.Run();
+            acc += batch.Position(f % jobs.size()).x;
+        }
+        const double us = CoSyncClock::MicrosSince(start) / frames;
+
+        s_sink = acc;
+        return us;
+    }
+
+    bool SameBits(const NiPoint3& a, const NiPoint3& b)
+    {
+        return std::memcmp(&a.x, &b.x, sizeof(float)) == 0 &&
+               std::memcmp(&a.y, &b.y, sizeof(float)) == 0 &&
+               std::memcmp(&a.z, &b.z, sizeof(float)) == 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int frames = (argc > 1) ? std::max(1, std::atoi(argv[1])) : kDefaultFrames;
+
+    std::srand(11);
+
+    std::printf("CoSyncBatchInterp (%d frames per run)\n", frames);
+    std::printf("%8s %14s %16s %8s\n", "entities", "sse2 us/frame", "scalar us/frame", "speedup");
+
+    int mismatches = 0;
+
+    for (size_t count : kEntityCounts)
+    {
+        const std::vector<CoSyncInterpJob> jobs = MakeJobs(count);
+
+        CoSyncBatchInterp simd;
+        CoSyncBatchInterp scalar;
+        scalar.SetForceScalar(true);
+
+        const double simdUs = TimeFrames(simd, jobs, frames);
+        const double scalarUs = TimeFrames(scalar, jobs, frames);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!SameBits(simd.Position(i), scalar.Position(i)) ||
+                !SameBits(simd.Rotation(i), scalar.Rotation(i)))
+                ++mismatches;
+        }
+
+        std::printf("%8zu %14.3f %16.3f %7.2fx\n",
+            count, simdUs, scalarUs, simdUs > 0.0 ? scalarUs / simdUs : 0.0);
+    }
+
+    if (mismatches)
+    {
+        std::printf("FAIL: %d rows differ between SSE2 and scalar\n", mismatches);
+        return 1;
+    }
+
+    return 0;
+}
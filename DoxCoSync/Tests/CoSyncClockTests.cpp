@@ -0,0 +1,118 @@
+#include "CoSyncTest.h"
+
+#include "CoSyncClock.h"
+
+// -----------------------------------------------------------------------------
+// CoSyncClock: real backend, frame time caching, and the virtual clock the
+// timer wheel / dead reckoning / interpolation suites run on
+// -----------------------------------------------------------------------------
+namespace
+{
+    // Leaves the process on the real clock whatever a case does
+    struct VirtualClock
+    {
+        explicit VirtualClock(double start) { CoSyncClock::UseVirtualClock(start); }
+        ~VirtualClock() { CoSyncClock::UseRealClock(); }
+    };
+}
+
+// -----------------------------------------------------------------------------
+// Real clock
+// -----------------------------------------------------------------------------
+COSYNC_TEST(RealClockIsMonotonic)
+{
+    COSYNC_CHECK(!CoSyncClock::IsVirtual());
+
+    double prev = CoSyncClock::Now();
+    for (int i = 0; i < 10000; ++i)
+    {
+        const double now = CoSyncClock::Now();
+        COSYNC_REQUIRE(now >= prev);
+        prev = now;
+    }
+
+    const int64_t start = CoSyncClock::Ticks();
+    COSYNC_CHECK(CoSyncClock::MicrosSince(start) >= 0.0);
+    COSYNC_CHECK(CoSyncClock::TicksToMicros(0) == 0.0);
+}
+
+COSYNC_TEST(FrameTimeIsCachedUntilNextFrame)
+{
+    VirtualClock clock(5.0);
+
+    // No frame yet: falls through to Now()
+    COSYNC_CHECK(CoSyncClock::FrameTime() == 5.0);
+
+    COSYNC_CHECK(CoSyncClock::BeginFrame() == 5.0);
+    CoSyncClock::AdvanceVirtual(0.5);
+
+    COSYNC_CHECK(CoSyncClock::Now() == 5.5);
+    COSYNC_CHECK(CoSyncClock::FrameTime() == 5.0);
+
+    COSYNC_CHECK(CoSyncClock::BeginFrame() == 5.5);
+    COSYNC_CHECK(CoSyncClock::FrameTime() == 5.5);
+}
+
+// -----------------------------------------------------------------------------
+// Virtual clock
+// -----------------------------------------------------------------------------
+COSYNC_TEST(VirtualTimeOnlyMovesWhenTold)
+{
+    VirtualClock clock(100.0);
+    COSYNC_CHECK(CoSyncClock::IsVirtual());
+
+    COSYNC_CHECK(CoSyncClock::Now() == 100.0);
+    COSYNC_CHECK(CoSyncClock::Now() == 100.0);
+
+    CoSyncClock::AdvanceVirtual(0.25);
+    COSYNC_CHECK(CoSyncClock::Now() == 100.25);
+
+    // Never runs backwards through AdvanceVirtual
+    CoSyncClock::AdvanceVirtual(-1.0);
+    CoSyncClock::AdvanceVirtual(0.0);
+    COSYNC_CHECK(CoSyncClock::Now() == 100.25);
+
+    // SetVirtualTime is absolute (replay seeks)
+    CoSyncClock::SetVirtualTime(42.0);
+    COSYNC_CHECK(CoSyncClock::Now() == 42.0);
+}
+
+COSYNC_TEST(SwitchingClocksDropsTheCachedFrame)
+{
+    {
+        VirtualClock clock(1000.0);
+        CoSyncClock::BeginFrame();
+        COSYNC_CHECK(CoSyncClock::FrameTime() == 1000.0);
+
+        // A new virtual session doesn't see the previous frame
+        CoSyncClock::UseVirtualClock(7.0);
+        COSYNC_CHECK(CoSyncClock::FrameTime() == 7.0);
+        CoSyncClock::BeginFrame();
+    }
+
+    // Back on the real clock: the virtual frame time doesn't leak
+    COSYNC_CHECK(!CoSyncClock::IsVirtual());
+
+    const double before = CoSyncClock::Now();
+    const double frame = CoSyncClock::FrameTime();
+    COSYNC_CHECK(frame >= before && frame <= CoSyncClock::Now());
+}
+
+COSYNC_TEST(TicksStayRealUnderVirtualClock)
+{
+    VirtualClock clock(0.0);
+
+    // Instrumentation keeps measuring wall time while simulation is frozen
+    const int64_t start = CoSyncClock::Ticks();
+    volatile double sink = 0.0;
+    for (int i = 0; i < 100000; ++i)
+        sink = sink + CoSyncClock::Now();
+
+    COSYNC_CHECK(CoSyncClock::Ticks() > start);
+    COSYNC_CHECK(CoSyncClock::Now() == 0.0);
+}
+
+int main()
+{
+    return CoSyncTest::RunAll();
+}
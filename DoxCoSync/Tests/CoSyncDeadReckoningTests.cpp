@@ -0,0 +1,205 @@
+#include "CoSyncTest.h"
+
+#include "CoSyncClock.h"
+#include "CoSyncDeadReckoning.h"
+
+#include <cmath>
+
+// -----------------------------------------------------------------------------
+// CoSyncDeadReckoning: extrapolation error against a ground-truth path
+//
+// Replays CoSyncLocalPlayer's send policy (60 fps sampling, 20 Hz send step,
+// 4 unit error tolerance, 1 s heartbeat) over scripted movement. A lossless
+// zero-latency receiver extrapolates from the last update it got; its error
+// against the true path is what the tolerance is supposed to bound. Frames
+// run on CoSyncClock's virtual clock.
+// -----------------------------------------------------------------------------
+namespace
+{
+    constexpr double kFrameSec = 1.0 / 60.0;
+    constexpr int    kFramesPerStep = 3;            // 20 Hz send step
+    constexpr double kStepSec = kFrameSec * kFramesPerStep;
+    constexpr float  kMoveThreshold = 4.0f;         // CoSyncLocalPlayer default
+    constexpr double kHeartbeatSec = 1.0;
+    constexpr float  kRunSpeed = 350.0f;            // units/s
+    constexpr double kStart = 10.0;
+
+    using Path = NiPoint3(*)(double t);
+
+    NiPoint3 StandStill(double)
+    {
+        return NiPoint3(100.f, 200.f, 0.f);
+    }
+
+    NiPoint3 StraightRun(double t)
+    {
+        return NiPoint3(kRunSpeed * static_cast<float>(t), 0.f, 0.f);
+    }
+
+    NiPoint3 CircleStrafe(double t)
+    {
+        const double radius = 500.0;
+        const double w = kRunSpeed / radius;
+        return NiPoint3(
+            static_cast<float>(radius * std::cos(w * t)),
+            static_cast<float>(radius * std::sin(w * t)),
+            0.f);
+    }
+
+    // Run 2 s, stand 2 s, repeat
+    NiPoint3 StopAndGo(double t)
+    {
+        const double cycles = std::floor(t / 4.0);
+        const double phase = t - cycles * 4.0;
+        const double run = cycles * 2.0 + ((phase < 2.0) ? phase : 2.0);
+        return NiPoint3(kRunSpeed * static_cast<float>(run), 0.f, 0.f);
+    }
+
+    struct Result
+    {
+        int    steps = 0;
+        int    sends = 0;
+        float  maxErr = 0.f;         // receiver error on any frame
+        double meanErr = 0.0;
+    };
+
+    Result Simulate(Path path, double seconds)
+    {
+        CoSyncClock::UseVirtualClock(kStart);
+
+        NiPoint3 sentPos, sentVel;
+        double sentTime = 0.0;
+        bool hasSent = false;
+
+        NiPoint3 prevPos;
+        double prevTime = 0.0;
+        bool hasPrev = false;
+
+        Result r;
+        double errSum = 0.0;
+        const int frames = static_cast<int>(seconds / kFrameSec);
+
+        for (int f = 0; f < frames; ++f)
+        {
+            CoSyncClock::AdvanceVirtual(kFrameSec);
+            const double now = CoSyncClock::BeginFrame();
+            const NiPoint3 truth = path(now - kStart);
+
+            // SampleLocal: finite-difference velocity
+            NiPoint3 vel;
+            if (hasPrev)
+                vel = (truth - prevPos) / static_cast<float>(now - prevTime);
+            prevPos = truth;
+            prevTime = now;
+            hasPrev = true;
+
+            // Send step
+            if (f % kFramesPerStep == 0)
+            {
+                ++r.steps;
+
+                const double sinceSent = now - sentTime;
+                const float errSq = hasSent
+                    ? CoSyncDeadReckoning::PredictionErrorSq(sentPos, sentVel, sinceSent, truth)
+                    : 1e30f;
+
+                if (errSq > kMoveThreshold * kMoveThreshold || sinceSent >= kHeartbeatSec)
+                {
+                    sentPos = truth;
+                    sentVel = vel;
+                    sentTime = now;
+                    hasSent = true;
+                    ++r.sends;
+                }
+            }
+
+            // Receiver display vs truth
+            if (hasSent)
+            {
+                const NiPoint3 shown = CoSyncDeadReckoning::Extrapolate(sentPos, sentVel, now - sentTime);
+                const float err = std::sqrt(CoSyncDeadReckoning::DistanceSq(shown, truth));
+                r.maxErr = std::fmax(r.maxErr, err);
+                errSum += err;
+            }
+        }
+
+        CoSyncClock::UseRealClock();
+
+        r.meanErr = errSum / frames;
+        return r;
+    }
+
+    // Between send steps the error can grow by at most one step of motion
+    constexpr float kFrameErrBound = kMoveThreshold + kRunSpeed * static_cast<float>(kStepSec);
+}
+
+// -----------------------------------------------------------------------------
+// Model
+// -----------------------------------------------------------------------------
+COSYNC_TEST(ExtrapolationIsLinearAndClamped)
+{
+    const NiPoint3 pos(10.f, 20.f, 30.f);
+    const NiPoint3 vel(100.f, -50.f, 0.f);
+
+    const NiPoint3 a = CoSyncDeadReckoning::Extrapolate(pos, vel, 0.1);
+    COSYNC_CHECK(std::fabs(a.x - 20.f) < 1e-4f && std::fabs(a.y - 15.f) < 1e-4f && a.z == 30.f);
+
+    // Never backwards, never past the shared horizon
+    const NiPoint3 back = CoSyncDeadReckoning::Extrapolate(pos, vel, -1.0);
+    COSYNC_CHECK(CoSyncDeadReckoning::DistanceSq(back, pos) == 0.f);
+
+    const NiPoint3 atClamp = CoSyncDeadReckoning::Extrapolate(pos, vel, CoSyncDeadReckoning::kMaxExtrapolationSec);
+    const NiPoint3 far = CoSyncDeadReckoning::Extrapolate(pos, vel, 30.0);
+    COSYNC_CHECK(CoSyncDeadReckoning::DistanceSq(atClamp, far) == 0.f);
+}
+
+// -----------------------------------------------------------------------------
+// Error vs ground truth
+// -----------------------------------------------------------------------------
+COSYNC_TEST(StandingStillOnlyHeartbeats)
+{
+    const Result r = Simulate(&StandStill, 20.0);
+
+    COSYNC_CHECK(r.maxErr == 0.f);
+    COSYNC_CHECK(r.sends >= 19 && r.sends <= 21);
+}
+
+COSYNC_TEST(StraightRunStaysWithinTolerance)
+{
+    const Result r = Simulate(&StraightRun, 20.0);
+
+    COSYNC_CHECK(r.maxErr <= kFrameErrBound);
+
+    // Resends are forced by the extrapolation clamp, not by error; still
+    // well under the 20 Hz step rate
+    COSYNC_CHECK(r.sends * 4 < r.steps);
+}
+
+COSYNC_TEST(CircleStrafeStaysWithinTolerance)
+{
+    const Result r = Simulate(&CircleStrafe, 20.0);
+
+    COSYNC_CHECK(r.maxErr <= kFrameErrBound);
+    COSYNC_CHECK(r.meanErr < kMoveThreshold);
+
+    // Velocity keeps turning, so this resends most; still a fraction of 20 Hz
+    COSYNC_CHECK(r.sends * 3 < r.steps);
+}
+
+COSYNC_TEST(SuddenStopIsCorrectedWithinAStep)
+{
+    const Result r = Simulate(&StopAndGo, 16.0);
+
+    // Receiver overshoots a stop by at most one step of motion before the
+    // next send step catches it
+    COSYNC_CHECK(r.maxErr <= kFrameErrBound);
+
+    // Standing halves are heartbeat-only
+    const Result run = Simulate(&StraightRun, 16.0);
+    COSYNC_CHECK(r.sends < run.sends);
+}
+
+int main()
+{
+    return CoSyncTest::RunAll();
+}
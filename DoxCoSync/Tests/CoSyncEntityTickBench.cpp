@@ -0,0 +1,282 @@
+#include "CoSyncClock.h"
+#include "CoSyncEntityTable.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// PlayerManager entity walks: CoSyncEntityTable vs the old two-map layout
+//
+// Before the table, proxies lived in unordered_map<id, unique_ptr<CoSyncPlayer>>
+// and state in a parallel unordered_map<id, CoSyncEntityState>; every loop
+// hashed into the second map per entity. Per simulated frame:
+//   updates : route this frame's UPDATEs (20 Hz of 60 fps) to state + proxy
+//   smooth  : pick spawned, non-NPC proxies (TickSmoothing's gather)
+//   npc send: pick spawned, host-authoritative NPCs (HostSendNpcUpdates)
+// Session mix: 1 in 4 entities is a player, the rest are NPCs. Both layouts
+// must visit the same rows. Results go to stdout (ns per frame).
+//
+//   CoSyncEntityTickBench [frames]
+// -----------------------------------------------------------------------------
+namespace
+{
+    constexpr size_t kSizes[] = { 16, 64, 256 };
+    constexpr int    kDefaultFrames = 20000;
+    constexpr int    kFramesPerUpdate = 3;
+
+    volatile uint64_t s_sink = 0;
+
+    Actor* FakeActor(uint32_t entityID)
+    {
+        // Never dereferenced; only compared / forwarded
+        return reinterpret_cast<Actor*>(static_cast<uintptr_t>(entityID) * 64);
+    }
+
+    struct Spec
+    {
+        uint32_t entityID;
+        bool     isNPC;
+    };
+
+    void Seed(CoSyncEntityState& st, CoSyncPlayer& pl, const Spec& s)
+    {
+        st.hasCreate = true;
+        st.isNPC = s.isNPC;
+        st.hostAuthoritative = s.isNPC;
+        st.lastCreate.entityID = s.entityID;
+        st.lastCreate.type = s.isNPC ? CoSyncEntityType::NPC : CoSyncEntityType::Player;
+
+        pl.entityID = s.entityID;
+        pl.createType = st.lastCreate.type;
+        pl.isRemoteControlled = true;
+        pl.actorRef = FakeActor(s.entityID);
+        pl.hasSpawned = true;
+        pl.authoritativePos = NiPoint3(float(s.entityID), 0.f, 0.f);
+    }
+
+    // -------------------------------------------------------------------------
+    // Old: two unordered_maps
+    // -------------------------------------------------------------------------
+    struct TwoMaps
+    {
+        std::unordered_map<uint32_t, std::unique_ptr<CoSyncPlayer>> players;
+        std::unordered_map<uint32_t, CoSyncEntityState> states;
+
+        explicit TwoMaps(const std::vector<Spec>& specs)
+        {
+            for (const Spec& s : specs)
+            {
+                std::unique_ptr<CoSyncPlayer> pl(new CoSyncPlayer("Remote"));
+                CoSyncEntityState& st = states[s.entityID];
+                st.entityID = s.entityID;
+                Seed(st, *pl, s);
+                players.emplace(s.entityID, std::move(pl));
+            }
+        }
+
+        uint64_t Frame(const uint32_t* updates, size_t updateCount, double now)
+        {
+            uint64_t acc = 0;
+
+            for (size_t i = 0; i < updateCount; ++i)
+            {
+                auto st = states.find(updates[i]);
+                auto pl = players.find(updates[i]);
+                if (st == states.end() || pl == players.end())
+                    continue;
+
+                st->second.lastUpdateLocalTime = now;
+                pl->second->m_lastRecvLocalTime = now;
+                acc += updates[i];
+            }
+
+            for (auto& kv : players)
+            {
+                CoSyncPlayer& ent = *kv.second;
+                if (!ent.hasSpawned)
+                    continue;
+
+                auto it = states.find(ent.entityID);
+                if (it != states.end() && it->second.hasCreate &&
+                    it->second.lastCreate.type == CoSyncEntityType::NPC)
+                    continue;
+
+                acc += ent.m_tfBuffer.Size() + static_cast<uint64_t>(ent.m_lastRecvLocalTime);
+            }
+
+            for (auto& kv : players)
+            {
+                CoSyncPlayer& npc = *kv.second;
+                if (!npc.hasSpawned || !npc.actorRef)
+                    continue;
+
+                auto it = states.find(npc.entityID);
+                if (it == states.end() || !it->second.hasCreate)
+                    continue;
+
+                const CoSyncEntityState& st = it->second;
+                if (st.lastCreate.type != CoSyncEntityType::NPC || !st.hostAuthoritative)
+                    continue;
+
+                if (!EntityCreatePacket::HasFlag(st.lastCreate.spawnFlags, EntityCreatePacket::RemoteControlled))
+                    continue;
+
+                acc += reinterpret_cast<uintptr_t>(npc.actorRef);
+            }
+
+            return acc;
+        }
+    };
+
+    // -------------------------------------------------------------------------
+    // New: CoSyncEntityTable
+    // -------------------------------------------------------------------------
+    struct Table
+    {
+        CoSyncEntityTable entities;
+
+        explicit Table(const std::vector<Spec>& specs)
+        {
+            for (const Spec& s : specs)
+            {
+                const size_t row = entities.RowOf(entities.FindOrInsert(s.entityID));
+                Seed(entities.StateAt(row), entities.PlayerAt(row), s);
+                entities.RefreshHotColumns(row);
+            }
+        }
+
+        uint64_t Frame(const uint32_t* updates, size_t updateCount, double now)
+        {
+            uint64_t acc = 0;
+
+            for (size_t i = 0; i < updateCount; ++i)
+            {
+                const size_t row = entities.RowOf(entities.Find(updates[i]));
+                if (row >= entities.Size())
+                    continue;
+
+                entities.StateAt(row).lastUpdateLocalTime = now;
+                entities.PlayerAt(row).m_lastRecvLocalTime = now;
+                acc += updates[i];
+            }
+
+            for (size_t row = 0; row < entities.Size(); ++row)
+            {
+                const uint8_t flags = entities.FlagsAt(row);
+                if (!(flags & CoSyncEntityTable::kHot_Spawned))
+                    continue;
+
+                if ((flags & CoSyncEntityTable::kHot_HasCreate) &&
+                    (flags & CoSyncEntityTable::kHot_NPC))
+                    continue;
+
+                const CoSyncPlayer& ent = entities.PlayerAt(row);
+                acc += ent.m_tfBuffer.Size() + static_cast<uint64_t>(ent.m_lastRecvLocalTime);
+            }
+
+            constexpr uint8_t kWanted =
+                CoSyncEntityTable::kHot_Spawned |
+                CoSyncEntityTable::kHot_HasCreate |
+                CoSyncEntityTable::kHot_NPC |
+                CoSyncEntityTable::kHot_HostAuthoritative;
+
+            for (size_t row = 0; row < entities.Size(); ++row)
+            {
+                if ((entities.FlagsAt(row) & kWanted) != kWanted)
+                    continue;
+
+                const CoSyncEntityState& st = entities.StateAt(row);
+                if (!EntityCreatePacket::HasFlag(st.lastCreate.spawnFlags, EntityCreatePacket::RemoteControlled))
+                    continue;
+
+                acc += reinterpret_cast<uintptr_t>(entities.ActorAt(row));
+            }
+
+            return acc;
+        }
+    };
+
+    // -------------------------------------------------------------------------
+    // Driver
+    // -------------------------------------------------------------------------
+    struct Result
+    {
+        double   nsPerFrame = 0.0;
+        uint64_t checksum = 0;
+    };
+
+    template <class Layout>
+    Result Run(const std::vector<Spec>& specs, const std::vector<uint32_t>& updateOrder, int frames)
+    {
+        Layout layout(specs);
+
+        // Each entity sends every kFramesPerUpdate frames, phases staggered
+        const size_t perFrame = (updateOrder.size() + kFramesPerUpdate - 1) / kFramesPerUpdate;
+
+        CoSyncClock::UseVirtualClock(1.0);
+
+        Result r;
+        const int64_t start = CoSyncClock::Ticks();
+
+        for (int f = 0; f < frames; ++f)
+        {
+            CoSyncClock::AdvanceVirtual(1.0 / 60.0);
+            const double now = CoSyncClock::BeginFrame();
+
+            const size_t first = (f % kFramesPerUpdate) * perFrame;
+            const size_t count = std::min(perFrame, updateOrder.size() - std::min(first, updateOrder.size()));
+
+            r.checksum += layout.Frame(updateOrder.data() + first, count, now);
+        }
+
+        r.nsPerFrame = CoSyncClock::MicrosSince(start) * 1000.0 / frames;
+
+        CoSyncClock::UseRealClock();
+        return r;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int frames = (argc > 1) ? std::max(1, std::atoi(argv[1])) : kDefaultFrames;
+
+    std::printf("PlayerManager entity walks (ns/frame, %d frames)\n", frames);
+    std::printf("  %-9s %14s %14s %8s\n", "entities", "two maps", "entity table", "speedup");
+
+    int rc = 0;
+
+    for (size_t size : kSizes)
+    {
+        // Sparse IDs, as handed out by the host
+        std::mt19937 rng(static_cast<uint32_t>(size));
+        std::vector<Spec> specs(size);
+        for (size_t i = 0; i < size; ++i)
+            specs[i] = Spec{ 1000u + static_cast<uint32_t>(i * 37 + rng() % 16), (i % 4) != 0 };
+
+        std::vector<uint32_t> updateOrder(size);
+        for (size_t i = 0; i < size; ++i)
+            updateOrder[i] = specs[i].entityID;
+        std::shuffle(updateOrder.begin(), updateOrder.end(), rng);
+
+        const Result maps = Run<TwoMaps>(specs, updateOrder, frames);
+        const Result table = Run<Table>(specs, updateOrder, frames);
+
+        s_sink = maps.checksum + table.checksum;
+
+        std::printf("  %-9zu %14.1f %14.1f %7.2fx\n",
+            size, maps.nsPerFrame, table.nsPerFrame, maps.nsPerFrame / table.nsPerFrame);
+
+        if (maps.checksum != table.checksum)
+        {
+            std::printf("MISMATCH at %zu entities: layouts visited different rows\n", size);
+            rc = 1;
+        }
+    }
+
+    return rc;
+}
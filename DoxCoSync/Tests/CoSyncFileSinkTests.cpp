@@ -0,0 +1,276 @@
+#include "CoSyncTest.h"
+
+#include "CoSyncFileSink.h"
+#include "CoSyncFileSystem.h"
+
+#include <cstring>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// CoSyncFileSink: rotation, flush triggers, RotatedPath
+//
+// Files are created under ./filesink_test (the test's working directory).
+// -----------------------------------------------------------------------------
+namespace
+{
+    const std::string kDir = "filesink_test";
+
+    std::string TestPath(const char* name)
+    {
+        CoSyncFileSystem::EnsureDirectory(kDir);
+        return CoSyncFileSystem::JoinPath(kDir, name);
+    }
+
+    // Removes the log and every backup a test could have produced
+    void RemoveLogs(const CoSyncFileSink& sink)
+    {
+        CoSyncFileSystem::RemoveFile(sink.GetPath());
+
+        for (uint32_t n = 1; n <= 8; ++n)
+            CoSyncFileSystem::RemoveFile(sink.RotatedPath(n));
+    }
+
+    std::string ReadAll(const std::string& path)
+    {
+        std::string out;
+
+        FILE* f = CoSyncFileSystem::OpenFile(path, "rb");
+        if (!f)
+            return out;
+
+        char buf[4096];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+            out.append(buf, n);
+
+        fclose(f);
+        return out;
+    }
+
+    void WriteLine(CoSyncFileSink& sink, CoSyncLog::Level level, const char* line)
+    {
+        sink.Write(level, 1.0, line, std::strlen(line));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// RotatedPath
+// -----------------------------------------------------------------------------
+COSYNC_TEST(RotatedPathInsertsIndexBeforeExtension)
+{
+    CoSyncFileSink sink("logs/F4MP.log");
+
+    COSYNC_CHECK(sink.RotatedPath(1) == "logs/F4MP.1.log");
+    COSYNC_CHECK(sink.RotatedPath(2) == "logs/F4MP.2.log");
+}
+
+COSYNC_TEST(RotatedPathWithoutExtensionAppendsIndex)
+{
+    CoSyncFileSink plain("F4MP");
+    COSYNC_CHECK(plain.RotatedPath(1) == "F4MP.1");
+
+    // A dot in the directory is not an extension
+    CoSyncFileSink dotted("my.logs/F4MP");
+    COSYNC_CHECK(dotted.RotatedPath(3) == "my.logs/F4MP.3");
+
+    CoSyncFileSink windows("C:\\My.Games\\F4MP");
+    COSYNC_CHECK(windows.RotatedPath(1) == "C:\\My.Games\\F4MP.1");
+}
+
+// -----------------------------------------------------------------------------
+// Flush triggers
+// -----------------------------------------------------------------------------
+COSYNC_TEST(InfoLinesStayBufferedUntilFlush)
+{
+    CoSyncFileSink::Config config;
+    config.flushIntervalSec = 3600.0;
+
+    CoSyncFileSink sink(TestPath("buffered.log"), config);
+    RemoveLogs(sink);
+
+    WriteLine(sink, CoSyncLog::Level::Info, "first");
+    sink.EndBatch();
+
+    COSYNC_CHECK(CoSyncFileSystem::FileSize(sink.GetPath()) <= 0);
+    COSYNC_CHECK(sink.GetStats().flushes == 0);
+
+    sink.Flush();
+
+    COSYNC_CHECK(ReadAll(sink.GetPath()).find("first") != std::string::npos);
+    COSYNC_CHECK(sink.GetStats().flushes == 1);
+
+    RemoveLogs(sink);
+}
+
+COSYNC_TEST(ErrorLineFlushesImmediately)
+{
+    CoSyncFileSink::Config config;
+    config.flushIntervalSec = 3600.0;
+
+    CoSyncFileSink sink(TestPath("error.log"), config);
+    RemoveLogs(sink);
+
+    WriteLine(sink, CoSyncLog::Level::Warn, "before the error");
+    COSYNC_CHECK(CoSyncFileSystem::FileSize(sink.GetPath()) <= 0);
+
+    WriteLine(sink, CoSyncLog::Level::Error, "the error");
+
+    // Everything buffered so far lands with the Error line, in order
+    const std::string text = ReadAll(sink.GetPath());
+    const size_t warn = text.find("before the error");
+    const size_t error = text.find("the error", warn + 1);
+
+    COSYNC_CHECK(warn != std::string::npos);
+    COSYNC_CHECK(error != std::string::npos && error > warn);
+    COSYNC_CHECK(sink.GetStats().flushes == 1);
+
+    RemoveLogs(sink);
+}
+
+COSYNC_TEST(EndBatchFlushesAfterInterval)
+{
+    CoSyncFileSink::Config config;
+    config.flushIntervalSec = 0.0;
+
+    CoSyncFileSink sink(TestPath("interval.log"), config);
+    RemoveLogs(sink);
+
+    WriteLine(sink, CoSyncLog::Level::Info, "timed");
+    sink.EndBatch();
+
+    COSYNC_CHECK(ReadAll(sink.GetPath()).find("timed") != std::string::npos);
+
+    RemoveLogs(sink);
+}
+
+COSYNC_TEST(FullBufferFlushesWithoutLosingBytes)
+{
+    CoSyncFileSink::Config config;
+    config.bufferBytes = 1024;
+    config.flushIntervalSec = 3600.0;
+
+    CoSyncFileSink sink(TestPath("full.log"), config);
+    RemoveLogs(sink);
+
+    const std::string line(300, 'x');
+    for (int i = 0; i < 10; ++i)
+        WriteLine(sink, CoSyncLog::Level::Info, line.c_str());
+
+    COSYNC_CHECK(sink.GetStats().flushes > 0);
+
+    sink.Flush();
+
+    const CoSyncFileSink::Stats stats = sink.GetStats();
+    COSYNC_CHECK(stats.writeErrors == 0);
+    COSYNC_CHECK(int64_t(stats.bytesWritten) == CoSyncFileSystem::FileSize(sink.GetPath()));
+
+    RemoveLogs(sink);
+}
+
+// -----------------------------------------------------------------------------
+// Rotation
+// -----------------------------------------------------------------------------
+COSYNC_TEST(RotationKeepsMaxFilesAndCapsSize)
+{
+    CoSyncFileSink::Config config;
+    config.bufferBytes = 1024;
+    config.maxFileBytes = 2048;
+    config.maxFiles = 3;
+    config.flushIntervalSec = 3600.0;
+
+    CoSyncFileSink sink(TestPath("rotate.log"), config);
+    RemoveLogs(sink);
+
+    // ~100 bytes per line, flushed every 4 lines: many rotations
+    const std::string line(80, 'r');
+    for (int i = 0; i < 200; ++i)
+    {
+        WriteLine(sink, CoSyncLog::Level::Info, line.c_str());
+        if ((i % 4) == 3)
+            sink.Flush();
+    }
+    sink.Flush();
+
+    const CoSyncFileSink::Stats stats = sink.GetStats();
+    COSYNC_CHECK(stats.rotations >= 2);
+    COSYNC_CHECK(stats.writeErrors == 0);
+
+    // current + two backups, oldest dropped
+    COSYNC_CHECK(CoSyncFileSystem::FileExists(sink.GetPath()));
+    COSYNC_CHECK(CoSyncFileSystem::FileExists(sink.RotatedPath(1)));
+    COSYNC_CHECK(CoSyncFileSystem::FileExists(sink.RotatedPath(2)));
+    COSYNC_CHECK(!CoSyncFileSystem::FileExists(sink.RotatedPath(3)));
+
+    COSYNC_CHECK(CoSyncFileSystem::FileSize(sink.GetPath()) <= int64_t(config.maxFileBytes));
+    COSYNC_CHECK(CoSyncFileSystem::FileSize(sink.RotatedPath(1)) <= int64_t(config.maxFileBytes));
+    COSYNC_CHECK(CoSyncFileSystem::FileSize(sink.RotatedPath(2)) <= int64_t(config.maxFileBytes));
+
+    RemoveLogs(sink);
+}
+
+COSYNC_TEST(OversizedExistingLogRotatesOnOpen)
+{
+    CoSyncFileSink::Config config;
+    config.maxFileBytes = 1024;
+    config.maxFiles = 2;
+
+    const std::string path = TestPath("existing.log");
+
+    // Left over from a previous session, already past the cap
+    FILE* f = CoSyncFileSystem::OpenFile(path, "wb");
+    COSYNC_REQUIRE(f != nullptr);
+    const std::string old(1500, 'o');
+    fwrite(old.data(), 1, old.size(), f);
+    fclose(f);
+
+    CoSyncFileSink sink(path, config);
+    WriteLine(sink, CoSyncLog::Level::Info, "new session");
+    sink.Flush();
+
+    COSYNC_CHECK(sink.GetStats().rotations == 1);
+    COSYNC_CHECK(CoSyncFileSystem::FileSize(sink.RotatedPath(1)) == int64_t(old.size()));
+    COSYNC_CHECK(ReadAll(path).find("new session") != std::string::npos);
+
+    RemoveLogs(sink);
+}
+
+COSYNC_TEST(SingleFileRotationTruncates)
+{
+    CoSyncFileSink::Config config;
+    config.bufferBytes = 1024;
+    config.maxFileBytes = 1024;
+    config.maxFiles = 1;
+
+    CoSyncFileSink sink(TestPath("single.log"), config);
+    RemoveLogs(sink);
+
+    const std::string line(200, 's');
+    for (int i = 0; i < 20; ++i)
+    {
+        WriteLine(sink, CoSyncLog::Level::Info, line.c_str());
+        sink.Flush();
+    }
+
+    COSYNC_CHECK(sink.GetStats().rotations > 0);
+    COSYNC_CHECK(!CoSyncFileSystem::FileExists(sink.RotatedPath(1)));
+    COSYNC_CHECK(CoSyncFileSystem::FileSize(sink.GetPath()) <= int64_t(config.maxFileBytes));
+
+    RemoveLogs(sink);
+}
+
+COSYNC_TEST(UnwritablePathCountsErrors)
+{
+    CoSyncFileSink sink(CoSyncFileSystem::JoinPath("filesink_test_missing_dir", "nope.log"));
+
+    WriteLine(sink, CoSyncLog::Level::Error, "lost");
+    sink.Flush();
+
+    const CoSyncFileSink::Stats stats = sink.GetStats();
+    COSYNC_CHECK(stats.writeErrors >= 1);
+    COSYNC_CHECK(stats.bytesWritten == 0);
+}
+
+int main()
+{
+    return CoSyncTest::RunAll();
+}
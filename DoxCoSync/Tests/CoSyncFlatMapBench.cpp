@@ -0,0 +1,136 @@
+#include "CoSyncClock.h"
+#include "CoSyncFlatMap.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// CoSyncFlatMap vs std::unordered_map
+//
+// uint32_t entity-ID keys at table sizes seen in a session (a few players
+// up to a crowded NPC cell). Per operation:
+//   find hit   : lookup of a present key (the per-packet path)
+//   find miss  : lookup of an absent key
+//   churn      : erase one entity + insert a new one (despawn / spawn)
+//   iterate    : full walk, per element
+// Results go to stdout.
+//
+//   CoSyncFlatMapBench [rounds]
+// -----------------------------------------------------------------------------
+namespace
+{
+    constexpr size_t kSizes[] = { 16, 256, 4096 };
+    constexpr size_t kLookups = 1 << 16;
+    constexpr int    kDefaultRounds = 50;
+
+    volatile uint64_t s_sink = 0;
+
+    struct Result
+    {
+        double findHit = 0.0;
+        double findMiss = 0.0;
+        double churn = 0.0;
+        double iterate = 0.0;
+    };
+
+    template <class Map>
+    Result Measure(size_t size, int rounds, std::vector<uint32_t> keys,
+                   const std::vector<uint32_t>& hits, const std::vector<uint32_t>& misses)
+    {
+        Map m;
+        for (size_t i = 0; i < size; ++i)
+            m[keys[i]] = static_cast<uint32_t>(i);
+
+        Result r;
+        uint64_t acc = 0;
+
+        int64_t start = CoSyncClock::Ticks();
+        for (int it = 0; it < rounds; ++it)
+        {
+            for (uint32_t k : hits)
+            {
+                auto f = m.find(k);
+                acc += (f != m.end()) ? f->second : 0;
+            }
+        }
+        r.findHit = CoSyncClock::MicrosSince(start) * 1000.0 / (double(rounds) * hits.size());
+
+        start = CoSyncClock::Ticks();
+        for (int it = 0; it < rounds; ++it)
+        {
+            for (uint32_t k : misses)
+                acc += (m.find(k) != m.end()) ? 1 : 0;
+        }
+        r.findMiss = CoSyncClock::MicrosSince(start) * 1000.0 / (double(rounds) * misses.size());
+
+        // Oldest entity leaves, a new one arrives; live count stays at size
+        size_t oldest = 0;
+        uint32_t nextKey = keys[size];
+        start = CoSyncClock::Ticks();
+        for (int it = 0; it < rounds; ++it)
+        {
+            for (size_t n = 0; n < kLookups / 16; ++n)
+            {
+                m.erase(keys[oldest]);
+                m[nextKey] = static_cast<uint32_t>(n);
+                keys[oldest] = nextKey;
+                oldest = (oldest + 1) % size;
+                nextKey += 2 * 7919;   // stays odd: never one of the misses
+            }
+        }
+        r.churn = CoSyncClock::MicrosSince(start) * 1000.0 / (double(rounds) * (kLookups / 16));
+
+        start = CoSyncClock::Ticks();
+        for (int it = 0; it < rounds * 16; ++it)
+        {
+            for (const auto& kv : m)
+                acc += kv.second;
+        }
+        r.iterate = CoSyncClock::MicrosSince(start) * 1000.0 / (double(rounds) * 16 * m.size());
+
+        s_sink = acc;
+        return r;
+    }
+
+    void Print(const char* name, const Result& r)
+    {
+        std::printf("  %-20s %8.2f %9.2f %8.2f %8.2f\n", name, r.findHit, r.findMiss, r.churn, r.iterate);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int rounds = (argc > 1) ? std::max(1, std::atoi(argv[1])) : kDefaultRounds;
+
+    std::printf("CoSyncFlatMap vs std::unordered_map (ns/op, %d rounds)\n", rounds);
+
+    for (size_t size : kSizes)
+    {
+        std::mt19937 rng(static_cast<uint32_t>(size));
+
+        // Sparse IDs (entity IDs are not dense); odd keys present, even absent
+        std::vector<uint32_t> keys(size + 1);
+        for (uint32_t& k : keys)
+            k = (rng() | 1u);
+
+        std::vector<uint32_t> hits(kLookups);
+        std::vector<uint32_t> misses(kLookups);
+        for (size_t i = 0; i < kLookups; ++i)
+        {
+            hits[i] = keys[rng() % size];
+            misses[i] = rng() & ~1u;
+        }
+
+        std::printf("%zu entries\n", size);
+        std::printf("  %-20s %8s %9s %8s %8s\n", "", "find hit", "find miss", "churn", "iterate");
+
+        Print("CoSyncFlatMap", Measure<CoSyncFlatMap<uint32_t, uint32_t>>(size, rounds, keys, hits, misses));
+        Print("std::unordered_map", Measure<std::unordered_map<uint32_t, uint32_t>>(size, rounds, keys, hits, misses));
+    }
+
+    return 0;
+}
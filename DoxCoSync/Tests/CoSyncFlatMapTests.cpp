@@ -0,0 +1,300 @@
+#include "CoSyncTest.h"
+
+#include "CoSyncFlatMap.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// CoSyncFlatMap / CoSyncFlatSet: insert, erase, tombstone reuse, and a
+// randomized run against std::unordered_map
+// -----------------------------------------------------------------------------
+namespace
+{
+    // Counts live instances so leaks / double destroys show up
+    struct Tracked
+    {
+        static int s_live;
+
+        int value = 0;
+
+        Tracked() { ++s_live; }
+        explicit Tracked(int v) : value(v) { ++s_live; }
+        Tracked(const Tracked& o) : value(o.value) { ++s_live; }
+        Tracked(Tracked&& o) noexcept : value(o.value) { ++s_live; }
+        Tracked& operator=(const Tracked&) = default;
+        Tracked& operator=(Tracked&&) = default;
+        ~Tracked() { --s_live; }
+    };
+
+    int Tracked::s_live = 0;
+}
+
+// -----------------------------------------------------------------------------
+// Insert / find
+// -----------------------------------------------------------------------------
+COSYNC_TEST(InsertAndFind)
+{
+    CoSyncFlatMap<uint32_t, int> m;
+    COSYNC_CHECK(m.empty());
+    COSYNC_CHECK(m.find(1) == m.end());
+
+    for (uint32_t k = 1; k <= 1000; ++k)
+        m[k] = static_cast<int>(k * 3);
+
+    COSYNC_CHECK(m.size() == 1000);
+
+    for (uint32_t k = 1; k <= 1000; ++k)
+    {
+        auto it = m.find(k);
+        COSYNC_REQUIRE(it != m.end());
+        COSYNC_CHECK(it->second == static_cast<int>(k * 3));
+    }
+
+    COSYNC_CHECK(m.count(0) == 0);
+    COSYNC_CHECK(m.count(1001) == 0);
+}
+
+COSYNC_TEST(TryEmplaceDoesNotOverwrite)
+{
+    CoSyncFlatMap<uint64_t, std::string> m;
+
+    auto first = m.try_emplace(76561198000000001ull, "host");
+    COSYNC_CHECK(first.second);
+
+    auto second = m.try_emplace(76561198000000001ull, "other");
+    COSYNC_CHECK(!second.second);
+    COSYNC_CHECK(second.first->second == "host");
+
+    m[76561198000000001ull] = "renamed";
+    COSYNC_CHECK(m.find(76561198000000001ull)->second == "renamed");
+    COSYNC_CHECK(m.size() == 1);
+}
+
+COSYNC_TEST(PointerKeys)
+{
+    int actors[64];
+    CoSyncFlatMap<int*, size_t> m;
+
+    for (size_t i = 0; i < 64; ++i)
+        m[&actors[i]] = i;
+
+    for (size_t i = 0; i < 64; ++i)
+        COSYNC_CHECK(m.find(&actors[i])->second == i);
+}
+
+// -----------------------------------------------------------------------------
+// Erase
+// -----------------------------------------------------------------------------
+COSYNC_TEST(EraseRemovesOnlyThatKey)
+{
+    CoSyncFlatMap<uint32_t, int> m;
+    for (uint32_t k = 0; k < 100; ++k)
+        m[k] = static_cast<int>(k);
+
+    COSYNC_CHECK(m.erase(42) == 1);
+    COSYNC_CHECK(m.erase(42) == 0);
+    COSYNC_CHECK(m.find(42) == m.end());
+    COSYNC_CHECK(m.size() == 99);
+
+    for (uint32_t k = 0; k < 100; ++k)
+    {
+        if (k != 42)
+            COSYNC_CHECK(m.count(k) == 1);
+    }
+}
+
+COSYNC_TEST(EraseDoesNotMoveOtherEntries)
+{
+    CoSyncFlatMap<uint32_t, int> m;
+    for (uint32_t k = 0; k < 50; ++k)
+        m[k] = static_cast<int>(k);
+
+    int* kept = &m.find(7)->second;
+
+    for (uint32_t k = 10; k < 50; ++k)
+        m.erase(k);
+
+    COSYNC_CHECK(&m.find(7)->second == kept);
+    COSYNC_CHECK(*kept == 7);
+}
+
+COSYNC_TEST(EraseByIteratorWhileWalking)
+{
+    CoSyncFlatMap<uint32_t, int> m;
+    for (uint32_t k = 0; k < 200; ++k)
+        m[k] = static_cast<int>(k);
+
+    // Tombstones never shift slots, so erasing the current entry and
+    // advancing is safe
+    for (auto it = m.begin(); it != m.end(); ++it)
+    {
+        if (it->first % 2)
+            m.erase(it);
+    }
+
+    COSYNC_CHECK(m.size() == 100);
+    for (const auto& kv : m)
+        COSYNC_CHECK(kv.first % 2 == 0);
+}
+
+// -----------------------------------------------------------------------------
+// Tombstones
+// -----------------------------------------------------------------------------
+COSYNC_TEST(ChurnReusesTombstonesWithoutGrowing)
+{
+    // Entity IDs come and go; live count stays small
+    CoSyncFlatMap<uint32_t, int> m;
+    m.reserve(32);
+    const size_t cap = m.capacity();
+
+    uint32_t next = 1;
+    std::vector<uint32_t> live;
+
+    for (int round = 0; round < 10000; ++round)
+    {
+        if (live.size() == 32)
+        {
+            m.erase(live.front());
+            live.erase(live.begin());
+        }
+
+        m[next] = round;
+        live.push_back(next++);
+    }
+
+    COSYNC_CHECK(m.size() == 32);
+    COSYNC_CHECK(m.capacity() == cap);
+
+    for (uint32_t k : live)
+        COSYNC_CHECK(m.count(k) == 1);
+    COSYNC_CHECK(m.count(1) == 0);
+}
+
+COSYNC_TEST(ReinsertAfterEraseReusesSlot)
+{
+    CoSyncFlatMap<uint32_t, int> m;
+    for (uint32_t k = 0; k < 14; ++k)   // 7/8 of the first 16-slot group
+        m[k] = 0;
+
+    const size_t cap = m.capacity();
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        m.erase(3);
+        m[3] = i;
+    }
+
+    COSYNC_CHECK(m.capacity() == cap);
+    COSYNC_CHECK(m.find(3)->second == 999);
+}
+
+COSYNC_TEST(ClearDestroysValuesAndKeepsCapacity)
+{
+    {
+        CoSyncFlatMap<uint32_t, Tracked> m;
+        for (uint32_t k = 0; k < 100; ++k)
+            m.try_emplace(k, static_cast<int>(k));
+
+        for (uint32_t k = 0; k < 100; k += 3)
+            m.erase(k);
+
+        COSYNC_CHECK(Tracked::s_live == static_cast<int>(m.size()));
+
+        const size_t cap = m.capacity();
+        m.clear();
+        COSYNC_CHECK(Tracked::s_live == 0);
+        COSYNC_CHECK(m.empty());
+        COSYNC_CHECK(m.capacity() == cap);
+
+        m.try_emplace(5, 5);
+
+        // Copies and moves keep the count balanced
+        CoSyncFlatMap<uint32_t, Tracked> copy(m);
+        CoSyncFlatMap<uint32_t, Tracked> moved(std::move(copy));
+        COSYNC_CHECK(moved.find(5)->second.value == 5);
+        COSYNC_CHECK(Tracked::s_live == 2);
+    }
+
+    COSYNC_CHECK(Tracked::s_live == 0);
+}
+
+// -----------------------------------------------------------------------------
+// Differential
+// -----------------------------------------------------------------------------
+COSYNC_TEST(RandomOpsMatchUnorderedMap)
+{
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<uint32_t> key(0, 2047);
+    std::uniform_int_distribution<int> op(0, 9);
+
+    CoSyncFlatMap<uint32_t, uint32_t> flat;
+    std::unordered_map<uint32_t, uint32_t> ref;
+
+    for (int i = 0; i < 200000; ++i)
+    {
+        const uint32_t k = key(rng);
+        const int o = op(rng);
+
+        if (o < 5)
+        {
+            flat[k] = static_cast<uint32_t>(i);
+            ref[k] = static_cast<uint32_t>(i);
+        }
+        else if (o < 8)
+        {
+            COSYNC_REQUIRE(flat.erase(k) == ref.erase(k));
+        }
+        else
+        {
+            auto f = flat.find(k);
+            auto r = ref.find(k);
+            COSYNC_REQUIRE((f == flat.end()) == (r == ref.end()));
+            if (r != ref.end())
+                COSYNC_REQUIRE(f->second == r->second);
+        }
+    }
+
+    COSYNC_CHECK(flat.size() == ref.size());
+
+    size_t walked = 0;
+    for (const auto& kv : flat)
+    {
+        ++walked;
+        COSYNC_CHECK(ref.count(kv.first) == 1 && ref[kv.first] == kv.second);
+    }
+    COSYNC_CHECK(walked == ref.size());
+}
+
+// -----------------------------------------------------------------------------
+// Set
+// -----------------------------------------------------------------------------
+COSYNC_TEST(FlatSetInsertEraseIterate)
+{
+    CoSyncFlatSet<uint32_t> s;
+
+    COSYNC_CHECK(s.insert(10).second);
+    COSYNC_CHECK(!s.insert(10).second);
+    COSYNC_CHECK(s.insert(20).second);
+    COSYNC_CHECK(s.size() == 2);
+
+    COSYNC_CHECK(s.erase(10) == 1);
+    COSYNC_CHECK(s.count(10) == 0);
+    COSYNC_CHECK(s.count(20) == 1);
+
+    size_t n = 0;
+    for (uint32_t k : s)
+    {
+        COSYNC_CHECK(k == 20);
+        ++n;
+    }
+    COSYNC_CHECK(n == 1);
+}
+
+int main()
+{
+    return CoSyncTest::RunAll();
+}
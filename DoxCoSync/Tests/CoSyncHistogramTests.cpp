@@ -0,0 +1,161 @@
+#include "CoSyncTest.h"
+
+#include "CoSyncHistogram.h"
+#include "CoSyncMetrics.h"
+
+#include <cmath>
+#include <cstdlib>
+
+// -----------------------------------------------------------------------------
+// CoSyncHistogram bucket layout and percentiles; CoSyncMetrics window
+// percentiles over the same layout
+// -----------------------------------------------------------------------------
+namespace
+{
+    constexpr double kRelPrecision = 1.0 / double(CoSyncHistogram::kSubBuckets);
+
+    double RelError(double got, double want)
+    {
+        return std::fabs(got - want) / want;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Layout
+// -----------------------------------------------------------------------------
+COSYNC_TEST(SmallValuesGetOneMicrosecondBuckets)
+{
+    for (size_t v = 0; v < CoSyncHistogram::kSubBuckets; ++v)
+    {
+        COSYNC_CHECK(CoSyncHistogram::BucketIndex(double(v)) == v);
+        COSYNC_CHECK(CoSyncHistogram::BucketIndex(double(v) + 0.5) == v);
+    }
+
+    COSYNC_CHECK(CoSyncHistogram::BucketIndex(-3.0) == 0);
+    COSYNC_CHECK(CoSyncHistogram::BucketIndex(16.0) == 16);
+}
+
+COSYNC_TEST(EveryBucketRoundTripsThroughItsEdges)
+{
+    for (size_t i = 0; i < CoSyncHistogram::kBucketCount; ++i)
+    {
+        const double lower = CoSyncHistogram::BucketLowerMicros(i);
+        const double upper = CoSyncHistogram::BucketUpperMicros(i);
+
+        COSYNC_REQUIRE(upper > lower);
+        COSYNC_CHECK(CoSyncHistogram::BucketIndex(lower) == i);
+
+        // Contiguous: the next bucket starts where this one ends
+        if (i + 1 < CoSyncHistogram::kBucketCount)
+            COSYNC_CHECK(CoSyncHistogram::BucketIndex(upper) == i + 1);
+
+        // HDR: width never exceeds 1/16 of the lower edge above 16 us
+        if (lower >= double(CoSyncHistogram::kSubBuckets))
+            COSYNC_CHECK((upper - lower) / lower <= kRelPrecision);
+    }
+}
+
+COSYNC_TEST(OctaveHasSixteenLinearSubBuckets)
+{
+    // [1024, 2048) us in 64 us steps
+    const size_t first = CoSyncHistogram::BucketIndex(1024.0);
+    for (size_t s = 0; s < CoSyncHistogram::kSubBuckets; ++s)
+    {
+        COSYNC_CHECK(CoSyncHistogram::BucketIndex(1024.0 + 64.0 * s) == first + s);
+        COSYNC_CHECK(CoSyncHistogram::BucketIndex(1024.0 + 64.0 * s + 63.0) == first + s);
+    }
+
+    COSYNC_CHECK(CoSyncHistogram::BucketIndex(2048.0) == first + CoSyncHistogram::kSubBuckets);
+}
+
+COSYNC_TEST(HugeValuesClampToLastBucket)
+{
+    const size_t last = CoSyncHistogram::kBucketCount - 1;
+
+    COSYNC_CHECK(CoSyncHistogram::BucketIndex(4294967295.0) == last);
+    COSYNC_CHECK(CoSyncHistogram::BucketIndex(1e12) == last);
+    COSYNC_CHECK(CoSyncHistogram::BucketIndex(1e300) == last);
+}
+
+// -----------------------------------------------------------------------------
+// Percentiles
+// -----------------------------------------------------------------------------
+COSYNC_TEST(PercentilesWithinSubBucketPrecision)
+{
+    // Uniform 100 us .. 100 ms
+    CoSyncHistogram h;
+    const int n = 100000;
+    for (int i = 0; i < n; ++i)
+        h.Record(100.0 + (100000.0 - 100.0) * i / (n - 1));
+
+    const double ps[] = { 0.5, 0.9, 0.99, 0.999 };
+    for (double p : ps)
+    {
+        const double want = 100.0 + (100000.0 - 100.0) * p;
+        COSYNC_CHECK(RelError(h.Percentile(p), want) <= kRelPrecision);
+    }
+
+    COSYNC_CHECK(h.Percentile(0.0) == h.Min());
+    COSYNC_CHECK(h.Percentile(1.0) == h.Max());
+}
+
+COSYNC_TEST(PercentileSeparatesValuesInOneOctave)
+{
+    // 1100 vs 1900 us shared one log2 bucket before sub-buckets
+    CoSyncHistogram h;
+    for (int i = 0; i < 90; ++i) h.Record(1100.0);
+    for (int i = 0; i < 10; ++i) h.Record(1900.0);
+
+    COSYNC_CHECK(RelError(h.Percentile(0.5), 1100.0) <= kRelPrecision);
+    COSYNC_CHECK(RelError(h.Percentile(0.95), 1900.0) <= kRelPrecision);
+}
+
+COSYNC_TEST(PercentileClampsToObservedRange)
+{
+    CoSyncHistogram h;
+    h.Record(1000.0);
+
+    COSYNC_CHECK(h.Percentile(0.5) == 1000.0);
+    COSYNC_CHECK(h.Percentile(0.99) == 1000.0);
+
+    h.Reset();
+    COSYNC_CHECK(h.Count() == 0);
+    COSYNC_CHECK(h.Percentile(0.5) == 0.0);
+}
+
+// -----------------------------------------------------------------------------
+// CoSyncMetrics window percentiles
+// -----------------------------------------------------------------------------
+COSYNC_TEST(MetricsWindowPercentilesUseSubBuckets)
+{
+    CoSyncMetrics metrics;
+    metrics.SetDumpInterval(0.0);
+
+    CoSyncLatencyHistogram& h = metrics.Histogram("test.latency_us");
+    for (int i = 0; i < 900; ++i) h.Record(1100.0);
+    for (int i = 0; i < 90; ++i)  h.Record(1500.0);
+    for (int i = 0; i < 10; ++i)  h.Record(1900.0);
+
+    metrics.Snapshot(1.0);
+
+    CoSyncMetrics::Sample s;
+    COSYNC_REQUIRE(metrics.Query("test.latency_us", s));
+    COSYNC_CHECK(s.count == 1000);
+    COSYNC_CHECK(RelError(s.p50, 1100.0) <= kRelPrecision);
+    COSYNC_CHECK(RelError(s.p90, 1100.0) <= kRelPrecision);
+    COSYNC_CHECK(RelError(s.p99, 1500.0) <= kRelPrecision);
+    COSYNC_CHECK(s.max == 1900.0);
+
+    // Next window only sees its own samples
+    for (int i = 0; i < 10; ++i) h.Record(40.0);
+    metrics.Snapshot(2.0);
+
+    COSYNC_REQUIRE(metrics.Query("test.latency_us", s));
+    COSYNC_CHECK(s.count == 10);
+    COSYNC_CHECK(RelError(s.p99, 40.0) <= kRelPrecision);
+}
+
+int main()
+{
+    return CoSyncTest::RunAll();
+}
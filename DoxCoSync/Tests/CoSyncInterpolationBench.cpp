@@ -0,0 +1,95 @@
+#include "CoSyncClock.h"
+#include "CoSyncInterpolation.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// CoSyncInterpolation kernel cost
+//
+// Per-call cost of linear vs Hermite position and Euler vs shortest-arc
+// rotation over a batch of precomputed sample pairs (one proxy per frame
+// each). Results go to stdout.
+//
+//   CoSyncInterpolationBench [iterations]
+// -----------------------------------------------------------------------------
+namespace
+{
+    using namespace CoSyncInterpolation;
+
+    constexpr size_t kPairs = 1024;
+    constexpr int    kDefaultIterations = 2000;
+
+    struct Pair
+    {
+        NiPoint3 p0, v0, p1, v1, r0, r1;
+        float t;
+    };
+
+    float Rand(float lo, float hi)
+    {
+        return lo + (hi - lo) * (static_cast<float>(std::rand()) / RAND_MAX);
+    }
+
+    volatile float s_sink = 0.f;
+
+    template <class Fn>
+    void Run(const char* name, const std::vector<Pair>& pairs, int iterations, Fn fn)
+    {
+        float acc = 0.f;
+
+        const int64_t start = CoSyncClock::Ticks();
+        for (int it = 0; it < iterations; ++it)
+            for (const Pair& p : pairs)
+                acc += fn(p);
+        const double ns = CoSyncClock::MicrosSince(start) * 1000.0 / (double(iterations) * pairs.size());
+
+        s_sink = acc;
+        std::printf("%-28s %6.2f ns/call\n", name, ns);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int iterations = (argc > 1) ? std::max(1, std::atoi(argv[1])) : kDefaultIterations;
+
+    std::srand(7);
+
+    std::vector<Pair> pairs(kPairs);
+    for (Pair& p : pairs)
+    {
+        p.p0 = NiPoint3(Rand(-4e4f, 4e4f), Rand(-4e4f, 4e4f), Rand(0.f, 2e3f));
+        p.p1 = p.p0 + NiPoint3(Rand(-40.f, 40.f), Rand(-40.f, 40.f), Rand(-5.f, 5.f));
+        p.v0 = NiPoint3(Rand(-400.f, 400.f), Rand(-400.f, 400.f), 0.f);
+        p.v1 = NiPoint3(Rand(-400.f, 400.f), Rand(-400.f, 400.f), 0.f);
+        p.r0 = NiPoint3(0.f, 0.f, Rand(-3.14f, 3.14f));
+        p.r1 = NiPoint3(0.f, 0.f, Rand(-3.14f, 3.14f));
+        p.t = Rand(0.f, 1.f);
+    }
+
+    std::printf("CoSyncInterpolation kernels (%zu pairs x %d iterations)\n", kPairs, iterations);
+
+    Run("position Linear", pairs, iterations, [](const Pair& p)
+    {
+        return InterpolatePosition(p.p0, p.v0, p.p1, p.v1, p.t, 0.1f, PositionMode::Linear).x;
+    });
+
+    Run("position Hermite", pairs, iterations, [](const Pair& p)
+    {
+        return InterpolatePosition(p.p0, p.v0, p.p1, p.v1, p.t, 0.1f, PositionMode::Hermite).x;
+    });
+
+    Run("rotation Euler", pairs, iterations, [](const Pair& p)
+    {
+        return LerpRotation(p.r0, p.r1, p.t, RotationMode::Euler).z;
+    });
+
+    Run("rotation ShortestArc", pairs, iterations, [](const Pair& p)
+    {
+        return LerpRotation(p.r0, p.r1, p.t, RotationMode::ShortestArc).z;
+    });
+
+    return 0;
+}
@@ -0,0 +1,302 @@
+#include "CoSyncTest.h"
+
+#include "CoSyncClock.h"
+#include "CoSyncInterpolation.h"
+#include "CoSyncRingBuffer.h"
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+// -----------------------------------------------------------------------------
+// CoSyncInterpolation: error against a ground-truth path, rotation wrap,
+// per-type mode selection
+//
+// Playback runs on CoSyncClock's virtual clock: 60 fps render frames
+// against samples sent at a fixed rate, rendered one interval behind.
+// -----------------------------------------------------------------------------
+namespace
+{
+    using namespace CoSyncInterpolation;
+
+    constexpr double kPi = 3.14159265358979;
+    constexpr double kFrameSec = 1.0 / 60.0;
+
+    // Circle strafe: r = 300 units at 400 units/s
+    constexpr double kRadius = 300.0;
+    constexpr double kSpeed = 400.0;
+
+    struct Sample
+    {
+        NiPoint3 pos;
+        NiPoint3 vel;
+    };
+
+    Sample Truth(double t)
+    {
+        const double w = kSpeed / kRadius;
+        const double a = w * t;
+
+        Sample s;
+        s.pos = NiPoint3(float(kRadius * std::cos(a)), float(kRadius * std::sin(a)), 0.f);
+        s.vel = NiPoint3(float(-kSpeed * std::sin(a)), float(kSpeed * std::cos(a)), 0.f);
+        return s;
+    }
+
+    struct ErrorStats
+    {
+        double rms = 0.0;
+        double max = 0.0;
+    };
+
+    ErrorStats PlaybackError(double sendHz, PositionMode mode, double durationSec = 10.0)
+    {
+        const double interval = 1.0 / sendHz;
+        const double start = 100.0;
+
+        CoSyncClock::UseVirtualClock(start);
+
+        double sumSq = 0.0;
+        double maxErr = 0.0;
+        int frames = 0;
+
+        while (CoSyncClock::Now() < start + durationSec)
+        {
+            CoSyncClock::AdvanceVirtual(kFrameSec);
+
+            // Sender timeline starts at 0; render one interval behind it
+            const double renderTime = CoSyncClock::Now() - start - interval;
+            if (renderTime < 0.0)
+                continue;
+
+            const double k = std::floor(renderTime / interval);
+            const double t0 = k * interval;
+
+            const Sample a = Truth(t0);
+            const Sample b = Truth(t0 + interval);
+            const float t = float((renderTime - t0) / interval);
+
+            const NiPoint3 p = InterpolatePosition(a.pos, a.vel, b.pos, b.vel, t, float(interval), mode);
+            const NiPoint3 truth = Truth(renderTime).pos;
+
+            const double dx = p.x - truth.x, dy = p.y - truth.y, dz = p.z - truth.z;
+            const double err = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+            sumSq += err * err;
+            maxErr = (err > maxErr) ? err : maxErr;
+            ++frames;
+        }
+
+        CoSyncClock::UseRealClock();
+
+        ErrorStats s;
+        s.rms = frames ? std::sqrt(sumSq / frames) : 0.0;
+        s.max = maxErr;
+        return s;
+    }
+
+    bool Near(float a, float b, float eps = 1e-4f)
+    {
+        return std::fabs(a - b) <= eps;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Error vs ground truth
+// -----------------------------------------------------------------------------
+COSYNC_TEST(HermiteAt10HzMatchesLinearAt20Hz)
+{
+    const ErrorStats linear20 = PlaybackError(20.0, PositionMode::Linear);
+    const ErrorStats linear10 = PlaybackError(10.0, PositionMode::Linear);
+    const ErrorStats hermite10 = PlaybackError(10.0, PositionMode::Hermite);
+
+    std::printf("  circle strafe RMS / max error (units): linear@20Hz %.4f / %.4f, "
+        "linear@10Hz %.4f / %.4f, hermite@10Hz %.4f / %.4f\n",
+        linear20.rms, linear20.max, linear10.rms, linear10.max, hermite10.rms, hermite10.max);
+
+    // Halving the rate roughly quadruples linear chord error
+    COSYNC_CHECK(linear10.rms > linear20.rms * 3.0);
+
+    // The request's bar: 10 Hz Hermite at least as good as 20 Hz linear
+    COSYNC_CHECK(hermite10.rms <= linear20.rms);
+    COSYNC_CHECK(hermite10.max <= linear20.max);
+}
+
+COSYNC_TEST(StraightLineIsExactForBothModes)
+{
+    const NiPoint3 p0(0.f, 0.f, 0.f), p1(40.f, 0.f, 0.f);
+    const NiPoint3 v(400.f, 0.f, 0.f);
+
+    for (float t = 0.f; t <= 1.f; t += 0.125f)
+    {
+        const NiPoint3 lin = InterpolatePosition(p0, v, p1, v, t, 0.1f, PositionMode::Linear);
+        const NiPoint3 her = InterpolatePosition(p0, v, p1, v, t, 0.1f, PositionMode::Hermite);
+
+        COSYNC_CHECK(Near(lin.x, 40.f * t, 1e-3f));
+        COSYNC_CHECK(Near(her.x, 40.f * t, 1e-3f));
+    }
+}
+
+COSYNC_TEST(HermiteHitsEndpointsAndDegeneratesToLerp)
+{
+    const NiPoint3 p0(1.f, 2.f, 3.f), p1(7.f, -5.f, 9.f);
+    const NiPoint3 v0(100.f, 0.f, 0.f), v1(0.f, 50.f, 0.f);
+
+    const NiPoint3 a = HermitePosition(p0, v0, p1, v1, 0.f, 0.1f);
+    const NiPoint3 b = HermitePosition(p0, v0, p1, v1, 1.f, 0.1f);
+    COSYNC_CHECK(Near(a.x, p0.x) && Near(a.y, p0.y) && Near(a.z, p0.z));
+    COSYNC_CHECK(Near(b.x, p1.x) && Near(b.y, p1.y) && Near(b.z, p1.z));
+
+    // Zero span: velocities are meaningless, plain lerp
+    const NiPoint3 mid = HermitePosition(p0, v0, p1, v1, 0.5f, 0.f);
+    const NiPoint3 lerp = LerpPosition(p0, p1, 0.5f);
+    COSYNC_CHECK(Near(mid.x, lerp.x) && Near(mid.y, lerp.y) && Near(mid.z, lerp.z));
+}
+
+// -----------------------------------------------------------------------------
+// Rotation
+// -----------------------------------------------------------------------------
+COSYNC_TEST(ShortestArcCrossesPi)
+{
+    const float a = float(kPi) - 0.1f;
+    const float b = -float(kPi) + 0.1f;
+
+    // 0.2 rad apart the short way; halfway is +-PI, not 0
+    const float mid = LerpAngle(a, b, 0.5f);
+    COSYNC_CHECK(Near(std::fabs(mid), float(kPi), 1e-3f));
+
+    const NiPoint3 ra(0.f, 0.f, a), rb(0.f, 0.f, b);
+    const NiPoint3 euler = LerpRotation(ra, rb, 0.5f, RotationMode::Euler);
+    const NiPoint3 arc = LerpRotation(ra, rb, 0.5f, RotationMode::ShortestArc);
+
+    COSYNC_CHECK(Near(euler.z, 0.f, 1e-3f));
+    COSYNC_CHECK(Near(std::fabs(arc.z), float(kPi), 1e-3f));
+}
+
+COSYNC_TEST(ShortestArcMatchesEulerForSmallDeltas)
+{
+    const NiPoint3 ra(0.1f, -0.2f, 1.0f), rb(0.3f, 0.1f, 1.5f);
+
+    for (float t = 0.f; t <= 1.f; t += 0.25f)
+    {
+        const NiPoint3 e = LerpRotation(ra, rb, t, RotationMode::Euler);
+        const NiPoint3 s = LerpRotation(ra, rb, t, RotationMode::ShortestArc);
+        COSYNC_CHECK(Near(e.x, s.x) && Near(e.y, s.y) && Near(e.z, s.z));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Per-type modes
+// -----------------------------------------------------------------------------
+COSYNC_TEST(ModesAreSelectablePerType)
+{
+    const Modes playerBefore = GetModes(CoSyncEntityType::Player);
+    const Modes npcBefore = GetModes(CoSyncEntityType::NPC);
+
+    COSYNC_CHECK(playerBefore.position == PositionMode::Hermite);
+    COSYNC_CHECK(playerBefore.rotation == RotationMode::ShortestArc);
+
+    Modes legacy;
+    legacy.position = PositionMode::Linear;
+    legacy.rotation = RotationMode::Euler;
+    SetModes(CoSyncEntityType::NPC, legacy);
+
+    COSYNC_CHECK(GetModes(CoSyncEntityType::NPC).position == PositionMode::Linear);
+    COSYNC_CHECK(GetModes(CoSyncEntityType::NPC).rotation == RotationMode::Euler);
+    COSYNC_CHECK(GetModes(CoSyncEntityType::Player).position == PositionMode::Hermite);
+
+    SetModes(CoSyncEntityType::Player, playerBefore);
+    SetModes(CoSyncEntityType::NPC, npcBefore);
+}
+
+COSYNC_TEST(LoadConfigReadsModesFromIni)
+{
+    const char* path = "interp_test.ini";
+
+    FILE* f = std::fopen(path, "w");
+    COSYNC_REQUIRE(f != nullptr);
+    std::fputs("; per-type interpolation\n"
+        "InterpPosition_Player = linear\n"
+        "InterpRotation_NPC = Euler\n"
+        "InterpPosition_NPC = bogus\n", f);
+    std::fclose(f);
+
+    const Modes playerBefore = GetModes(CoSyncEntityType::Player);
+    const Modes npcBefore = GetModes(CoSyncEntityType::NPC);
+
+    COSYNC_CHECK(LoadConfig(path));
+
+    COSYNC_CHECK(GetModes(CoSyncEntityType::Player).position == PositionMode::Linear);
+    COSYNC_CHECK(GetModes(CoSyncEntityType::Player).rotation == playerBefore.rotation);
+    COSYNC_CHECK(GetModes(CoSyncEntityType::NPC).rotation == RotationMode::Euler);
+
+    // Unknown values leave the current mode
+    COSYNC_CHECK(GetModes(CoSyncEntityType::NPC).position == npcBefore.position);
+
+    COSYNC_CHECK(!LoadConfig("interp_test_missing.ini"));
+
+    SetModes(CoSyncEntityType::Player, playerBefore);
+    SetModes(CoSyncEntityType::NPC, npcBefore);
+    std::remove(path);
+}
+
+// -----------------------------------------------------------------------------
+// History capacity
+// -----------------------------------------------------------------------------
+COSYNC_TEST(HistoryCapacityIsConfigurablePerType)
+{
+    const size_t playerBefore = GetHistoryCapacity(CoSyncEntityType::Player);
+    const size_t npcBefore = GetHistoryCapacity(CoSyncEntityType::NPC);
+
+    COSYNC_CHECK(playerBefore == 8);
+
+    SetHistoryCapacity(CoSyncEntityType::Player, 32);
+    SetHistoryCapacity(CoSyncEntityType::NPC, 0);
+
+    COSYNC_CHECK(GetHistoryCapacity(CoSyncEntityType::Player) == 32);
+    COSYNC_CHECK(GetHistoryCapacity(CoSyncEntityType::NPC) == 2);   // floor
+
+    // Applied to the inline ring: rounded up to a power of two, capped
+    struct Stamp { double hostTime; };
+    CoSyncRingBuffer<Stamp, 32> ring;
+
+    ring.SetCapacity(GetHistoryCapacity(CoSyncEntityType::Player));
+    COSYNC_CHECK(ring.Capacity() == 32);
+
+    ring.SetCapacity(20);
+    COSYNC_CHECK(ring.Capacity() == 32);
+
+    ring.SetCapacity(100);
+    COSYNC_CHECK(ring.Capacity() == 32);
+
+    ring.SetCapacity(5);
+    COSYNC_CHECK(ring.Capacity() == 8);
+
+    SetHistoryCapacity(CoSyncEntityType::Player, playerBefore);
+    SetHistoryCapacity(CoSyncEntityType::NPC, npcBefore);
+}
+
+COSYNC_TEST(LoadConfigReadsHistoryCapacity)
+{
+    const char* path = "interp_history_test.ini";
+
+    FILE* f = std::fopen(path, "w");
+    COSYNC_REQUIRE(f != nullptr);
+    std::fputs("InterpHistory_Player = 16\n"
+        "InterpHistory_NPC = nope\n", f);
+    std::fclose(f);
+
+    const size_t npcBefore = GetHistoryCapacity(CoSyncEntityType::NPC);
+
+    COSYNC_CHECK(LoadConfig(path));
+    COSYNC_CHECK(GetHistoryCapacity(CoSyncEntityType::Player) == 16);
+    COSYNC_CHECK(GetHistoryCapacity(CoSyncEntityType::NPC) == npcBefore);
+
+    SetHistoryCapacity(CoSyncEntityType::Player, 8);
+    std::remove(path);
+}
+
+int main()
+{
+    return CoSyncTest::RunAll();
+}
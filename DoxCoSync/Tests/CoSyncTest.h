@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdio>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// CoSyncTest
+//
+// Minimal host-side test harness (no dependencies). Each test executable
+// defines cases with COSYNC_TEST and returns CoSyncTest::RunAll() from main.
+//
+//   COSYNC_CHECK(expr)  - records a failure and continues
+//   COSYNC_REQUIRE(expr) - records a failure and leaves the current case
+// -----------------------------------------------------------------------------
+namespace CoSyncTest
+{
+    using CaseFn = void (*)();
+
+    struct Case
+    {
+        const char* name;
+        CaseFn fn;
+    };
+
+    inline std::vector<Case>& Cases()
+    {
+        static std::vector<Case> s_cases;
+        return s_cases;
+    }
+
+    inline int& Failures()
+    {
+        static int s_failures = 0;
+        return s_failures;
+    }
+
+    struct Registrar
+    {
+        Registrar(const char* name, CaseFn fn) { Cases().push_back(Case{ name, fn }); }
+    };
+
+    inline void Fail(const char* file, int line, const char* expr)
+    {
+        std::fprintf(stderr, "  FAILED %s:%d: %s\n", file, line, expr);
+        ++Failures();
+    }
+
+    inline int RunAll()
+    {
+        int failedCases = 0;
+
+        for (const Case& c : Cases())
+        {
+            const int before = Failures();
+            c.fn();
+
+            const bool ok = (Failures() == before);
+            if (!ok)
+                ++failedCases;
+
+            std::printf("[%s] %s\n", ok ? " OK " : "FAIL", c.name);
+        }
+
+        std::printf("%d/%d cases passed\n",
+            int(Cases().size()) - failedCases, int(Cases().size()));
+
+        return failedCases ? 1 : 0;
+    }
+}
+
+#define COSYNC_TEST(name) \
+    static void name(); \
+    static const CoSyncTest::Registrar s_cosyncTest_##name(#name, &name); \
+    static void name()
+
+#define COSYNC_CHECK(expr) \
+    do { if (!(expr)) CoSyncTest::Fail(__FILE__, __LINE__, #expr); } while (0)
+
+#define COSYNC_REQUIRE(expr) \
+    do { if (!(expr)) { CoSyncTest::Fail(__FILE__, __LINE__, #expr); return; } } while (0)
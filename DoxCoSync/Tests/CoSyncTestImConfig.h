@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+// -----------------------------------------------------------------------------
+// ImGui user config for the headless tests (IMGUI_USER_CONFIG)
+//
+// IM_ASSERT stays active in every build type and names the failed check
+// before aborting, so an ImGui API misuse fails the ctest run.
+// -----------------------------------------------------------------------------
+#define IM_ASSERT(_EXPR) \
+    do { \
+        if (!(_EXPR)) \
+        { \
+            std::fprintf(stderr, "  IM_ASSERT FAILED %s:%d: %s\n", __FILE__, __LINE__, #_EXPR); \
+            std::abort(); \
+        } \
+    } while (0)
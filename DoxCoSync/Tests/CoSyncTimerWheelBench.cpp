@@ -0,0 +1,221 @@
+#include "CoSyncClock.h"
+#include "CoSyncTimerWheel.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Entity timeouts: CoSyncTimerWheel vs the old per-frame linear scan
+//
+// 1000 remote entities updating at 20 Hz, game at 60 fps, 15 s timeout.
+// Every 2 s another 5% of entities go silent and must time out.
+//   linear scan : every frame, walk all entities and compare lastUpdate
+//                 (what HandleTimeouts did before the wheel)
+//   timer wheel : one timer per entity; on fire, despawn if idle past the
+//                 timeout, otherwise re-arm for the remainder
+//                 (CoSyncPlayerManager::OnEntityTimeout)
+// Both paths see the same updates and must despawn the same entities.
+// Simulated time runs on the virtual clock; cost is measured with Ticks().
+//
+//   CoSyncTimerWheelBench [seconds]
+// -----------------------------------------------------------------------------
+namespace
+{
+    constexpr size_t kEntities = 1000;
+    constexpr double kFrameSec = 1.0 / 60.0;
+    constexpr double kUpdateSec = 1.0 / 20.0;
+    constexpr double kTimeoutSec = 15.0;
+    constexpr double kSilenceEverySec = 2.0;
+    constexpr size_t kSilencePerWave = kEntities / 20;
+    constexpr int    kDefaultSeconds = 120;
+
+    struct Entity
+    {
+        double lastUpdate = 0.0;
+        double nextUpdate = 0.0;
+        double silentFrom = 1e300;
+        bool   live = true;
+
+        CoSyncTimerHandle timer{};
+    };
+
+    struct Sim
+    {
+        std::vector<Entity> entities;
+        size_t despawned = 0;
+        CoSyncTimerWheel wheel;
+
+        explicit Sim(double start)
+        {
+            entities.resize(kEntities);
+
+            // Staggered update phases, silence waves in a fixed order
+            std::mt19937 rng(31);
+            std::vector<size_t> order(kEntities);
+            for (size_t i = 0; i < kEntities; ++i)
+            {
+                order[i] = i;
+                entities[i].lastUpdate = start;
+                entities[i].nextUpdate = start + kUpdateSec * (rng() % 1000) / 1000.0;
+            }
+            std::shuffle(order.begin(), order.end(), rng);
+
+            for (size_t i = 0; i < kEntities; ++i)
+                entities[order[i]].silentFrom = start + kSilenceEverySec * double(1 + i / kSilencePerWave);
+        }
+
+        // Packet receive path: identical for both strategies
+        void ApplyUpdates(double now)
+        {
+            for (Entity& e : entities)
+            {
+                if (!e.live || now < e.nextUpdate || now >= e.silentFrom)
+                    continue;
+
+                e.lastUpdate = now;
+                e.nextUpdate += kUpdateSec;
+            }
+        }
+
+        void Despawn(Entity& e)
+        {
+            e.live = false;
+            ++despawned;
+        }
+    };
+
+    // -------------------------------------------------------------------------
+    // Old: linear scan
+    // -------------------------------------------------------------------------
+    void ScanTimeouts(Sim& sim, double now)
+    {
+        for (Entity& e : sim.entities)
+        {
+            if (e.live && now - e.lastUpdate > kTimeoutSec)
+                sim.Despawn(e);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // New: timer wheel
+    // -------------------------------------------------------------------------
+    void OnTimeout(void* ctx, uint64_t index, double now);
+
+    void Arm(Sim& sim, size_t index, double delaySec)
+    {
+        sim.entities[index].timer = sim.wheel.ScheduleIn(delaySec, &OnTimeout, &sim, index);
+    }
+
+    void OnTimeout(void* ctx, uint64_t index, double now)
+    {
+        Sim& sim = *static_cast<Sim*>(ctx);
+        Entity& e = sim.entities[static_cast<size_t>(index)];
+
+        const double idle = now - e.lastUpdate;
+        if (idle > kTimeoutSec)
+        {
+            sim.Despawn(e);
+            return;
+        }
+
+        // One tick past the remainder so the next fire is strictly over
+        Arm(sim, static_cast<size_t>(index), kTimeoutSec - idle + CoSyncTimerWheel::kTickSeconds);
+    }
+
+    // -------------------------------------------------------------------------
+    // Driver
+    // -------------------------------------------------------------------------
+    struct Result
+    {
+        double timeoutMicros = 0.0;   // timeout handling only, per frame
+        size_t despawned = 0;
+        double lastDespawnAt = 0.0;
+    };
+
+    template <class Strategy>
+    Result Run(int seconds, Strategy timeouts)
+    {
+        const double start = 1.0;
+        CoSyncClock::UseVirtualClock(start);
+
+        Sim sim(start);
+        timeouts.Begin(sim);
+
+        const size_t frames = static_cast<size_t>(seconds / kFrameSec);
+        int64_t spent = 0;
+        Result r;
+
+        for (size_t f = 0; f < frames; ++f)
+        {
+            CoSyncClock::AdvanceVirtual(kFrameSec);
+            const double now = CoSyncClock::BeginFrame();
+
+            sim.ApplyUpdates(now);
+
+            const size_t before = sim.despawned;
+            const int64_t t0 = CoSyncClock::Ticks();
+            timeouts.Tick(sim, now);
+            spent += CoSyncClock::Ticks() - t0;
+
+            if (sim.despawned != before)
+                r.lastDespawnAt = now - start;
+        }
+
+        CoSyncClock::UseRealClock();
+
+        r.timeoutMicros = CoSyncClock::TicksToMicros(spent) / double(frames);
+        r.despawned = sim.despawned;
+        return r;
+    }
+
+    struct LinearScan
+    {
+        void Begin(Sim&) {}
+        void Tick(Sim& sim, double now) { ScanTimeouts(sim, now); }
+    };
+
+    struct Wheel
+    {
+        void Begin(Sim& sim)
+        {
+            sim.wheel.Advance(CoSyncClock::Now());
+            for (size_t i = 0; i < kEntities; ++i)
+                Arm(sim, i, kTimeoutSec);
+        }
+
+        void Tick(Sim& sim, double now) { sim.wheel.Advance(now); }
+    };
+
+    void Print(const char* name, const Result& r)
+    {
+        std::printf("  %-12s %10.3f %10zu %12.2f\n", name, r.timeoutMicros, r.despawned, r.lastDespawnAt);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int seconds = (argc > 1) ? std::max(1, std::atoi(argv[1])) : kDefaultSeconds;
+
+    std::printf("Entity timeouts, %zu entities @ 20 Hz, 60 fps, %d s simulated\n", kEntities, seconds);
+    std::printf("  %-12s %10s %10s %12s\n", "", "us/frame", "despawned", "last at (s)");
+
+    const Result scan = Run(seconds, LinearScan{});
+    const Result wheel = Run(seconds, Wheel{});
+
+    Print("linear scan", scan);
+    Print("timer wheel", wheel);
+
+    // Same entities, at most a frame + a tick apart
+    if (scan.despawned != wheel.despawned ||
+        wheel.lastDespawnAt - scan.lastDespawnAt > kFrameSec + 2.0 * CoSyncTimerWheel::kTickSeconds ||
+        wheel.lastDespawnAt < scan.lastDespawnAt)
+    {
+        std::printf("MISMATCH: timer wheel and linear scan disagree\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,287 @@
+#include "CoSyncTest.h"
+
+#include "CoSyncClock.h"
+#include "CoSyncTimerWheel.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// CoSyncTimerWheel: fire order, cascades from every level, repeating timers,
+// cancellation
+//
+// Time comes from CoSyncClock's virtual clock; each "frame" advances it and
+// feeds Now() to the wheel, the same way the game thread drives
+// g_CoSyncTimers.
+// -----------------------------------------------------------------------------
+namespace
+{
+    constexpr double kStart = 1.0;
+    constexpr double kTick = CoSyncTimerWheel::kTickSeconds;
+
+    struct Fired
+    {
+        uint64_t id;
+        double   at;
+    };
+
+    struct Recorder
+    {
+        std::vector<Fired> fired;
+
+        static void OnFire(void* ctx, uint64_t id, double now)
+        {
+            static_cast<Recorder*>(ctx)->fired.push_back(Fired{ id, now });
+        }
+    };
+
+    // Fresh wheel anchored at the current virtual time
+    struct Fixture
+    {
+        Fixture()
+        {
+            CoSyncClock::UseVirtualClock(kStart);
+            wheel.Advance(CoSyncClock::Now());
+        }
+
+        ~Fixture() { CoSyncClock::UseRealClock(); }
+
+        size_t Step(double sec)
+        {
+            CoSyncClock::AdvanceVirtual(sec);
+            return wheel.Advance(CoSyncClock::Now());
+        }
+
+        // Frames of `frameSec` until `sec` has passed
+        void Run(double sec, double frameSec)
+        {
+            const double end = CoSyncClock::Now() + sec;
+            while (CoSyncClock::Now() + 1e-9 < end)
+                Step(std::min(frameSec, end - CoSyncClock::Now()));
+        }
+
+        CoSyncTimerWheel wheel;
+        Recorder rec;
+    };
+}
+
+// -----------------------------------------------------------------------------
+// Fire order
+// -----------------------------------------------------------------------------
+COSYNC_TEST(FiresInDeadlineOrderAcrossLevels)
+{
+    Fixture f;
+
+    // Deadlines spread over all four levels, each on its own tick
+    std::mt19937 rng(31);
+    std::vector<double> delays;
+    for (int i = 0; i < 500; ++i)
+    {
+        const double span = (i % 4 == 0) ? 0.6 : (i % 4 == 1) ? 40.0 : (i % 4 == 2) ? 2500.0 : 9000.0;
+        const uint32_t ticks = 1 + rng() % static_cast<uint32_t>(span / kTick);
+        delays.push_back(ticks * kTick);
+    }
+
+    std::sort(delays.begin(), delays.end());
+    delays.erase(std::unique(delays.begin(), delays.end()), delays.end());
+
+    // Scheduled in shuffled order
+    std::vector<size_t> order(delays.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::shuffle(order.begin(), order.end(), rng);
+
+    for (size_t i : order)
+        f.wheel.ScheduleIn(delays[i], &Recorder::OnFire, &f.rec, i);
+
+    COSYNC_CHECK(f.wheel.ActiveCount() == delays.size());
+
+    // 60 fps, but skip ahead quickly through long idle stretches
+    while (f.wheel.ActiveCount() > 0 && CoSyncClock::Now() < kStart + 10000.0)
+        f.Step(f.rec.fired.size() % 2 ? 1.0 / 60.0 : 0.25);
+
+    COSYNC_REQUIRE(f.rec.fired.size() == delays.size());
+
+    for (size_t i = 0; i < f.rec.fired.size(); ++i)
+    {
+        const Fired& e = f.rec.fired[i];
+        COSYNC_CHECK(e.id == i);   // ids are ranks in deadline order
+
+        // Never early; late by at most the frame that crossed it
+        const double due = kStart + delays[e.id];
+        COSYNC_CHECK(e.at + 1e-6 >= due);
+        COSYNC_CHECK(e.at - due <= 0.25 + kTick);
+    }
+}
+
+COSYNC_TEST(OneLargeAdvanceFiresEverythingInOrder)
+{
+    Fixture f;
+
+    f.wheel.ScheduleIn(300.0, &Recorder::OnFire, &f.rec, 3);
+    f.wheel.ScheduleIn(0.05, &Recorder::OnFire, &f.rec, 0);
+    f.wheel.ScheduleIn(2.0, &Recorder::OnFire, &f.rec, 1);
+    f.wheel.ScheduleIn(45.0, &Recorder::OnFire, &f.rec, 2);
+
+    // A long hitch (loading screen): one call catches up
+    COSYNC_CHECK(f.Step(600.0) == 4);
+
+    COSYNC_REQUIRE(f.rec.fired.size() == 4);
+    for (uint64_t i = 0; i < 4; ++i)
+        COSYNC_CHECK(f.rec.fired[i].id == i);
+}
+
+COSYNC_TEST(SameTickTimersAllFire)
+{
+    Fixture f;
+
+    for (uint64_t i = 0; i < 100; ++i)
+        f.wheel.ScheduleIn(1.0, &Recorder::OnFire, &f.rec, i);
+
+    f.Run(0.99, 1.0 / 60.0);
+    COSYNC_CHECK(f.rec.fired.empty());
+
+    f.Run(0.02, 1.0 / 60.0);
+    COSYNC_CHECK(f.rec.fired.size() == 100);
+}
+
+// -----------------------------------------------------------------------------
+// Cascade
+// -----------------------------------------------------------------------------
+COSYNC_TEST(CascadedTimersFireOnTheirTick)
+{
+    // One timer per level, landing mid-slot so it has to be cascaded down
+    // (64 ticks = level 1, 4096 = level 2, 262144 = level 3)
+    const double delays[] = { 0.37, 12.34, 1234.56, 5432.1 };
+
+    for (double delay : delays)
+    {
+        Fixture f;
+        f.wheel.ScheduleIn(delay, &Recorder::OnFire, &f.rec, 1);
+
+        // Jump to just before the deadline, then walk tick by tick
+        f.Step(delay - 0.05);
+        COSYNC_CHECK(f.rec.fired.empty());
+
+        while (f.rec.fired.empty() && CoSyncClock::Now() < kStart + delay + 1.0)
+            f.Step(kTick);
+
+        COSYNC_REQUIRE(f.rec.fired.size() == 1);
+        COSYNC_CHECK(f.rec.fired[0].at + 1e-6 >= kStart + delay);
+        COSYNC_CHECK(f.rec.fired[0].at - (kStart + delay) < 2.0 * kTick);
+    }
+}
+
+COSYNC_TEST(TimersScheduledMidSlotCascadeCorrectly)
+{
+    Fixture f;
+
+    // Wheel already advanced past a level-1 boundary, new timers straddle
+    // the next one
+    f.Run(0.70, 1.0 / 60.0);
+
+    for (uint64_t i = 0; i < 64; ++i)
+        f.wheel.ScheduleIn(0.55 + 0.01 * i, &Recorder::OnFire, &f.rec, i);
+
+    f.Run(2.0, 1.0 / 60.0);
+
+    COSYNC_REQUIRE(f.rec.fired.size() == 64);
+    for (uint64_t i = 0; i < 64; ++i)
+        COSYNC_CHECK(f.rec.fired[i].id == i);
+}
+
+// -----------------------------------------------------------------------------
+// Repeating / cancel
+// -----------------------------------------------------------------------------
+COSYNC_TEST(RepeatingTimerDoesNotDrift)
+{
+    Fixture f;
+
+    f.wheel.ScheduleIn(0.05, &Recorder::OnFire, &f.rec, 7, 0.05);
+
+    // Uneven frame times; 20 Hz stays 20 Hz
+    std::mt19937 rng(5);
+    const double end = CoSyncClock::Now() + 10.0;
+    while (CoSyncClock::Now() < end)
+        f.Step(0.008 + 0.001 * (rng() % 20));
+
+    COSYNC_CHECK(f.rec.fired.size() >= 199 && f.rec.fired.size() <= 201);
+}
+
+COSYNC_TEST(RepeatingTimerSkipsPeriodsMissedInAStall)
+{
+    Fixture f;
+
+    f.wheel.ScheduleIn(0.1, &Recorder::OnFire, &f.rec, 1, 0.1);
+    f.Run(0.35, 0.01);
+    const size_t before = f.rec.fired.size();
+
+    // 5 s stall: fires once to catch up, not 50 times
+    f.Step(5.0);
+    COSYNC_CHECK(f.rec.fired.size() == before + 1);
+
+    f.Run(0.3, 0.01);
+    COSYNC_CHECK(f.rec.fired.size() == before + 4);
+}
+
+namespace
+{
+    struct CancelCtx
+    {
+        CoSyncTimerWheel* wheel = nullptr;
+        CoSyncTimerHandle victim{};
+        CoSyncTimerHandle self{};
+        int fires = 0;
+    };
+
+    void CancelOtherAndSelf(void* ctx, uint64_t, double)
+    {
+        CancelCtx* c = static_cast<CancelCtx*>(ctx);
+        ++c->fires;
+        c->wheel->Cancel(c->victim);
+        c->wheel->Cancel(c->self);
+    }
+}
+
+COSYNC_TEST(CancelledAndStaleHandlesAreInert)
+{
+    Fixture f;
+
+    const CoSyncTimerHandle h = f.wheel.ScheduleIn(1.0, &Recorder::OnFire, &f.rec, 1);
+    COSYNC_CHECK(f.wheel.IsPending(h));
+    COSYNC_CHECK(f.wheel.Cancel(h));
+    COSYNC_CHECK(!f.wheel.IsPending(h));
+    COSYNC_CHECK(!f.wheel.Cancel(h));
+
+    // The freed node is reused; the old handle must not reach it
+    const CoSyncTimerHandle reused = f.wheel.ScheduleIn(1.0, &Recorder::OnFire, &f.rec, 2);
+    COSYNC_CHECK(reused.index == h.index);
+    COSYNC_CHECK(!f.wheel.Cancel(h));
+    COSYNC_CHECK(f.wheel.IsPending(reused));
+
+    f.Run(1.5, 1.0 / 60.0);
+    COSYNC_REQUIRE(f.rec.fired.size() == 1);
+    COSYNC_CHECK(f.rec.fired[0].id == 2);
+}
+
+COSYNC_TEST(CallbackMayCancelOthersAndItself)
+{
+    Fixture f;
+
+    CancelCtx c;
+    c.wheel = &f.wheel;
+    c.self = f.wheel.ScheduleIn(0.5, &CancelOtherAndSelf, &c, 0, 0.5);
+    c.victim = f.wheel.ScheduleIn(0.8, &Recorder::OnFire, &f.rec, 9);
+
+    f.Run(3.0, 1.0 / 60.0);
+
+    COSYNC_CHECK(c.fires == 1);
+    COSYNC_CHECK(f.rec.fired.empty());
+    COSYNC_CHECK(f.wheel.ActiveCount() == 0);
+}
+
+int main()
+{
+    return CoSyncTest::RunAll();
+}
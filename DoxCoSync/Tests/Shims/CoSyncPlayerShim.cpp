@@ -0,0 +1,12 @@
+#include "CoSyncPlayer.h"
+
+// -----------------------------------------------------------------------------
+// The one CoSyncPlayer member CoSyncEntityTable needs (tests only)
+//
+// CoSyncPlayer.cpp spawns and moves actors through the engine; the table
+// only constructs and moves rows.
+// -----------------------------------------------------------------------------
+CoSyncPlayer::CoSyncPlayer(const std::string& name)
+    : username(name)
+{
+}
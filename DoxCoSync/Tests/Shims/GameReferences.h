@@ -0,0 +1,11 @@
+#pragma once
+
+// -----------------------------------------------------------------------------
+// Host-side stand-in for F4SE's GameReferences.h (tests only)
+//
+// Headers under test only hold these as pointers; nothing is dereferenced.
+// -----------------------------------------------------------------------------
+class TESForm;
+class TESNPC;
+class TESObjectREFR;
+class Actor;
@@ -0,0 +1,32 @@
+#pragma once
+
+// -----------------------------------------------------------------------------
+// Host-side stand-in for F4SE's NiTypes.h (tests only)
+//
+// Same NiPoint3 layout and operators as the engine type; the real header
+// pulls in the F4SE runtime, which the tests don't link.
+// -----------------------------------------------------------------------------
+class NiPoint3
+{
+public:
+    float x;
+    float y;
+    float z;
+
+    NiPoint3() : x(0.f), y(0.f), z(0.f) {}
+    NiPoint3(float X, float Y, float Z) : x(X), y(Y), z(Z) {}
+
+    NiPoint3 operator- () const { return NiPoint3(-x, -y, -z); }
+
+    NiPoint3 operator+ (const NiPoint3& pt) const { return NiPoint3(x + pt.x, y + pt.y, z + pt.z); }
+    NiPoint3 operator- (const NiPoint3& pt) const { return NiPoint3(x - pt.x, y - pt.y, z - pt.z); }
+
+    NiPoint3& operator+= (const NiPoint3& pt) { x += pt.x; y += pt.y; z += pt.z; return *this; }
+    NiPoint3& operator-= (const NiPoint3& pt) { x -= pt.x; y -= pt.y; z -= pt.z; return *this; }
+
+    NiPoint3 operator* (float s) const { return NiPoint3(x * s, y * s, z * s); }
+    NiPoint3 operator/ (float s) const { return NiPoint3(x / s, y / s, z / s); }
+
+    NiPoint3& operator*= (float s) { x *= s; y *= s; z *= s; return *this; }
+    NiPoint3& operator/= (float s) { x /= s; y /= s; z /= s; return *this; }
+};
@@ -9,7 +9,8 @@
 #include "LocalPlayerStateGlobals.h"
 #include "LocalPlayerState.h"
 
-#include "CoSyncNet.h"
+#include "CoSyncTrace.h"
+#include "CoSyncClock.h"
 
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
@@ -26,31 +27,14 @@ static ActorUpdateFn g_ActorUpdate_Original = nullptr;
 // -----------------------------------------------------------------------------
 static bool   g_hasPrevPos = false;
 static double g_prevTime = 0.0;
-static double g_lastNetSendTime = 0.0;
-
-static bool     g_localEntityBound = false;
-static uint32_t g_localEntityID = 0;
 
 static NiPoint3 g_prevPos{ 0.f, 0.f, 0.f };
 
-// -----------------------------------------------------------------------------
-// Helpers
-// -----------------------------------------------------------------------------
-static double GetNowSeconds()
-{
-    static double s_freq = [] {
-        LARGE_INTEGER f{};
-        QueryPerformanceFrequency(&f);
-        return double(f.QuadPart);
-        }();
-
-    LARGE_INTEGER c{};
-    QueryPerformanceCounter(&c);
-    return double(c.QuadPart) / s_freq;
-}
-
 // -----------------------------------------------------------------------------
 // PlayerCharacter update hook (LOCAL PLAYER ONLY)
+//
+// Only samples g_localPlayerState. Networking (receive, apply, send) runs
+// once per frame from g_CoSyncFrameScheduler via the Present hook.
 // -----------------------------------------------------------------------------
 static __int64 __fastcall ActorUpdate_Hook(
     PlayerCharacter* actor,
@@ -70,29 +54,11 @@ static __int64 __fastcall ActorUpdate_Hook(
     if (!localPlayer || actor != localPlayer)
         return result;
 
-    const double now = GetNowSeconds();
+    CoSyncTrace::SetThreadName("Game");
+    COSYNC_TRACE_SCOPE("TickHook.ActorUpdate");
 
-    // ---------------------------------------------------------
-    // CRITICAL: Networking ticks MUST ALWAYS RUN
-    // ---------------------------------------------------------
-    if (!CoSyncNet::IsInitialized())
-        CoSyncNet::PerformPendingInit();
-
-    CoSyncNet::Tick(now);
-
-    // ---------------------------------------------------------
-    // Bind local entity ONCE (DO NOT gate Tick)
-    // ---------------------------------------------------------
-    if (!g_localEntityBound && CoSyncNet::IsConnected())
-    {
-        g_localEntityID = CoSyncNet::GetMyEntityID();
-        g_localEntityBound = true;
-
-        LOG_INFO(
-            "[TickHook] Local entity bound: entityID=%u",
-            g_localEntityID
-        );
-    }
+    // Runs outside the scheduler frame: read the clock, not FrameTime()
+    const double now = CoSyncClock::Now();
 
     // ---------------------------------------------------------
     // World validity checks (movement only)
@@ -139,26 +105,6 @@ static __int64 __fastcall ActorUpdate_Hook(
     g_localPlayerState.formID = actor->formID;
     g_localPlayerState.cellFormID = actor->parentCell->formID;
 
-    // ---------------------------------------------------------
-    // Network send (CLIENT → HOST)
-    // ---------------------------------------------------------
-    if (CoSyncNet::IsConnected())
-    {
-        if (now - g_lastNetSendTime >= 0.05) // ~20 Hz
-        {
-            g_lastNetSendTime = now;
-
-            CoSyncNet::SendMyEntityUpdate(
-                g_localEntityID,
-                pos,
-                rot,
-                vel,
-                now // Add any additional required arguments here
-            );
-
-        }
-    }
-
     return result;
 }
 
@@ -201,11 +147,7 @@ void InstallTickHook()
     // Reset tracking
     g_hasPrevPos = false;
     g_prevTime = 0.0;
-    g_lastNetSendTime = 0.0;
     g_prevPos = { 0.f, 0.f, 0.f };
 
-    g_localEntityBound = false;
-    g_localEntityID = 0;
-
     LOG_INFO("[TickHook] TickHook installed successfully (vtable index %u)", kIndex);
 }